@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+#include "batchio.h"
+#include "definitions.h"
+
+/* Structure for the start of an archive */
+struct ArchiveHeader
+{
+    char magic[8]; /* ARCHIVE_MAGIC */
+    char version[8]; /* ASSEMBLER_VERSION of the writer */
+    int member_count; /* Number of ArchiveMember entries that follow */
+    int symbol_count; /* Number of ArchiveSymbol entries after the members */
+    int names_offset; /* NUL terminated names of members and symbols */
+    int names_length; /* Length of the name table */
+};
+
+/* Structure for one file stored in an archive, offsets are from the file start */
+struct ArchiveMember
+{
+    int name_offset; /* Path the file would have had, in the name table */
+    int data_offset; /* Contents */
+    int length; /* Length of the contents */
+};
+
+/* Structure for one exported symbol, the index is sorted by name */
+struct ArchiveSymbol
+{
+    int name_offset; /* Symbol name, in the name table */
+    int member; /* Object file member of the unit exporting the symbol */
+    int address; /* Address from the .ent file */
+};
+
+/* Structure for an archive mapped for reading */
+struct Archive
+{
+    char *map; /* Mapped file */
+    size_t map_length; /* Length of the mapped file */
+    const struct ArchiveHeader *header; /* Header at the start of the map */
+    const struct ArchiveMember *members; /* Member table */
+    const struct ArchiveSymbol *symbols; /* Symbol index */
+};
+
+/* Write files of a batch as one archive, FALSE if it could not be written */
+int Archive_write(
+    const char *path,
+    const struct BatchFile *files,
+    int count);
+
+/* Map an archive, FALSE if it is missing or invalid */
+int Archive_open(
+    struct Archive *archive,
+    const char *path);
+
+/* Unmap an archive */
+void Archive_close(struct Archive *archive);
+
+/* Name of a member or symbol from its name offset */
+const char *Archive_name(
+    const struct Archive *archive,
+    int name_offset);
+
+/* Find a member by path, -1 if it is missing */
+int Archive_find_member(
+    const struct Archive *archive,
+    const char *path);
+
+/* Find the first symbol of a name, -1 if it is missing */
+int Archive_find_symbol(
+    const struct Archive *archive,
+    const char *name);
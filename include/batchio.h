@@ -0,0 +1,29 @@
+#pragma once 
+
+#include <stddef.h> 
+#include "definitions.h" 
+
+#define BATCH_IO_STDIO (0) /* Plain stdio calls per file */
+#define BATCH_IO_URING (1) /* Linux io_uring submissions */
+
+/* Structure for one file of a batch */
+struct BatchFile
+{
+    char path[MAX_PATH_LEN]; /* File path */
+    char *data; /* File contents */
+    size_t length; /* Length of the contents */
+    int failed; /* TRUE if the file could not be read or written */
+};
+
+/* Read every file of a batch into memory, returns the backend used */
+int batch_read_files(
+    struct BatchFile* files,
+    int count);
+
+/* Write every file of a batch from memory, returns the backend used */
+int batch_write_files(
+    struct BatchFile* files,
+    int count);
+
+/* Force the stdio backend even where io_uring is available */
+void batch_io_disable_uring(void);
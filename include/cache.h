@@ -0,0 +1,42 @@
+#pragma once 
+
+#include <stddef.h> 
+#include "definitions.h" 
+
+#define CACHE_KEY_LEN (40) /* Max length of a cache key */
+#define CACHE_DEFAULT_SIZE (64L * 1024 * 1024) /* Default cache size limit in bytes */
+
+/* Structure for a local build cache */
+struct BuildCache
+{
+    char directory[TOTAL_LEN]; /* Cache directory */
+    long size_limit; /* Bytes kept after eviction */
+    int relocations; /* Units are assembled with a .rel table */
+};
+
+/* Compute the key of a source under the current version and options */
+void cache_key(
+    const char* data, /* Source bytes */
+    size_t length, /* Number of source bytes */
+    const char* signature, /* Options that change the output */
+    char* key /* Receives the key, CACHE_KEY_LEN bytes */
+);
+
+/* Restore the outputs of a unit from the cache, FALSE on a miss */
+int cache_restore(
+    const struct BuildCache* cache,
+    const char* key,
+    const char* name, /* Base file name of the unit */
+    const char* data, /* Source bytes, compared with the stored source */
+    size_t length /* Number of source bytes */
+);
+
+/* Store the source and outputs of a successfully assembled unit */
+void cache_store(
+    const struct BuildCache* cache,
+    const char* key,
+    const char* name /* Base file name of the unit */
+);
+
+/* Remove least recently used entries until the cache fits its limit */
+void cache_evict(const struct BuildCache* cache);
@@ -1,3 +1,4 @@
+#define ASSEMBLER_VERSION "1.2" /* Version recorded in cache keys */
 #define TOTAL_LEN (256) /* Max length for buffer */
 #define MAX_PATH_LEN (512) /* Max path length */
 #define MEMORY_BLOCK_SIZE (16) /* Size of memory block */
@@ -10,4 +11,9 @@
 #define DIRECTIVE_ENTRY_POINT ".entry" /* Entry point directive */
 #define DIRECTIVE_EXTERNAL_REFERENCE ".extern" /* External reference directive */
 #define DIRECTIVE_STRING_LITERAL ".string" /* String literal directive */
+#define DIRECTIVE_SPACE_RESERVE ".space" /* Reserve block directive */
+#define DIRECTIVE_FILL_BLOCK ".fill" /* Fill block directive */
+#define DIRECTIVE_INCLUDE ".include" /* Macro library include directive */
+#define DIRECTIVE_DEFINE ".define" /* Constant definition directive */
+#define LOAD_BASE_ADDRESS (100) /* Address of the first word */
 #define LABEL_DEFINITION_SEPARATOR ":" /* Label separator */
@@ -0,0 +1,66 @@
+#pragma once 
+
+#include <stdio.h> 
+
+#define DIAG_DUPLICATE_LABEL (0) /* Label defined twice or named like a keyword */
+#define DIAG_INVALID_SYNTAX (1) /* Statement is not a command or directive */
+#define DIAG_DUPLICATE_MACRO (2) /* Macro defined twice */
+#define DIAG_MACRO_PARAMETERS (3) /* Invalid macro parameter list */
+#define DIAG_LIBRARY_CONTENT (4) /* Statement inside a macro library */
+#define DIAG_INCLUDE_NAME (5) /* Include file name is not quoted */
+#define DIAG_INCLUDE_FAILED (6) /* Macro library is missing or invalid */
+#define DIAG_MACRO_ARGUMENTS (7) /* Arguments do not match the parameters */
+#define DIAG_RECURSIVE_MACRO (8) /* Macro calls itself */
+#define DIAG_ENDMACR_OUTSIDE (9) /* endmacr without a macro */
+#define DIAG_UNDEFINED_MACRO (10) /* Single word that is not a macro */
+#define DIAG_UNDEFINED_ENTRY (11) /* .entry names no label */
+#define DIAG_DUPLICATE_CONSTANT (12) /* Constant defined twice or named like a keyword */
+#define DIAG_INVALID_EXPRESSION (13) /* Expression cannot be folded */
+#define DIAG_UNDEFINED_OFFSET_LABEL (14) /* Label with an offset is not in the file */
+#define DIAG_LONG_EXPANSION (15) /* Expanded macro line is TOTAL_LEN bytes or longer */
+#define DIAG_BASE_OUT_OF_RANGE (16) /* Program runs past the last address from its base */
+#define DIAG_TOTAL_CODES (17) /* Number of diagnostic codes */
+
+#define DIAG_NO_COLUMN (0) /* Column is not known */
+#define DIAG_FLUSH_COUNT (1024) /* Diagnostics kept before they are printed */
+
+/* Structure for one reported problem, formatted only when printed */
+struct Diagnostic
+{
+    int line; /* Source line number */
+    int column; /* Column of the offending word, DIAG_NO_COLUMN if unknown */
+    int code; /* DIAG_ code */
+    int argument; /* Offset of the argument in the text pool, -1 for none */
+};
+
+/* Structure for diagnostics waiting to be printed */
+struct DiagnosticBuffer
+{
+    FILE *output; /* Stream the diagnostics are printed to */
+    struct Diagnostic *items; /* Pending diagnostics */
+    int count; /* Number of pending diagnostics */
+    int limit; /* Allocated diagnostics */
+    char *text; /* Argument strings of pending diagnostics */
+    int text_length; /* Used bytes of the text pool */
+    int text_limit; /* Allocated bytes of the text pool */
+    long reported; /* Diagnostics reported since init */
+};
+
+/* Initialize a DiagnosticBuffer printing to a stream */
+void Diagnostics_init(
+    struct DiagnosticBuffer *buffer,
+    FILE *output);
+
+/* Free memory used by a DiagnosticBuffer */
+void Diagnostics_free(struct DiagnosticBuffer *buffer);
+
+/* Record a diagnostic, argument may be NULL */
+void Diagnostics_add(
+    struct DiagnosticBuffer *buffer,
+    int line,
+    int column,
+    int code,
+    const char *argument);
+
+/* Format and print every pending diagnostic at once */
+void Diagnostics_flush(struct DiagnosticBuffer *buffer);
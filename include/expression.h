@@ -0,0 +1,38 @@
+#pragma once
+
+#include "hashtable.h"
+
+/* Constant expressions of immediates, .data values and .define */
+
+#define EXPRESSION_MAX_SHIFT (15) /* Largest shift, a word has 15 bits */
+
+/* Structure for the names defined by .define, kept apart from labels */
+struct ConstantTable
+{
+    struct HashTable index; /* Name to values index */
+    int *values; /* Values in definition order */
+    int count; /* Number of constants */
+    int limit; /* Allocated values */
+};
+
+/* Initialize a ConstantTable */
+void ConstantTable_init(struct ConstantTable *table);
+
+/* Free memory used by a ConstantTable */
+void ConstantTable_free(struct ConstantTable *table);
+
+/* Define a new constant, FALSE if the name is already defined */
+int ConstantTable_define(
+    struct ConstantTable *table,
+    const char *name,
+    int value);
+
+/* Check whether a word can name a constant */
+int expression_is_name(const char *word);
+
+/* Fold an expression of numbers and constants, FALSE if it is invalid or uses an unknown name */
+int expression_evaluate(
+    const char *text,
+    const struct ConstantTable *constants,
+    int *value,
+    int *uses_constants);
@@ -0,0 +1,34 @@
+#pragma once 
+
+/* Structure for one slot of a HashTable */
+struct HashSlot
+{
+    char *key; /* Owned copy of the key, NULL if the slot is free */
+    unsigned long hash; /* Hash of the key */
+    int value; /* Value stored under the key */
+};
+
+/* Structure for an open addressing table from names to indexes */
+struct HashTable
+{
+    struct HashSlot *slots; /* Slot array, size is a power of two */
+    unsigned long mask; /* Slot count minus one */
+    int count; /* Number of used slots */
+};
+
+/* Initialize a HashTable */
+void HashTable_init(struct HashTable *table);
+
+/* Free memory used by a HashTable */
+void HashTable_free(struct HashTable *table);
+
+/* Find the value stored under a key, -1 if the key is missing */
+int HashTable_find(
+    const struct HashTable *table,
+    const char *key);
+
+/* Store a value under a new key, FALSE if the key already exists */
+int HashTable_insert(
+    struct HashTable *table,
+    const char *key,
+    int value);
@@ -0,0 +1,74 @@
+#pragma once 
+
+#include "hashtable.h" 
+
+#define LINE_NO_SYMBOL "*" /* Saved in place of a missing word symbol */
+
+/* Structure for the results of one statement line, reused between runs */
+struct LineRecord
+{
+    char *text; /* Statement text */
+    int code_size; /* Code words of the statement */
+    int data_size; /* Data words of the statement */
+    char **labels; /* Labels defined by the statement */
+    int label_count; /* Number of labels */
+    char *entry; /* Name exported by .entry, or NULL */
+    int encoded; /* TRUE once the words below are known */
+    int *words; /* Encoded words */
+    char **symbols; /* Label referenced by each word, or NULL */
+    int word_count; /* Number of words */
+    int word_limit; /* Allocated words */
+    int used; /* TRUE if the statement appears in the current source */
+    int failed; /* TRUE if the statement reported errors or depends on other statements, never saved */
+};
+
+/* Structure for the records of one source */
+struct LineCache
+{
+    struct LineRecord *records; /* Records array */
+    int record_count; /* Number of records */
+    int record_limit; /* Allocated records */
+    struct HashTable index; /* Statement text to record index */
+};
+
+/* Initialize a LineCache */
+void LineCache_init(struct LineCache *cache);
+
+/* Free memory used by a LineCache */
+void LineCache_free(struct LineCache *cache);
+
+/* Find the record of a statement, NULL if missing */
+struct LineRecord *LineCache_find(
+    struct LineCache *cache,
+    const char *text);
+
+/* Add an empty record for a new statement */
+struct LineRecord *LineCache_add(
+    struct LineCache *cache,
+    const char *text);
+
+/* Add a label defined by a statement */
+void LineRecord_add_label(
+    struct LineRecord *record,
+    const char *name);
+
+/* Set the name exported by a statement */
+void LineRecord_set_entry(
+    struct LineRecord *record,
+    const char *name);
+
+/* Add an encoded word, symbol is NULL for words without a label */
+void LineRecord_add_word(
+    struct LineRecord *record,
+    int value,
+    const char *symbol);
+
+/* Load records saved by a previous run, FALSE if there are none */
+int LineCache_load(
+    struct LineCache *cache,
+    const char *path);
+
+/* Save the records used by the current run */
+int LineCache_save(
+    const struct LineCache *cache,
+    const char *path);
@@ -0,0 +1,59 @@
+#pragma once
+
+/* Instruction set shared by the assembler, simulator and disassembler */
+
+#define NO_OPERANDS_GROUP (0) /* No operands */
+#define ONE_OPERAND_GROUP (1) /* One operand */
+#define TWO_OPERANDS_GROUP (2) /* Two operands */
+
+#define IMMEDIATE_GROUP_OPERAND (1) /* Immediate operand */
+#define DIR_GROUP_OPERAND (2) /* Direct operand */
+#define INDIR_GROUP_OPERAND (4) /* Indirect operand */
+#define REGISTER_GROUP_OPERAND (8) /* Register operand */
+
+#define ABSOLUTE_FLAG (0x4) /* Absolute address flag */
+#define RELOCATABLE_FLAG (0x2) /* Relocatable address flag */
+#define EXTERNAL_FLAG (0x1) /* External address flag */
+
+#define ISA_WORD_MASK (0x7FFF) /* Bits of a machine word */
+#define ISA_FLAGS_MASK (0x7) /* A, R and E bits of a word */
+#define ISA_OPCODE_SHIFT (11) /* Opcode bits of the first word */
+#define ISA_SOURCE_MODE_SHIFT (7) /* Source operand group bits of the first word */
+#define ISA_TARGET_MODE_SHIFT (3) /* Target operand group bits of the first word */
+#define ISA_MODE_MASK (0xF) /* Bits of an operand group */
+#define ISA_SOURCE_REGISTER_SHIFT (6) /* Source register bits of an operand word */
+#define ISA_TARGET_REGISTER_SHIFT (3) /* Target register bits of an operand word */
+#define ISA_VALUE_SHIFT (3) /* Value or address bits of an operand word */
+#define ISA_VALUE_MASK (0xFFF) /* Width of a value or address */
+#define ISA_VALUE_SIGN_BIT (0x800) /* Sign bit of an immediate value */
+
+#define TOTAL_COMMANDS (16) /* Total number of commands */
+
+struct instruction
+{
+    const char *name; /* Instruction name */
+    int command_opcode; /* Opcode for instruction */
+    int group; /* Group for instruction */
+};
+
+/* Commands in opcode order */
+extern const struct instruction valid_commands_sizes[];
+
+/* Structure for an instruction decoded from machine words */
+struct DecodedInstruction
+{
+    int opcode; /* Index into valid_commands_sizes */
+    int size; /* Words of the instruction */
+    int source_group; /* Operand group of the source, zero if absent */
+    int target_group; /* Operand group of the target, zero if absent */
+    int source; /* Immediate value, address or register of the source */
+    int target; /* Immediate value, address or register of the target */
+    int source_flags; /* A, R and E bits of the source word */
+    int target_flags; /* A, R and E bits of the target word */
+};
+
+/* Decode the instruction starting at words[0], FALSE if the words cannot encode one */
+int isa_decode(
+    const int *words,
+    int available,
+    struct DecodedInstruction *decoded);
@@ -0,0 +1,37 @@
+#pragma once 
+
+#include <stddef.h> 
+#include "definitions.h" 
+#include "macros.h" 
+
+#define MACRO_LIBRARY_EXTENSION ".mlib" /* Extension of precompiled macro libraries */
+
+/* Structure for a macro library named by .include, shared by all units of a run */
+struct MacroLibrary
+{
+    char path[MAX_PATH_LEN]; /* Path named by .include */
+    struct MacrosList macros; /* Compiled macros of the library */
+    char *map; /* Mapped precompiled file, NULL for a source library */
+    size_t map_length; /* Length of the mapped file */
+    int failed; /* TRUE if the library could not be loaded */
+};
+
+/* Find a library loaded earlier in this run, NULL if missing */
+struct MacroLibrary *MacroLibrary_find(const char *path);
+
+/* Register a new, still empty library */
+struct MacroLibrary *MacroLibrary_add(const char *path);
+
+/* Check if a path names a precompiled library */
+int MacroLibrary_is_precompiled(const char *path);
+
+/* Map a precompiled library, FALSE if it is missing or invalid */
+int MacroLibrary_map(struct MacroLibrary *library);
+
+/* Write compiled macros as a precompiled library */
+int MacroLibrary_save(
+    const struct MacrosList *macros,
+    const char *path);
+
+/* Unmap and free every library of the run */
+void MacroLibrary_release_all(void);
@@ -2,6 +2,20 @@
 
 #include "definitions.h" 
 
+#define NO_PARAMETER_SLOT (-1) /* Fragment holds literal text */
+
+#define MACRO_STATE_READY (0) /* Macro can be expanded */
+#define MACRO_STATE_EXPANDING (1) /* Macro expansion is in progress */
+#define MACRO_STATE_RECURSIVE (2) /* Macro calls itself */
+
+/* Structure for a piece of a compiled macro body */
+struct MacroFragment
+{
+    int offset; /* Offset of literal text in the pool */
+    int length; /* Length of literal text */
+    int slot; /* Parameter index or NO_PARAMETER_SLOT */
+};
+
 /* Structure for a macro */
 struct Macro
 {
@@ -9,6 +23,18 @@ struct Macro
     char **lines; /* Lines of the macro */
     int counter_line; /* Current line count */
     int max_line_limit; /* Maximum line count */
+    char **params; /* Parameter names */
+    int param_count; /* Number of parameters */
+    char *pool; /* Literal text of the compiled body */
+    int pool_length; /* Used bytes in the pool */
+    int pool_limit; /* Allocated bytes in the pool */
+    struct MacroFragment *fragments; /* Compiled body template */
+    int fragment_count; /* Number of fragments */
+    int fragment_limit; /* Allocated fragments */
+    char *flat_body; /* Memoized expansion with nested calls flattened */
+    int flat_length; /* Length of the memoized expansion */
+    int state; /* Expansion state for cycle detection */
+    int borrowed; /* TRUE if params, pool and fragments belong to a macro library */
 };
 
 /* Initialize a Macro */
@@ -24,6 +50,31 @@ void Macro_append(
     struct Macro* macroPtr,
     const char* line);
 
+/* Add a named parameter to a Macro, FALSE if already present */
+int Macro_add_parameter(
+    struct Macro* macroPtr,
+    const char* name);
+
+/* Compile the appended lines into a body template */
+void Macro_compile(struct Macro* macroPtr);
+
+/* Splice arguments into the body template; lines are NUL separated */
+char *Macro_expand(
+    const struct Macro* macroPtr,
+    char **args,
+    int *length);
+
+/* Share the compiled template of a library Macro without copying it */
+void Macro_borrow(
+    struct Macro* macroPtr,
+    const struct Macro* template);
+
+/* Keep the flattened expansion of a Macro for later calls */
+void Macro_memoize(
+    struct Macro* macroPtr,
+    const char* body,
+    int length);
+
 /* Structure for a list of macros */
 struct MacrosList
 {
@@ -1,11 +1,20 @@
 #pragma once 
 
 #include <stdio.h> 
+#include "definitions.h" 
 #include "macros.h" 
 
 /* Structure for assembler passes (we have two passes assembler) */
 struct passes {
     int pass_number; /* Current pass number */
+    int pipelined; /* Run the second pass as reader, encoder and writer threads */
+    char state_path[TOTAL_LEN]; /* Statement results kept between runs, empty to disable */
+    int max_errors; /* Stop the first pass after this many errors, zero for no limit */
+    int grouped_externals; /* Write each external once with all its reference addresses */
+    int base_address; /* Address of the first word */
+    FILE* filerel; /* Relocation table, NULL if not requested */
+    int optimize; /* Rewrite statements into shorter equivalents */
+    int strip_unused; /* Leave out code and data no entry point can reach */
 };
 
 /* Initialize passes structure */
@@ -22,6 +31,14 @@ int assembler_first_pass(
     FILE* filewrong /* File for errors */
 );
 
+/* Compile a macro-only source into a precompiled macro library */
+int assembler_precompile(
+    struct passes* passes,
+    FILE* filelib, /* Macro library source */
+    const char* library_path, /* Precompiled library to write */
+    FILE* filewrong /* File for errors */
+);
+
 /* Second pass of assembler process */
 void assembler_second_pass(
     struct passes* passes,
@@ -0,0 +1,30 @@
+#pragma once 
+
+#define RING_CACHE_LINE (64) /* Bytes kept between producer and consumer fields */
+
+/* Structure for a bounded single-producer single-consumer queue */
+struct Ring
+{
+    void **slots; /* Queued items */
+    unsigned long mask; /* Capacity minus one, capacity is a power of two */
+    char producer_padding[RING_CACHE_LINE]; /* Keep head and tail on separate lines */
+    unsigned long head; /* Next slot to write, owned by the producer */
+    char consumer_padding[RING_CACHE_LINE]; /* Keep head and tail on separate lines */
+    unsigned long tail; /* Next slot to read, owned by the consumer */
+};
+
+/* Initialize a Ring holding at least capacity items */
+void Ring_init(
+    struct Ring* ring,
+    int capacity);
+
+/* Free memory used by a Ring */
+void Ring_free(struct Ring* ring);
+
+/* Add an item, waits while the Ring is full */
+void Ring_push(
+    struct Ring* ring,
+    void* item);
+
+/* Remove the oldest item, waits while the Ring is empty */
+void *Ring_pop(struct Ring* ring);
@@ -0,0 +1,66 @@
+#pragma once 
+
+#include <stdio.h> 
+
+#define STATS_PHASE_MACROS (0) /* Macro expansion phase */
+#define STATS_PHASE_FIRST_PASS (1) /* First pass phase, reported without macro expansion */
+#define STATS_PHASE_SECOND_PASS (2) /* Second pass phase */
+#define STATS_PHASE_OUTPUT (3) /* Output writing phase */
+#define STATS_PHASE_TOTAL (4) /* Whole run */
+#define STATS_TOTAL_PHASES (5) /* Number of timed phases */
+
+#define STATS_FORMAT_TEXT (1) /* Human readable report */
+#define STATS_FORMAT_JSON (2) /* Machine readable report */
+
+#define STATS_FILE_AM (0) /* Macro file */
+#define STATS_FILE_OB (1) /* Object file */
+#define STATS_FILE_ENT (2) /* Entry file */
+#define STATS_FILE_EXT (3) /* External file */
+#define STATS_FILE_REL (4) /* Relocation table */
+#define STATS_TOTAL_FILES (5) /* Number of output files */
+
+/* Structure for run statistics */
+struct stats
+{
+    int enabled; /* Statistics were requested for this run */
+    double wall_time[STATS_TOTAL_PHASES]; /* Wall time per phase in seconds */
+    double cpu_time[STATS_TOTAL_PHASES]; /* CPU time per phase in seconds */
+    double wall_start[STATS_TOTAL_PHASES]; /* Wall time when phase started */
+    double cpu_start[STATS_TOTAL_PHASES]; /* CPU time when phase started */
+    long lines; /* Source lines read */
+    long tokenizer_calls; /* Calls to the tokenizer */
+    long symbol_probes; /* Label and entry comparisons */
+    long memo_hits; /* Statements reused from the encoding memo */
+    long allocations; /* Heap allocations */
+    long bytes_written[STATS_TOTAL_FILES]; /* Bytes written per output file */
+};
+
+extern struct stats assembler_stats; /* Statistics of the current run */
+
+/* Hot-path counters compile to nothing unless ASSEMBLER_STATS is defined */
+#ifdef ASSEMBLER_STATS
+#define STATS_COUNT(counter) (assembler_stats.counter++)
+#else
+#define STATS_COUNT(counter) ((void)0)
+#endif
+
+/* Figures kept once per unit or file, phases are only timed once stats_enable was called */
+#define STATS_ADD(counter, amount) (assembler_stats.counter += (amount))
+#define STATS_PHASE_BEGIN(phase) stats_phase_begin(phase)
+#define STATS_PHASE_END(phase) stats_phase_end(phase)
+
+/* Start collecting statistics */
+void stats_enable(void);
+
+/* Start timing a phase */
+void stats_phase_begin(int phase);
+
+/* Stop timing a phase and add the elapsed time */
+void stats_phase_end(int phase);
+
+/* Print collected statistics */
+void stats_report(
+    FILE* output, /* Report destination */
+    const char* name, /* Assembled file name */
+    int format /* STATS_FORMAT_TEXT or STATS_FORMAT_JSON */
+);
@@ -5,3 +5,6 @@ int total_words_in_row(const char *line);
 
 /* Get specific word by number from a line */
 char *get_word_number(const char *line, int id);
+
+/* Get the column a word starts at, the end of the line for a missing word */
+int get_word_column(const char *line, int id);
@@ -0,0 +1,39 @@
+#pragma once 
+
+#define TRACE_RING_EVENTS (1 << 16) /* Events kept, older ones are overwritten */
+#define TRACE_MAX_THREADS (128) /* Threads told apart in a trace */
+
+#define TRACE_OPEN "file_open" /* Opening or reading the sources */
+#define TRACE_MACROS "macro_expansion" /* Expanding one macro call */
+#define TRACE_FIRST_PASS "first_pass" /* First pass of a unit */
+#define TRACE_SECOND_PASS "second_pass" /* Second pass of a unit */
+#define TRACE_ENTRIES "entry_resolution" /* Resolving and sorting .entry names */
+#define TRACE_OUTPUT "output_flush" /* Writing the outputs */
+#define TRACE_READER "pipeline_reader" /* Reader thread of the pipelined pass */
+#define TRACE_WRITER "pipeline_writer" /* Writer thread of the pipelined pass */
+
+extern int trace_enabled; /* TRUE when events are recorded */
+
+/* Events cost one test unless tracing was requested */
+#define TRACE_BEGIN(name) (trace_enabled ? trace_record(name, 'B') : (void)0)
+#define TRACE_END(name) (trace_enabled ? trace_record(name, 'E') : (void)0)
+
+/* Start recording events */
+void trace_enable(void);
+
+/* Tag the following events with a unit name */
+void trace_set_unit(const char *name);
+
+/* Give the calling thread its own named row in the trace */
+void trace_name_thread(const char *name);
+
+/* Record a begin ('B') or end ('E') event on the calling thread */
+void trace_record(
+    const char *name,
+    char phase);
+
+/* Write recorded events in Chrome trace-event JSON format */
+int trace_write(const char *path);
+
+/* Free memory used by the recorder */
+void trace_release(void);
@@ -0,0 +1,346 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "archive.h"
+#include "stats.h"
+
+#define ARCHIVE_MAGIC "ASMARC" /* First bytes of an archive */
+
+/* Structure for the archive being written */
+struct ArchiveBuilder
+{
+    struct ArchiveMember *members; /* Member table */
+    struct ArchiveSymbol *symbols; /* Symbol index */
+    int symbol_count; /* Number of symbols */
+    int symbols_limit; /* Allocated symbols */
+    char *names; /* Name table */
+    int names_length; /* Bytes used in the name table */
+    int names_limit; /* Allocated bytes of the name table */
+};
+
+static const char *sort_names; /* Name table seen by compare_symbols */
+
+static int add_name(
+    struct ArchiveBuilder *builder,
+    const char *name,
+    int length
+)
+{
+    int offset;
+
+    if (builder->names_length + length + 1 > builder->names_limit)
+    {
+        builder->names_limit = (builder->names_length + length + 1) * 2; /* Increase limit */
+        STATS_COUNT(allocations);
+        builder->names = realloc(builder->names, builder->names_limit);
+    }
+
+    offset = builder->names_length;
+    memcpy(&builder->names[offset], name, length);
+    builder->names[offset + length] = '\0';
+    builder->names_length += length + 1;
+    return offset;
+}
+
+static int has_extension(
+    const char *path,
+    const char *extension
+)
+{
+    size_t length;
+
+    length = strlen(path);
+    return length >= strlen(extension) && strcmp(&path[length - strlen(extension)], extension) == 0;
+}
+
+/* Add every "name address" line of an entry file to the symbol index */
+static void add_symbols(
+    struct ArchiveBuilder *builder,
+    const struct BatchFile *file,
+    int member
+)
+{
+    const char *line;
+    const char *end;
+    const char *space;
+
+    for (line = file->data, end = file->data + file->length; line < end; line = space + 1)
+    {
+        space = memchr(line, ' ', end - line);
+        if (space == NULL)
+        {
+            break;
+        }
+
+        if (builder->symbol_count == builder->symbols_limit)
+        {
+            builder->symbols_limit += MEMORY_BLOCK_SIZE * MEMORY_BLOCK_SIZE; /* Increase limit */
+            STATS_COUNT(allocations);
+            builder->symbols = realloc(builder->symbols, sizeof(*builder->symbols) * builder->symbols_limit);
+        }
+        builder->symbols[builder->symbol_count].name_offset = add_name(builder, line, space - line);
+        builder->symbols[builder->symbol_count].member = member;
+        builder->symbols[builder->symbol_count].address = atoi(space + 1);
+        builder->symbol_count++;
+
+        space = memchr(space, '\n', end - space);
+        if (space == NULL)
+        {
+            break;
+        }
+    }
+}
+
+static int compare_symbols(const void *a, const void *b)
+{
+    const struct ArchiveSymbol *first = a;
+    const struct ArchiveSymbol *second = b;
+    int order;
+
+    order = strcmp(&sort_names[first->name_offset], &sort_names[second->name_offset]);
+    if (order == 0)
+    {
+        order = (first->member > second->member) - (first->member < second->member);
+    }
+    return order;
+}
+
+/* Write files of a batch as one archive */
+int Archive_write(
+    const char *path,
+    const struct BatchFile *files,
+    int count
+)
+{
+    FILE *output;
+    struct ArchiveHeader header;
+    struct ArchiveBuilder builder;
+    long offset;
+    int object;
+    int id;
+    int written;
+
+    memset(&builder, 0, sizeof(builder));
+    STATS_COUNT(allocations);
+    builder.members = malloc(sizeof(*builder.members) * (count + 1));
+
+    /* Entry files follow the object file of their unit */
+    object = -1;
+    for (id = 0; id < count; id++)
+    {
+        builder.members[id].name_offset = add_name(&builder, files[id].path, strlen(files[id].path));
+        builder.members[id].length = files[id].length;
+        if (has_extension(files[id].path, ".ob"))
+        {
+            object = id;
+        }
+        else if (has_extension(files[id].path, ".ent") && object >= 0)
+        {
+            add_symbols(&builder, &files[id], object);
+        }
+    }
+
+    sort_names = builder.names;
+    qsort(builder.symbols, builder.symbol_count, sizeof(*builder.symbols), compare_symbols);
+
+    memset(&header, 0, sizeof(header));
+    strcpy(header.magic, ARCHIVE_MAGIC);
+    strcpy(header.version, ASSEMBLER_VERSION);
+    header.member_count = count;
+    header.symbol_count = builder.symbol_count;
+    header.names_offset = sizeof(header) + sizeof(*builder.members) * count + sizeof(*builder.symbols) * builder.symbol_count;
+    header.names_length = builder.names_length;
+
+    offset = header.names_offset + header.names_length;
+    for (id = 0; id < count; id++)
+    {
+        builder.members[id].data_offset = offset;
+        offset += files[id].length;
+    }
+
+    written = FALSE;
+    output = fopen(path, "wb");
+    if (output != NULL)
+    {
+        fwrite(&header, sizeof(header), 1, output);
+        fwrite(builder.members, sizeof(*builder.members), count, output);
+        if (builder.symbol_count > 0)
+        {
+            fwrite(builder.symbols, sizeof(*builder.symbols), builder.symbol_count, output);
+        }
+        if (builder.names_length > 0)
+        {
+            fwrite(builder.names, 1, builder.names_length, output);
+        }
+        for (id = 0; id < count; id++)
+        {
+            if (files[id].length > 0)
+            {
+                fwrite(files[id].data, 1, files[id].length, output);
+            }
+        }
+        written = fclose(output) == 0;
+    }
+
+    free(builder.members);
+    free(builder.symbols);
+    free(builder.names);
+    return written;
+}
+
+/* Map an archive */
+int Archive_open(
+    struct Archive *archive,
+    const char *path
+)
+{
+    int descriptor;
+    int id;
+    struct stat info;
+    const struct ArchiveHeader *header;
+    size_t tables;
+
+    archive->map = NULL;
+    archive->map_length = 0;
+
+    descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+    {
+        return FALSE;
+    }
+
+    if (fstat(descriptor, &info) != 0 || (size_t)info.st_size < sizeof(*header))
+    {
+        close(descriptor);
+        return FALSE;
+    }
+
+    archive->map = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (archive->map == MAP_FAILED)
+    {
+        archive->map = NULL;
+        return FALSE;
+    }
+    archive->map_length = info.st_size;
+
+    header = (const struct ArchiveHeader *)archive->map;
+    archive->header = header;
+    archive->members = (const struct ArchiveMember *)(archive->map + sizeof(*header));
+    archive->symbols = (const struct ArchiveSymbol *)(archive->members + (header->member_count > 0 ? header->member_count : 0));
+
+    /* Archives of another version or with tables outside the file are rejected */
+    tables = sizeof(*header) + sizeof(struct ArchiveMember) * (size_t)header->member_count +
+             sizeof(struct ArchiveSymbol) * (size_t)header->symbol_count;
+    if (strncmp(header->magic, ARCHIVE_MAGIC, sizeof(header->magic)) != 0 ||
+        strncmp(header->version, ASSEMBLER_VERSION, sizeof(header->version)) != 0 ||
+        header->member_count < 0 || header->symbol_count < 0 ||
+        header->names_offset < 0 || header->names_length < 0 ||
+        (size_t)header->names_offset < tables ||
+        (size_t)header->names_offset + header->names_length > archive->map_length ||
+        (header->names_length > 0 && archive->map[header->names_offset + header->names_length - 1] != '\0'))
+    {
+        Archive_close(archive); /* Nothing of a rejected archive stays mapped */
+        return FALSE;
+    }
+
+    for (id = 0; id < header->member_count; id++)
+    {
+        if (archive->members[id].name_offset < 0 || archive->members[id].name_offset >= header->names_length ||
+            archive->members[id].data_offset < 0 || archive->members[id].length < 0 ||
+            (size_t)archive->members[id].data_offset + archive->members[id].length > archive->map_length)
+        {
+            Archive_close(archive); /* Nothing of a rejected archive stays mapped */
+            return FALSE;
+        }
+    }
+
+    for (id = 0; id < header->symbol_count; id++)
+    {
+        if (archive->symbols[id].name_offset < 0 || archive->symbols[id].name_offset >= header->names_length ||
+            archive->symbols[id].member < 0 || archive->symbols[id].member >= header->member_count)
+        {
+            Archive_close(archive); /* Nothing of a rejected archive stays mapped */
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/* Unmap an archive */
+void Archive_close(struct Archive *archive)
+{
+    if (archive->map != NULL)
+    {
+        munmap(archive->map, archive->map_length);
+    }
+    archive->map = NULL;
+    archive->map_length = 0;
+}
+
+/* Name of a member or symbol from its name offset */
+const char *Archive_name(
+    const struct Archive *archive,
+    int name_offset
+)
+{
+    return archive->map + archive->header->names_offset + name_offset;
+}
+
+/* Find a member by path */
+int Archive_find_member(
+    const struct Archive *archive,
+    const char *path
+)
+{
+    int id;
+
+    for (id = 0; id < archive->header->member_count; id++)
+    {
+        if (strcmp(Archive_name(archive, archive->members[id].name_offset), path) == 0)
+        {
+            return id;
+        }
+    }
+
+    return -1;
+}
+
+/* Find the first symbol of a name, the index is sorted so this is a binary search */
+int Archive_find_symbol(
+    const struct Archive *archive,
+    const char *name
+)
+{
+    int low;
+    int high;
+    int middle;
+
+    low = 0;
+    high = archive->header->symbol_count;
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        if (strcmp(Archive_name(archive, archive->symbols[middle].name_offset), name) < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low < archive->header->symbol_count &&
+        strcmp(Archive_name(archive, archive->symbols[low].name_offset), name) == 0)
+    {
+        return low;
+    }
+    return -1;
+}
@@ -0,0 +1,544 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "batchio.h"
+#include "stats.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define BATCH_IO_HAS_URING
+#endif
+#endif
+
+#ifdef BATCH_IO_HAS_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+#define URING_QUEUE_DEPTH (64) /* Operations submitted at once */
+
+static int uring_disabled; /* TRUE when io_uring must not be used */
+
+void batch_io_disable_uring(void)
+{
+    uring_disabled = TRUE;
+}
+
+/* Read one file with stdio */
+static void stdio_read_file(struct BatchFile *file)
+{
+    FILE *stream;
+    long length;
+
+    file->data = NULL;
+    file->length = 0;
+    file->failed = TRUE;
+
+    stream = fopen(file->path, "rb");
+    if (stream == NULL)
+    {
+        return;
+    }
+
+    fseek(stream, 0, SEEK_END); /* Find the file size */
+    length = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    STATS_COUNT(allocations);
+    file->data = malloc(length + 1); /* Keep room for a terminator */
+    file->length = fread(file->data, 1, length, stream);
+    file->data[file->length] = '\0';
+    file->failed = ferror(stream) != 0;
+    fclose(stream);
+}
+
+/* Write one file with stdio */
+static void stdio_write_file(struct BatchFile *file)
+{
+    FILE *stream;
+
+    file->failed = TRUE;
+    stream = fopen(file->path, "wb");
+    if (stream == NULL)
+    {
+        return;
+    }
+
+    file->failed = fwrite(file->data, 1, file->length, stream) != file->length;
+    file->failed = (fclose(stream) != 0) || file->failed;
+}
+
+#ifdef BATCH_IO_HAS_URING
+
+/* Structure for a mapped io_uring instance */
+struct Uring
+{
+    int fd; /* Ring file descriptor */
+    unsigned *sq_head; /* Submission queue head */
+    unsigned *sq_tail; /* Submission queue tail */
+    unsigned *sq_mask; /* Submission queue index mask */
+    unsigned *sq_array; /* Submission queue index array */
+    struct io_uring_sqe *sqes; /* Submission queue entries */
+    unsigned *cq_head; /* Completion queue head */
+    unsigned *cq_tail; /* Completion queue tail */
+    unsigned *cq_mask; /* Completion queue index mask */
+    struct io_uring_cqe *cqes; /* Completion queue entries */
+    void *sq_ring; /* Mapped submission ring */
+    size_t sq_ring_size; /* Size of the submission ring mapping */
+    void *cq_ring; /* Mapped completion ring */
+    size_t cq_ring_size; /* Size of the completion ring mapping */
+    size_t sqes_size; /* Size of the entries mapping */
+    int unsettled; /* TRUE when a failed wait left operations in flight */
+};
+
+/* Structure for the operations on one file */
+struct UringRequest
+{
+    struct BatchFile *file; /* File being transferred */
+    int flags; /* Flags the file is opened with */
+    int fd; /* Open descriptor */
+    size_t done; /* Bytes transferred so far */
+    struct statx status; /* Size of a file being read */
+};
+
+static int Uring_init(struct Uring *uring)
+{
+    struct io_uring_params params;
+    char *sq;
+    char *cq;
+
+    memset(&params, 0, sizeof(params));
+    uring->unsettled = FALSE;
+    uring->fd = syscall(__NR_io_uring_setup, URING_QUEUE_DEPTH, &params);
+    if (uring->fd < 0)
+    {
+        return FALSE; /* Kernel without io_uring or io_uring is blocked */
+    }
+
+    uring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    uring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (uring->cq_ring_size > uring->sq_ring_size)
+        {
+            uring->sq_ring_size = uring->cq_ring_size; /* One mapping for both rings */
+        }
+        uring->cq_ring_size = uring->sq_ring_size;
+    }
+
+    uring->sq_ring = mmap(
+        NULL,
+        uring->sq_ring_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        uring->fd,
+        IORING_OFF_SQ_RING);
+    uring->cq_ring = uring->sq_ring;
+    if (uring->sq_ring != MAP_FAILED && !(params.features & IORING_FEAT_SINGLE_MMAP))
+    {
+        uring->cq_ring = mmap(
+            NULL,
+            uring->cq_ring_size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            uring->fd,
+            IORING_OFF_CQ_RING);
+    }
+    uring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    uring->sqes = mmap(
+        NULL,
+        uring->sqes_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        uring->fd,
+        IORING_OFF_SQES);
+
+    if (uring->sq_ring == MAP_FAILED || uring->cq_ring == MAP_FAILED || uring->sqes == MAP_FAILED)
+    {
+        close(uring->fd);
+        return FALSE;
+    }
+
+    sq = uring->sq_ring;
+    cq = uring->cq_ring;
+    uring->sq_head = (unsigned *)(sq + params.sq_off.head);
+    uring->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    uring->sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+    uring->sq_array = (unsigned *)(sq + params.sq_off.array);
+    uring->cq_head = (unsigned *)(cq + params.cq_off.head);
+    uring->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    uring->cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+    uring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+    return TRUE;
+}
+
+static void Uring_free(struct Uring *uring)
+{
+    munmap(uring->sqes, uring->sqes_size);
+    if (uring->cq_ring != uring->sq_ring)
+    {
+        munmap(uring->cq_ring, uring->cq_ring_size);
+    }
+    munmap(uring->sq_ring, uring->sq_ring_size);
+    close(uring->fd);
+}
+
+/* Queue the next operation of a file, reads and writes cover its untransferred part */
+static void Uring_queue(
+    struct Uring *uring, 
+    struct UringRequest *request,
+    int opcode
+)
+{
+    unsigned tail;
+    unsigned index;
+    struct io_uring_sqe *sqe;
+
+    tail = *uring->sq_tail;
+    index = tail & *uring->sq_mask;
+    sqe = &uring->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = request->fd;
+    sqe->user_data = (unsigned long)request;
+    switch (opcode)
+    {
+    case IORING_OP_OPENAT:
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (unsigned long)request->file->path;
+        sqe->open_flags = request->flags;
+        sqe->len = 0666;
+        break;
+
+    case IORING_OP_STATX:
+        sqe->addr = (unsigned long)""; /* Status of the descriptor itself */
+        sqe->statx_flags = AT_EMPTY_PATH;
+        sqe->len = STATX_SIZE;
+        sqe->off = (unsigned long)&request->status;
+        break;
+
+    case IORING_OP_READ:
+    case IORING_OP_WRITE:
+        sqe->addr = (unsigned long)(request->file->data + request->done);
+        sqe->len = request->file->length - request->done;
+        sqe->off = request->done;
+        break;
+    }
+
+    uring->sq_array[index] = index;
+    __atomic_store_n(uring->sq_tail, tail + 1, __ATOMIC_RELEASE); /* Publish the entry */
+}
+
+/* Apply one completion to its file, returns TRUE if a transfer must be continued */
+static int Uring_apply(
+    struct UringRequest *request,
+    int opcode,
+    int result
+)
+{
+    struct BatchFile *file;
+
+    file = request->file;
+    if (opcode == IORING_OP_CLOSE)
+    {
+        request->fd = -1;
+        file->failed = file->failed || result < 0; /* Delayed write errors show up here */
+        return FALSE;
+    }
+
+    /* A write that makes no progress would leave the file truncated */
+    if (result < 0 || (result == 0 && opcode == IORING_OP_WRITE))
+    {
+        file->failed = TRUE; /* Retried with stdio by the caller */
+        return FALSE;
+    }
+
+    switch (opcode)
+    {
+    case IORING_OP_OPENAT:
+        request->fd = result;
+        return FALSE;
+
+    case IORING_OP_STATX:
+        STATS_COUNT(allocations);
+        file->length = request->status.stx_size;
+        file->data = malloc(file->length + 1); /* Keep room for a terminator */
+        return FALSE;
+    }
+
+    request->done += result;
+    if (result == 0 || request->done == file->length)
+    {
+        file->length = request->done; /* File may have been shorter */
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* Submit queued operations and wait for all of them to complete, FALSE if the
+   ring failed, in which case every operation the kernel took is waited for
+   before returning so no buffer or descriptor is still in use */
+static int Uring_complete(
+    struct Uring *uring, 
+    int submitted,
+    int opcode
+)
+{
+    unsigned head;
+    int pending;
+    int requeued;
+    int failed;
+    long result;
+    struct io_uring_cqe *cqe;
+    struct UringRequest *request;
+
+    failed = FALSE;
+    pending = submitted;
+    while (pending > 0)
+    {
+        result = syscall(
+            __NR_io_uring_enter,
+            uring->fd,
+            failed ? 0 : submitted,
+            1,
+            IORING_ENTER_GETEVENTS,
+            NULL,
+            0);
+        if (result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            if (failed)
+            {
+                uring->unsettled = TRUE; /* Nothing left to wait with */
+                return FALSE;
+            }
+
+            /* Entries the kernel never took will not complete */
+            failed = TRUE;
+            pending -= *uring->sq_tail - __atomic_load_n(uring->sq_head, __ATOMIC_ACQUIRE);
+        }
+        else if (result >= 0 && !failed)
+        {
+            submitted -= result;
+        }
+        requeued = 0;
+
+        head = *uring->cq_head;
+        while (head != __atomic_load_n(uring->cq_tail, __ATOMIC_ACQUIRE))
+        {
+            cqe = &uring->cqes[head & *uring->cq_mask];
+            request = (struct UringRequest *)(unsigned long)cqe->user_data;
+            head++;
+            pending--;
+
+            if (Uring_apply(request, opcode, cqe->res))
+            {
+                if (failed)
+                {
+                    request->file->failed = TRUE; /* Not continued on a failed ring */
+                    continue;
+                }
+                Uring_queue(uring, request, opcode); /* Short transfer, continue it */
+                requeued++;
+            }
+        }
+        __atomic_store_n(uring->cq_head, head, __ATOMIC_RELEASE); /* Release the entries */
+
+        submitted += requeued;
+        pending += requeued;
+    }
+
+    return !failed;
+}
+
+/* Check whether a file still takes an operation, closes are queued for failed files too */
+static int Uring_needs(
+    struct UringRequest *request,
+    int opcode
+)
+{
+    switch (opcode)
+    {
+    case IORING_OP_OPENAT:
+        return !request->file->failed;
+
+    case IORING_OP_CLOSE:
+        return request->fd >= 0;
+
+    case IORING_OP_READ:
+    case IORING_OP_WRITE:
+        return request->fd >= 0 && !request->file->failed && request->file->length > 0;
+    }
+
+    return request->fd >= 0 && !request->file->failed;
+}
+
+/* Run one operation on every file of a group that still needs it */
+static int Uring_step(
+    struct Uring *uring, 
+    struct UringRequest *requests,
+    int count,
+    int opcode
+)
+{
+    int id;
+    int queued;
+
+    queued = 0;
+    for (id = 0; id < count; id++)
+    {
+        if (Uring_needs(&requests[id], opcode))
+        {
+            Uring_queue(uring, &requests[id], opcode);
+            queued++;
+        }
+    }
+
+    return Uring_complete(uring, queued, opcode);
+}
+
+/* Transfer a batch of files through io_uring, FALSE if io_uring is unusable.
+   Files are opened, sized, transferred and closed in one ring step each for a
+   group of files, a file whose step fails is retried with stdio by the caller */
+static int uring_transfer(
+    struct BatchFile *files, 
+    int count,
+    int writing
+)
+{
+    struct Uring uring;
+    struct UringRequest *requests;
+    int first;
+    int group;
+    int id;
+    int usable;
+
+    if (uring_disabled || !Uring_init(&uring))
+    {
+        return FALSE;
+    }
+
+    STATS_COUNT(allocations);
+    requests = malloc(URING_QUEUE_DEPTH * sizeof(struct UringRequest));
+    usable = TRUE;
+    for (first = 0; first < count; first += URING_QUEUE_DEPTH)
+    {
+        group = count - first < URING_QUEUE_DEPTH ? count - first : URING_QUEUE_DEPTH;
+        for (id = 0; id < group; id++)
+        {
+            requests[id].file = &files[first + id];
+            requests[id].flags = writing ? O_WRONLY | O_CREAT | O_TRUNC : O_RDONLY;
+            requests[id].fd = -1;
+            requests[id].done = 0;
+            files[first + id].failed = !usable; /* A failed ring leaves the rest to stdio */
+        }
+
+        usable = usable && Uring_step(&uring, requests, group, IORING_OP_OPENAT);
+        if (!writing)
+        {
+            usable = usable && Uring_step(&uring, requests, group, IORING_OP_STATX);
+        }
+        usable = usable && Uring_step(&uring, requests, group, writing ? IORING_OP_WRITE : IORING_OP_READ);
+        usable = usable && Uring_step(&uring, requests, group, IORING_OP_CLOSE);
+
+        for (id = 0; id < group; id++)
+        {
+            if (requests[id].fd >= 0)
+            {
+                files[first + id].failed = TRUE; /* Step skipped on a failed ring */
+                close(requests[id].fd);
+            }
+            if (uring.unsettled && !writing)
+            {
+                files[first + id].data = NULL; /* May still be written, so never freed */
+            }
+            else if (!writing && files[first + id].data != NULL)
+            {
+                files[first + id].data[files[first + id].length] = '\0';
+            }
+        }
+    }
+
+    if (!uring.unsettled)
+    {
+        free(requests); /* Otherwise the kernel may still write to them */
+    }
+    Uring_free(&uring);
+    return TRUE;
+}
+
+#else
+
+static int uring_transfer(
+    struct BatchFile *files, 
+    int count,
+    int writing
+)
+{
+    return FALSE; /* No io_uring on this platform */
+}
+
+#endif
+
+int batch_read_files(
+    struct BatchFile *files, 
+    int count
+)
+{
+    int id;
+    int backend;
+
+    for (id = 0; id < count; id++)
+    {
+        files[id].data = NULL; /* Nothing read yet */
+        files[id].length = 0;
+    }
+
+    backend = BATCH_IO_STDIO;
+    if (uring_transfer(files, count, FALSE))
+    {
+        backend = BATCH_IO_URING;
+    }
+
+    for (id = 0; id < count; id++)
+    {
+        if (backend == BATCH_IO_STDIO || files[id].failed)
+        {
+            free(files[id].data);
+            stdio_read_file(&files[id]); /* Fall back to stdio for this file */
+        }
+    }
+
+    return backend;
+}
+
+int batch_write_files(
+    struct BatchFile *files, 
+    int count
+)
+{
+    int id;
+    int backend;
+
+    backend = BATCH_IO_STDIO;
+    if (uring_transfer(files, count, TRUE))
+    {
+        backend = BATCH_IO_URING;
+    }
+
+    for (id = 0; id < count; id++)
+    {
+        if (backend == BATCH_IO_STDIO || files[id].failed)
+        {
+            stdio_write_file(&files[id]); /* Fall back to stdio for this file */
+        }
+    }
+
+    return backend;
+}
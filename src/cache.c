@@ -0,0 +1,351 @@
+#define _POSIX_C_SOURCE 200809L
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include "cache.h"
+#include "stats.h"
+
+#define CACHE_COPY_BLOCK (4096) /* Bytes copied at once */
+#define CACHE_TOTAL_OUTPUTS (5) /* Output files kept per unit */
+#define CACHE_TOTAL_FILES (6) /* Outputs and the source kept per unit */
+#define CACHE_RELOCATIONS (4) /* Index of the relocation table */
+#define CACHE_SOURCE (5) /* Index of the source */
+
+static const char *cache_outputs[] = {
+    ".am",
+    ".ob",
+    ".ent",
+    ".ext",
+    ".rel",
+    ".as"};
+
+/* Structure for one cache entry seen during eviction */
+struct CacheEntry
+{
+    char name[CACHE_KEY_LEN]; /* Entry directory name */
+    time_t used; /* Last time the entry was stored or restored */
+    long size; /* Bytes used by the entry */
+};
+
+static unsigned long mix_lane(
+    unsigned long lane, 
+    unsigned long byte
+)
+{
+    lane = ((lane + byte) * 2654435761UL) & 0xFFFFFFFFUL;
+    return ((lane << 13) | (lane >> 19)) & 0xFFFFFFFFUL; /* Spread the high bits down */
+}
+
+void cache_key(
+    const char *data, 
+    size_t length, 
+    const char *signature, 
+    char *key
+)
+{
+    unsigned long low;
+    unsigned long high;
+    size_t id;
+    const char *version;
+
+    /*
+     * A 32 bit FNV-1a lane and a multiply-rotate lane with its own seed and
+     * multiplier, so a collision in one lane says nothing about the other.
+     * A hit is still checked against the stored source by cache_restore.
+     */
+    low = 2166136261UL;
+    high = 3735928559UL;
+    for (version = ASSEMBLER_VERSION; *version != '\0'; version++)
+    {
+        low = ((low ^ (unsigned char)*version) * 16777619UL) & 0xFFFFFFFFUL;
+        high = mix_lane(high, (unsigned char)*version);
+    }
+    for (; *signature != '\0'; signature++)
+    {
+        low = ((low ^ (unsigned char)*signature) * 16777619UL) & 0xFFFFFFFFUL;
+        high = mix_lane(high, (unsigned char)*signature);
+    }
+    for (id = 0; id < length; id++)
+    {
+        low = ((low ^ (unsigned char)data[id]) * 16777619UL) & 0xFFFFFFFFUL;
+        high = mix_lane(high, (unsigned char)data[id]);
+    }
+    high = mix_lane(high, 0);
+
+    sprintf(key, "%08lx%08lx-%lx", low, high, (unsigned long)length);
+}
+
+static int copy_file(
+    const char *source, 
+    const char *target
+)
+{
+    FILE *input;
+    FILE *output;
+    char block[CACHE_COPY_BLOCK];
+    size_t length;
+    int copied;
+
+    input = fopen(source, "rb");
+    if (input == NULL)
+    {
+        return FALSE;
+    }
+
+    output = fopen(target, "wb");
+    if (output == NULL)
+    {
+        fclose(input);
+        return FALSE;
+    }
+
+    copied = TRUE;
+    while ((length = fread(block, 1, sizeof(block), input)) > 0)
+    {
+        if (fwrite(block, 1, length, output) != length)
+        {
+            copied = FALSE;
+            break;
+        }
+    }
+
+    fclose(input);
+    copied = (fclose(output) == 0) && copied;
+    return copied;
+}
+
+static int same_source(
+    const char *path, 
+    const char *data, 
+    size_t length
+)
+{
+    FILE *stored;
+    char block[CACHE_COPY_BLOCK];
+    size_t offset;
+    size_t read_length;
+    int same;
+
+    stored = fopen(path, "rb");
+    if (stored == NULL)
+    {
+        return FALSE;
+    }
+
+    same = TRUE;
+    offset = 0;
+    while (same && (read_length = fread(block, 1, sizeof(block), stored)) > 0)
+    {
+        same = read_length <= length - offset && memcmp(block, &data[offset], read_length) == 0;
+        offset += read_length;
+    }
+
+    fclose(stored);
+    return same && offset == length;
+}
+
+static int produces_output(
+    const struct BuildCache *cache, 
+    int id
+)
+{
+    return id != CACHE_RELOCATIONS || cache->relocations;
+}
+
+static void entry_path(
+    char *path, 
+    const struct BuildCache *cache, 
+    const char *entry, 
+    const char *extension
+)
+{
+    sprintf(path, "%s/%s/unit%s", cache->directory, entry, extension);
+}
+
+int cache_restore(
+    const struct BuildCache *cache, 
+    const char *key, 
+    const char *name, 
+    const char *data, 
+    size_t length
+)
+{
+    char source[MAX_PATH_LEN];
+    char target[MAX_PATH_LEN];
+    struct stat status;
+    int id;
+
+    /* An entry always holds the object file */
+    entry_path(source, cache, key, ".ob");
+    if (stat(source, &status) != 0)
+    {
+        return FALSE;
+    }
+
+    /* Equal keys are not proof of an equal source */
+    entry_path(source, cache, key, cache_outputs[CACHE_SOURCE]);
+    if (!same_source(source, data, length))
+    {
+        return FALSE;
+    }
+
+    for (id = 0; id < CACHE_TOTAL_OUTPUTS; id++)
+    {
+        if (!produces_output(cache, id))
+        {
+            continue; /* Left as it is, like a normal assembly does */
+        }
+
+        entry_path(source, cache, key, cache_outputs[id]);
+        sprintf(target, "%s%s", name, cache_outputs[id]);
+        if (stat(source, &status) != 0)
+        {
+            remove(target); /* The unit had no such output */
+            continue;
+        }
+        if (!copy_file(source, target))
+        {
+            return FALSE; /* Assemble normally instead */
+        }
+        STATS_ADD(bytes_written[id], status.st_size);
+    }
+
+    sprintf(source, "%s/%s", cache->directory, key);
+    utime(source, NULL); /* Mark the entry as recently used */
+    return TRUE;
+}
+
+void cache_store(
+    const struct BuildCache *cache, 
+    const char *key, 
+    const char *name
+)
+{
+    char staging[CACHE_KEY_LEN + 32];
+    char source[MAX_PATH_LEN];
+    char target[MAX_PATH_LEN];
+    int id;
+
+    mkdir(cache->directory, 0777); /* Create the cache on first use */
+
+    /* Fill a private directory, then publish it under the key at once */
+    sprintf(staging, "tmp-%ld-%s", (long)getpid(), key);
+    sprintf(target, "%s/%s", cache->directory, staging);
+    if (mkdir(target, 0777) != 0)
+    {
+        return;
+    }
+
+    for (id = 0; id < CACHE_TOTAL_FILES; id++)
+    {
+        if (!produces_output(cache, id))
+        {
+            continue; /* A stale table from an earlier run */
+        }
+
+        sprintf(source, "%s%s", name, cache_outputs[id]);
+        entry_path(target, cache, staging, cache_outputs[id]);
+        copy_file(source, target); /* Missing outputs stay missing */
+    }
+
+    sprintf(source, "%s/%s", cache->directory, staging);
+    sprintf(target, "%s/%s", cache->directory, key);
+    if (rename(source, target) != 0)
+    {
+        for (id = 0; id < CACHE_TOTAL_FILES; id++)
+        {
+            entry_path(target, cache, staging, cache_outputs[id]);
+            remove(target); /* Another run stored the same entry */
+        }
+        rmdir(source);
+    }
+}
+
+static int compare_entries(const void *a, const void *b)
+{
+    const struct CacheEntry *first = a;
+    const struct CacheEntry *second = b;
+
+    return (first->used > second->used) - (first->used < second->used);
+}
+
+void cache_evict(const struct BuildCache *cache)
+{
+    DIR *directory;
+    struct dirent *item;
+    struct stat status;
+    struct CacheEntry *entries;
+    char path[MAX_PATH_LEN];
+    long total_size;
+    int total_entries;
+    int max_entries;
+    int id;
+    int output;
+
+    directory = opendir(cache->directory);
+    if (directory == NULL)
+    {
+        return;
+    }
+
+    entries = NULL;
+    total_entries = 0;
+    max_entries = 0;
+    total_size = 0;
+
+    while ((item = readdir(directory)) != NULL)
+    {
+        if (item->d_name[0] == '.' || strlen(item->d_name) >= CACHE_KEY_LEN)
+        {
+            continue; /* Not an entry */
+        }
+
+        if (total_entries == max_entries)
+        {
+            max_entries += MEMORY_BLOCK_SIZE; /* Increase entries limit */
+            STATS_COUNT(allocations);
+            entries = realloc(entries, sizeof(*entries) * max_entries);
+        }
+
+        strcpy(entries[total_entries].name, item->d_name);
+        sprintf(path, "%s/%s", cache->directory, entries[total_entries].name);
+        if (stat(path, &status) != 0 || !S_ISDIR(status.st_mode))
+        {
+            continue;
+        }
+
+        entries[total_entries].used = status.st_mtime;
+        entries[total_entries].size = 0;
+        for (output = 0; output < CACHE_TOTAL_FILES; output++)
+        {
+            entry_path(path, cache, entries[total_entries].name, cache_outputs[output]);
+            if (stat(path, &status) == 0)
+            {
+                entries[total_entries].size += status.st_size;
+            }
+        }
+        total_size += entries[total_entries].size;
+        total_entries++;
+    }
+    closedir(directory);
+
+    /* Oldest entries go first */
+    qsort(entries, total_entries, sizeof(*entries), compare_entries);
+    for (id = 0; id < total_entries && total_size > cache->size_limit; id++)
+    {
+        for (output = 0; output < CACHE_TOTAL_FILES; output++)
+        {
+            entry_path(path, cache, entries[id].name, cache_outputs[output]);
+            remove(path);
+        }
+        sprintf(path, "%s/%s", cache->directory, entries[id].name);
+        rmdir(path);
+        total_size -= entries[id].size;
+    }
+
+    free(entries);
+}
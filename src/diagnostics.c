@@ -0,0 +1,144 @@
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+#include "diagnostics.h"
+#include "stats.h"
+
+#define DIAG_LINE_LEN (2 * TOTAL_LEN) /* Longest formatted diagnostic */
+
+/* Message of each code, %s takes the argument */
+static const char *diagnostic_messages[] = {
+    "duplicate labels defined \"%s\"",
+    "invalid syntax detected",
+    "duplicate macro name definition \"%s\"",
+    "invalid macro parameters \"%s\"",
+    "macro library may only define macros",
+    "invalid include file name \"%s\"",
+    "cannot include macro library \"%s\"",
+    "wrong arguments for macro \"%s\"",
+    "recursive macro call \"%s\"",
+    "\"endmacro keyword\" is outside the macro",
+    "undefined macro usage \"%s\"",
+    "undefined entry label \"%s\"",
+    "duplicate constant definition \"%s\"",
+    "invalid expression \"%s\"",
+    "undefined label with offset \"%s\"",
+    "macro expansion line is too long \"%s\"",
+    "program does not fit the address space from base \"%s\""};
+
+/* Initialize a DiagnosticBuffer */
+void Diagnostics_init(
+    struct DiagnosticBuffer *buffer, 
+    FILE *output
+)
+{
+    buffer->output = output;
+    buffer->items = NULL; /* No diagnostics yet */
+    buffer->count = 0;
+    buffer->limit = 0;
+    buffer->text = NULL; /* No argument text yet */
+    buffer->text_length = 0;
+    buffer->text_limit = 0;
+    buffer->reported = 0;
+}
+
+/* Free memory used by a DiagnosticBuffer */
+void Diagnostics_free(struct DiagnosticBuffer *buffer)
+{
+    free(buffer->items); /* Free diagnostics array */
+    free(buffer->text); /* Free argument text */
+}
+
+/* Record a diagnostic */
+void Diagnostics_add(
+    struct DiagnosticBuffer *buffer, 
+    int line,
+    int column,
+    int code,
+    const char *argument
+)
+{
+    struct Diagnostic *item;
+    int length;
+
+    if (buffer->count == buffer->limit)
+    {
+        buffer->limit += MEMORY_BLOCK_SIZE * MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        buffer->items = realloc(buffer->items, sizeof(*buffer->items) * buffer->limit);
+    }
+
+    item = &buffer->items[buffer->count];
+    item->line = line;
+    item->column = column;
+    item->code = code;
+    item->argument = -1;
+
+    if (argument != NULL)
+    {
+        length = strlen(argument) + 1;
+        while (buffer->text_length + length > buffer->text_limit)
+        {
+            buffer->text_limit += MEMORY_BLOCK_SIZE * TOTAL_LEN; /* Increase text limit */
+            STATS_COUNT(allocations);
+            buffer->text = realloc(buffer->text, buffer->text_limit);
+        }
+        item->argument = buffer->text_length;
+        memcpy(&buffer->text[buffer->text_length], argument, length); /* Copy the argument */
+        buffer->text_length += length;
+    }
+
+    buffer->count++;
+    buffer->reported++;
+
+    if (buffer->count == DIAG_FLUSH_COUNT)
+    {
+        Diagnostics_flush(buffer); /* Keep memory bounded on runaway inputs */
+    }
+}
+
+/* Format and print every pending diagnostic at once */
+void Diagnostics_flush(struct DiagnosticBuffer *buffer)
+{
+    char *report;
+    char *target;
+    char message[DIAG_LINE_LEN];
+    const struct Diagnostic *item;
+    int id;
+
+    if (buffer->count == 0)
+    {
+        return; /* Nothing to print */
+    }
+
+    STATS_COUNT(allocations);
+    report = malloc((size_t)buffer->count * DIAG_LINE_LEN); /* Room for every line */
+    target = report;
+    for (id = 0; id < buffer->count; id++)
+    {
+        item = &buffer->items[id];
+        sprintf(
+            message,
+            diagnostic_messages[item->code],
+            item->argument < 0 ? "" : &buffer->text[item->argument]);
+        if (item->column == DIAG_NO_COLUMN)
+        {
+            target += sprintf(target, "There is an error in line number%d: %s\n", item->line, message);
+        }
+        else
+        {
+            target += sprintf(
+                target,
+                "There is an error in line number%d, column %d: %s\n",
+                item->line,
+                item->column,
+                message);
+        }
+    }
+
+    fwrite(report, 1, target - report, buffer->output); /* One write for the whole batch */
+    free(report);
+
+    buffer->count = 0;
+    buffer->text_length = 0;
+}
@@ -0,0 +1,230 @@
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+#include "expression.h"
+#include "stats.h"
+
+/*
+ * Operators from lowest to highest precedence are |, <<, + and - and
+ * then *, a leading + or - applies to a single operand. Expressions are
+ * single tokens, so they are written without spaces.
+ */
+
+/* Structure for the state of one evaluation */
+struct Expression
+{
+    const char *at; /* Next character */
+    const struct ConstantTable *constants; /* Values of defined names */
+    int valid; /* FALSE once an error was found */
+    int uses_constants; /* TRUE once a name was read */
+};
+
+static unsigned long parse_or(struct Expression *expression);
+
+/* Initialize a ConstantTable */
+void ConstantTable_init(struct ConstantTable *table)
+{
+    HashTable_init(&table->index);
+    table->values = NULL; /* No constants yet */
+    table->count = 0;
+    table->limit = 0;
+}
+
+/* Free memory used by a ConstantTable */
+void ConstantTable_free(struct ConstantTable *table)
+{
+    HashTable_free(&table->index);
+    free(table->values);
+}
+
+/* Define a new constant */
+int ConstantTable_define(
+    struct ConstantTable *table,
+    const char *name,
+    int value
+)
+{
+    if (!HashTable_insert(&table->index, name, table->count))
+    {
+        return FALSE; /* Constant already exists */
+    }
+
+    if (table->count == table->limit)
+    {
+        table->limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        table->values = realloc(table->values, sizeof(*table->values) * table->limit);
+    }
+    table->values[table->count] = value;
+    table->count++;
+    return TRUE;
+}
+
+static int is_name_start(char letter)
+{
+    return isalpha((unsigned char)letter) || letter == '_';
+}
+
+static int is_name_letter(char letter)
+{
+    return isalnum((unsigned char)letter) || letter == '_';
+}
+
+int expression_is_name(const char *word)
+{
+    if (!is_name_start(*word))
+    {
+        return FALSE;
+    }
+    while (is_name_letter(*word))
+    {
+        word++;
+    }
+    return *word == '\0';
+}
+
+static unsigned long parse_operand(struct Expression *expression)
+{
+    char name[TOTAL_LEN];
+    unsigned long value;
+    int length;
+    int found;
+
+    if (*expression->at == '-')
+    {
+        expression->at++;
+        return 0UL - parse_operand(expression);
+    }
+    if (*expression->at == '+')
+    {
+        expression->at++;
+        return parse_operand(expression);
+    }
+
+    if (isdigit((unsigned char)*expression->at))
+    {
+        value = 0;
+        while (isdigit((unsigned char)*expression->at))
+        {
+            value = value * 10 + (*expression->at - '0');
+            expression->at++;
+        }
+        return value;
+    }
+
+    for (length = 0; is_name_letter(expression->at[length]) && length < TOTAL_LEN - 1; length++)
+    {
+        name[length] = expression->at[length];
+    }
+    name[length] = '\0';
+
+    found = length > 0 ? HashTable_find(&expression->constants->index, name) : -1;
+    if (found < 0)
+    {
+        expression->valid = FALSE; /* Neither a number nor a defined constant */
+        return 0;
+    }
+    expression->at += length;
+    expression->uses_constants = TRUE;
+    return (unsigned long)(long)expression->constants->values[found];
+}
+
+static unsigned long parse_product(struct Expression *expression)
+{
+    unsigned long value;
+
+    value = parse_operand(expression);
+    while (expression->valid && *expression->at == '*')
+    {
+        expression->at++;
+        value *= parse_operand(expression);
+    }
+    return value;
+}
+
+static unsigned long parse_sum(struct Expression *expression)
+{
+    unsigned long value;
+
+    value = parse_product(expression);
+    while (expression->valid && (*expression->at == '+' || *expression->at == '-'))
+    {
+        if (*expression->at == '+')
+        {
+            expression->at++;
+            value += parse_product(expression);
+        }
+        else
+        {
+            expression->at++;
+            value -= parse_product(expression);
+        }
+    }
+    return value;
+}
+
+static unsigned long parse_shift(struct Expression *expression)
+{
+    unsigned long value;
+    unsigned long shift;
+
+    value = parse_sum(expression);
+    while (expression->valid && expression->at[0] == '<' && expression->at[1] == '<')
+    {
+        expression->at += 2;
+        shift = parse_sum(expression);
+        if (shift > EXPRESSION_MAX_SHIFT)
+        {
+            expression->valid = FALSE; /* Also catches negative shifts */
+            return 0;
+        }
+        value <<= shift;
+    }
+    return value;
+}
+
+static unsigned long parse_or(struct Expression *expression)
+{
+    unsigned long value;
+
+    value = parse_shift(expression);
+    while (expression->valid && *expression->at == '|')
+    {
+        expression->at++;
+        value |= parse_shift(expression);
+    }
+    return value;
+}
+
+/* Fold an expression */
+int expression_evaluate(
+    const char *text,
+    const struct ConstantTable *constants,
+    int *value,
+    int *uses_constants
+)
+{
+    struct Expression expression;
+    unsigned long result;
+
+    expression.at = text;
+    expression.constants = constants;
+    expression.valid = TRUE;
+    expression.uses_constants = FALSE;
+
+    result = parse_or(&expression);
+    *uses_constants = expression.uses_constants;
+    if (!expression.valid || *expression.at != '\0')
+    {
+        return FALSE;
+    }
+
+    /* Wrap like the words the value ends up in, without overflowing an int */
+    *value = (int)(result & 0xFFFF);
+    if (*value & 0x8000)
+    {
+        *value -= 0x10000;
+    }
+    return TRUE;
+}
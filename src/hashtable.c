@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+#include "hashtable.h"
+#include "stats.h"
+
+#define HASH_INITIAL_SLOTS (64) /* Slots allocated on first insert */
+
+static unsigned long hash_key(const char *key)
+{
+    unsigned long hash;
+
+    hash = 2166136261UL; /* FNV-1a offset basis */
+    while (*key != '\0')
+    {
+        hash = (hash ^ (unsigned char)*key) * 16777619UL;
+        key++;
+    }
+
+    return hash;
+}
+
+/* Initialize a HashTable */
+void HashTable_init(struct HashTable *table)
+{
+    table->slots = NULL; /* No slots yet */
+    table->mask = 0;
+    table->count = 0; /* Count is zero */
+}
+
+/* Free memory used by a HashTable */
+void HashTable_free(struct HashTable *table)
+{
+    unsigned long id;
+
+    for (id = 0; table->slots != NULL && id <= table->mask; id++)
+    {
+        free(table->slots[id].key); /* Free each key */
+    }
+    free(table->slots); /* Free the slot array */
+}
+
+/* Find the slot of a key, or the free slot where it belongs */
+static struct HashSlot *HashTable_slot(
+    const struct HashTable *table, 
+    const char *key,
+    unsigned long hash
+)
+{
+    unsigned long id;
+    struct HashSlot *slot;
+
+    id = hash & table->mask;
+    while (TRUE)
+    {
+        STATS_COUNT(symbol_probes);
+        slot = &table->slots[id];
+        if (slot->key == NULL)
+        {
+            return slot; /* Key is not in the table */
+        }
+        if (slot->hash == hash && strcmp(slot->key, key) == 0)
+        {
+            return slot; /* Found the key */
+        }
+        id = (id + 1) & table->mask; /* Linear probing */
+    }
+}
+
+/* Double the slot array and move every key */
+static void HashTable_grow(struct HashTable *table)
+{
+    struct HashSlot *old_slots;
+    unsigned long old_size;
+    unsigned long id;
+    struct HashSlot *slot;
+
+    old_slots = table->slots;
+    old_size = old_slots == NULL ? 0 : table->mask + 1;
+
+    table->mask = old_size == 0 ? HASH_INITIAL_SLOTS - 1 : old_size * 2 - 1;
+    STATS_COUNT(allocations);
+    table->slots = calloc(table->mask + 1, sizeof(*table->slots)); /* All slots free */
+
+    for (id = 0; id < old_size; id++)
+    {
+        if (old_slots[id].key != NULL)
+        {
+            slot = HashTable_slot(table, old_slots[id].key, old_slots[id].hash);
+            *slot = old_slots[id];
+        }
+    }
+    free(old_slots);
+}
+
+/* Find the value stored under a key */
+int HashTable_find(
+    const struct HashTable *table, 
+    const char *key
+)
+{
+    struct HashSlot *slot;
+
+    if (table->count == 0)
+    {
+        return (-1); /* Empty table */
+    }
+
+    slot = HashTable_slot(table, key, hash_key(key));
+    return slot->key == NULL ? (-1) : slot->value;
+}
+
+/* Store a value under a new key */
+int HashTable_insert(
+    struct HashTable *table, 
+    const char *key,
+    int value
+)
+{
+    unsigned long hash;
+    struct HashSlot *slot;
+
+    /* Keep the table at most half full */
+    if (table->slots == NULL || (unsigned long)(table->count + 1) * 2 > table->mask + 1)
+    {
+        HashTable_grow(table);
+    }
+
+    hash = hash_key(key);
+    slot = HashTable_slot(table, key, hash);
+    if (slot->key != NULL)
+    {
+        return FALSE; /* Key already exists */
+    }
+
+    STATS_COUNT(allocations);
+    slot->key = malloc(strlen(key) + 1); /* Allocate memory for the key */
+    strcpy(slot->key, key); /* Copy the key */
+    slot->hash = hash;
+    slot->value = value;
+    table->count++; /* Increment count */
+    return TRUE;
+}
@@ -0,0 +1,279 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+#include "incremental.h"
+#include "stats.h"
+
+#define STATE_MAGIC "ASMSTATE" /* First word of a state file */
+
+static char *copy_text(const char *text)
+{
+    char *copy;
+
+    STATS_COUNT(allocations);
+    copy = malloc(strlen(text) + 1); /* Allocate memory for the copy */
+    strcpy(copy, text); /* Copy the text */
+    return copy;
+}
+
+/* Initialize a LineCache */
+void LineCache_init(struct LineCache *cache)
+{
+    cache->records = NULL; /* No records yet */
+    cache->record_count = 0; /* Count is zero */
+    cache->record_limit = 0; /* Limit is zero */
+    HashTable_init(&cache->index);
+}
+
+/* Free memory used by a LineCache */
+void LineCache_free(struct LineCache *cache)
+{
+    int id;
+    int item;
+    struct LineRecord *record;
+
+    for (id = 0; id < cache->record_count; id++)
+    {
+        record = &cache->records[id];
+        free(record->text);
+        for (item = 0; item < record->label_count; item++)
+        {
+            free(record->labels[item]); /* Free each label */
+        }
+        for (item = 0; item < record->word_count; item++)
+        {
+            free(record->symbols[item]); /* Free each symbol */
+        }
+        free(record->labels);
+        free(record->entry);
+        free(record->words);
+        free(record->symbols);
+    }
+    free(cache->records); /* Free records array */
+    HashTable_free(&cache->index);
+}
+
+/* Find the record of a statement */
+struct LineRecord *LineCache_find(
+    struct LineCache *cache, 
+    const char *text
+)
+{
+    int id;
+
+    id = HashTable_find(&cache->index, text);
+    return id < 0 ? NULL : &cache->records[id];
+}
+
+/* Add an empty record for a new statement */
+struct LineRecord *LineCache_add(
+    struct LineCache *cache, 
+    const char *text
+)
+{
+    struct LineRecord *record;
+
+    if (cache->record_count == cache->record_limit)
+    {
+        cache->record_limit += MEMORY_BLOCK_SIZE * MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        cache->records = realloc(
+            cache->records,
+            sizeof(*cache->records) * cache->record_limit); /* Reallocate memory */
+    }
+
+    record = &cache->records[cache->record_count];
+    memset(record, 0, sizeof(*record)); /* No labels, entry or words yet */
+    record->text = copy_text(text);
+    record->used = TRUE;
+    HashTable_insert(&cache->index, text, cache->record_count);
+    cache->record_count++; /* Increment count */
+    return record;
+}
+
+/* Add a label defined by a statement */
+void LineRecord_add_label(
+    struct LineRecord *record, 
+    const char *name
+)
+{
+    STATS_COUNT(allocations);
+    record->labels = realloc(
+        record->labels,
+        sizeof(*record->labels) * (record->label_count + 1)); /* Grow labels array */
+    record->labels[record->label_count] = copy_text(name);
+    record->label_count++;
+}
+
+/* Set the name exported by a statement */
+void LineRecord_set_entry(
+    struct LineRecord *record, 
+    const char *name
+)
+{
+    free(record->entry);
+    record->entry = copy_text(name);
+}
+
+/* Add an encoded word */
+void LineRecord_add_word(
+    struct LineRecord *record, 
+    int value,
+    const char *symbol
+)
+{
+    if (record->word_count == record->word_limit)
+    {
+        record->word_limit += MEMORY_BLOCK_SIZE; /* Increase word limit */
+        STATS_COUNT(allocations);
+        record->words = realloc(record->words, sizeof(*record->words) * record->word_limit);
+        STATS_COUNT(allocations);
+        record->symbols = realloc(record->symbols, sizeof(*record->symbols) * record->word_limit);
+    }
+
+    record->words[record->word_count] = value;
+    record->symbols[record->word_count] = symbol == NULL ? NULL : copy_text(symbol);
+    record->word_count++;
+}
+
+/* Load records saved by a previous run */
+int LineCache_load(
+    struct LineCache *cache, 
+    const char *path
+)
+{
+    FILE *state;
+    char magic[TOTAL_LEN];
+    char version[TOTAL_LEN];
+    char name[TOTAL_LEN];
+    char text[TOTAL_LEN];
+    struct LineRecord *record;
+    int total_records;
+    int length;
+    int count;
+    int value;
+    int id;
+    int item;
+
+    state = fopen(path, "rb");
+    if (state == NULL)
+    {
+        return FALSE;
+    }
+
+    /* State of another assembler version is ignored */
+    if (fscanf(state, "%255s %255s %d", magic, version, &total_records) != 3 ||
+        strcmp(magic, STATE_MAGIC) != 0 ||
+        strcmp(version, ASSEMBLER_VERSION) != 0)
+    {
+        fclose(state);
+        return FALSE;
+    }
+
+    for (id = 0; id < total_records; id++)
+    {
+        /* Statement text is stored with its length, it may hold spaces */
+        if (fscanf(state, "%d", &length) != 1 || length < 0 || length >= TOTAL_LEN ||
+            fgetc(state) != '\n' || fread(text, 1, length, state) != (size_t)length)
+        {
+            break;
+        }
+        text[length] = '\0';
+
+        record = LineCache_add(cache, text);
+        record->used = FALSE;
+        if (fscanf(state, "%d %d %d %d", &record->code_size, &record->data_size, &record->encoded, &count) != 4)
+        {
+            break;
+        }
+        for (item = 0; item < count && fscanf(state, "%255s", name) == 1; item++)
+        {
+            LineRecord_add_label(record, name);
+        }
+        if (fscanf(state, "%d", &count) == 1 && count == 1 && fscanf(state, "%255s", name) == 1)
+        {
+            LineRecord_set_entry(record, name);
+        }
+        if (fscanf(state, "%d", &count) != 1)
+        {
+            break;
+        }
+        for (item = 0; item < count && fscanf(state, "%d %255s", &value, name) == 2; item++)
+        {
+            LineRecord_add_word(record, value, strcmp(name, LINE_NO_SYMBOL) == 0 ? NULL : name);
+        }
+    }
+
+    fclose(state);
+    return TRUE;
+}
+
+/* Save the records used by the current run */
+int LineCache_save(
+    const struct LineCache *cache, 
+    const char *path
+)
+{
+    FILE *state;
+    const struct LineRecord *record;
+    int total_records;
+    int id;
+    int item;
+
+    state = fopen(path, "wb");
+    if (state == NULL)
+    {
+        return FALSE;
+    }
+
+    total_records = 0;
+    for (id = 0; id < cache->record_count; id++)
+    {
+        total_records += cache->records[id].used && !cache->records[id].failed;
+    }
+
+    fprintf(state, "%s %s %d\n", STATE_MAGIC, ASSEMBLER_VERSION, total_records);
+    for (id = 0; id < cache->record_count; id++)
+    {
+        record = &cache->records[id];
+        if (!record->used || record->failed)
+        {
+            continue; /* Statement is gone from the source or must be assembled again */
+        }
+
+        fprintf(state, "%d\n", (int)strlen(record->text));
+        fputs(record->text, state);
+        fprintf(
+            state,
+            "%d %d %d %d",
+            record->code_size,
+            record->data_size,
+            record->encoded,
+            record->label_count);
+        for (item = 0; item < record->label_count; item++)
+        {
+            fprintf(state, " %s", record->labels[item]);
+        }
+        if (record->entry != NULL)
+        {
+            fprintf(state, " 1 %s", record->entry);
+        }
+        else
+        {
+            fprintf(state, " 0");
+        }
+        fprintf(state, " %d", record->word_count);
+        for (item = 0; item < record->word_count; item++)
+        {
+            fprintf(
+                state,
+                " %d %s",
+                record->words[item],
+                record->symbols[item] == NULL ? LINE_NO_SYMBOL : record->symbols[item]);
+        }
+        fprintf(state, "\n");
+    }
+
+    return fclose(state) == 0;
+}
@@ -0,0 +1,124 @@
+#include "definitions.h"
+#include "isa.h"
+
+const struct instruction valid_commands_sizes[] = {
+    {"mov", 0, 2},
+    {"cmp", 1, 2},
+    {"add", 2, 2},
+    {"sub", 3, 2},
+    {"lea", 4, 2},
+    {"clr", 5, 1},
+    {"not", 6, 1},
+    {"inc", 7, 1},
+    {"dec", 8, 1},
+    {"jmp", 9, 1},
+    {"bne", 10, 1},
+    {"red", 11, 1},
+    {"prn", 12, 1},
+    {"jsr", 13, 1},
+    {"rts", 14, 0},
+    {"stop", 15, 0}};
+
+static int single_group(int group)
+{
+    return group == IMMEDIATE_GROUP_OPERAND || group == DIR_GROUP_OPERAND ||
+           group == INDIR_GROUP_OPERAND || group == REGISTER_GROUP_OPERAND;
+}
+
+static int register_group(int group)
+{
+    return group == INDIR_GROUP_OPERAND || group == REGISTER_GROUP_OPERAND;
+}
+
+/* Decode one operand word, FALSE if its flags do not fit the group */
+static int decode_operand(
+    int word,
+    int group,
+    int register_shift,
+    int *operand,
+    int *flags
+)
+{
+    *flags = word & ISA_FLAGS_MASK;
+    switch (group)
+    {
+    case IMMEDIATE_GROUP_OPERAND:
+    {
+        *operand = (word >> ISA_VALUE_SHIFT) & ISA_VALUE_MASK;
+        if (*operand & ISA_VALUE_SIGN_BIT)
+        {
+            *operand -= ISA_VALUE_SIGN_BIT << 1; /* Negative value */
+        }
+        return *flags == ABSOLUTE_FLAG;
+    }
+    case DIR_GROUP_OPERAND:
+    {
+        *operand = (word >> ISA_VALUE_SHIFT) & ISA_VALUE_MASK;
+        return *flags == RELOCATABLE_FLAG || *flags == EXTERNAL_FLAG;
+    }
+    default:
+    {
+        *operand = (word >> register_shift) & 0x7;
+        return *flags == ABSOLUTE_FLAG;
+    }
+    }
+}
+
+/* Decode the instruction starting at words[0] */
+int isa_decode(
+    const int *words,
+    int available,
+    struct DecodedInstruction *decoded
+)
+{
+    int valid;
+
+    decoded->opcode = (words[0] >> ISA_OPCODE_SHIFT) & ISA_MODE_MASK;
+    decoded->source_group = (words[0] >> ISA_SOURCE_MODE_SHIFT) & ISA_MODE_MASK;
+    decoded->target_group = (words[0] >> ISA_TARGET_MODE_SHIFT) & ISA_MODE_MASK;
+    decoded->source = 0;
+    decoded->target = 0;
+    decoded->source_flags = 0;
+    decoded->target_flags = 0;
+
+    valid = (words[0] & ISA_FLAGS_MASK) == ABSOLUTE_FLAG;
+    switch (valid_commands_sizes[decoded->opcode].group)
+    {
+    case TWO_OPERANDS_GROUP:
+    {
+        valid = valid && single_group(decoded->source_group) && single_group(decoded->target_group);
+        if (register_group(decoded->source_group) && register_group(decoded->target_group))
+        {
+            /* Both registers share one word */
+            decoded->size = 2;
+            valid = valid && available >= decoded->size &&
+                    decode_operand(words[1], decoded->source_group, ISA_SOURCE_REGISTER_SHIFT, &decoded->source, &decoded->source_flags) &&
+                    decode_operand(words[1], decoded->target_group, ISA_TARGET_REGISTER_SHIFT, &decoded->target, &decoded->target_flags);
+        }
+        else
+        {
+            decoded->size = 3;
+            valid = valid && available >= decoded->size &&
+                    decode_operand(words[1], decoded->source_group, ISA_SOURCE_REGISTER_SHIFT, &decoded->source, &decoded->source_flags) &&
+                    decode_operand(words[2], decoded->target_group, ISA_TARGET_REGISTER_SHIFT, &decoded->target, &decoded->target_flags);
+        }
+        break;
+    }
+    case ONE_OPERAND_GROUP:
+    {
+        decoded->size = 2;
+        valid = valid && decoded->source_group == 0 && single_group(decoded->target_group) &&
+                available >= decoded->size &&
+                decode_operand(words[1], decoded->target_group, ISA_TARGET_REGISTER_SHIFT, &decoded->target, &decoded->target_flags);
+        break;
+    }
+    default:
+    {
+        decoded->size = 1;
+        valid = valid && decoded->source_group == 0 && decoded->target_group == 0;
+        break;
+    }
+    }
+
+    return valid;
+}
@@ -0,0 +1,302 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "library.h"
+#include "stats.h"
+
+#define LIBRARY_MAGIC "ASMMLIB" /* First bytes of a precompiled library */
+#define LIBRARY_ALIGN (8) /* Alignment of fragment arrays in the file */
+
+/* Structure for the start of a precompiled library */
+struct LibraryHeader
+{
+    char magic[8]; /* LIBRARY_MAGIC */
+    char version[8]; /* ASSEMBLER_VERSION of the writer */
+    int macro_count; /* Number of LibraryRecord entries that follow */
+    int fragment_size; /* sizeof(struct MacroFragment) of the writer */
+};
+
+/* Structure for one macro of a precompiled library, offsets are from the file start */
+struct LibraryRecord
+{
+    char name[TOTAL_LEN]; /* Macro name */
+    int param_count; /* Number of parameters */
+    int params_offset; /* NUL terminated parameter names */
+    int pool_offset; /* Literal pool */
+    int pool_length; /* Length of the literal pool */
+    int fragments_offset; /* Fragment array */
+    int fragment_count; /* Number of fragments */
+};
+
+static struct MacroLibrary **libraries; /* Libraries loaded in this run */
+static int total_libraries; /* Number of loaded libraries */
+static int libraries_limit; /* Allocated libraries */
+
+static long align_offset(long offset)
+{
+    return (offset + LIBRARY_ALIGN - 1) / LIBRARY_ALIGN * LIBRARY_ALIGN;
+}
+
+/* Find a library loaded earlier in this run */
+struct MacroLibrary *MacroLibrary_find(const char *path)
+{
+    int id;
+
+    for (id = 0; id < total_libraries; id++)
+    {
+        if (strcmp(libraries[id]->path, path) == 0)
+        {
+            return libraries[id]; /* Already loaded */
+        }
+    }
+
+    return NULL;
+}
+
+/* Register a new, still empty library */
+struct MacroLibrary *MacroLibrary_add(const char *path)
+{
+    struct MacroLibrary *library;
+
+    if (total_libraries == libraries_limit)
+    {
+        libraries_limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        libraries = realloc(libraries, sizeof(*libraries) * libraries_limit);
+    }
+
+    STATS_COUNT(allocations);
+    library = malloc(sizeof(*library)); /* Allocate memory for the library */
+    strcpy(library->path, path);
+    MacrosList_init(&library->macros);
+    library->map = NULL;
+    library->map_length = 0;
+    library->failed = FALSE;
+
+    libraries[total_libraries] = library;
+    total_libraries++;
+    return library;
+}
+
+/* Check if a path names a precompiled library */
+int MacroLibrary_is_precompiled(const char *path)
+{
+    size_t length;
+    size_t extension;
+
+    length = strlen(path);
+    extension = strlen(MACRO_LIBRARY_EXTENSION);
+    return length > extension && strcmp(&path[length - extension], MACRO_LIBRARY_EXTENSION) == 0;
+}
+
+/* Map a precompiled library */
+int MacroLibrary_map(struct MacroLibrary *library)
+{
+    int descriptor;
+    int id;
+    int item;
+    char *param;
+    struct stat info;
+    struct Macro *macroPtr;
+    const struct LibraryHeader *header;
+    const struct LibraryRecord *records;
+    const struct LibraryRecord *record;
+    size_t table_end;
+
+    descriptor = open(library->path, O_RDONLY);
+    if (descriptor < 0)
+    {
+        return FALSE;
+    }
+
+    if (fstat(descriptor, &info) != 0 || (size_t)info.st_size < sizeof(*header))
+    {
+        close(descriptor);
+        return FALSE;
+    }
+
+    library->map = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (library->map == MAP_FAILED)
+    {
+        library->map = NULL;
+        return FALSE;
+    }
+    library->map_length = info.st_size;
+
+    /* Libraries of another version or layout are rejected, not guessed at */
+    header = (const struct LibraryHeader *)library->map;
+    records = (const struct LibraryRecord *)(library->map + sizeof(*header));
+    if (strncmp(header->magic, LIBRARY_MAGIC, sizeof(header->magic)) != 0 ||
+        strncmp(header->version, ASSEMBLER_VERSION, sizeof(header->version)) != 0 ||
+        header->fragment_size != (int)sizeof(struct MacroFragment) ||
+        header->macro_count < 0 ||
+        sizeof(*header) + sizeof(*records) * header->macro_count > library->map_length)
+    {
+        return FALSE;
+    }
+
+    /* Every offset points past the record table, so map[pool_offset - 1] stays inside it */
+    table_end = sizeof(*header) + sizeof(*records) * header->macro_count;
+    for (id = 0; id < header->macro_count; id++)
+    {
+        record = &records[id];
+        if (record->param_count < 0 || record->pool_length < 0 || record->fragment_count < 0 ||
+            record->params_offset < 0 || record->pool_offset <= 0 || record->fragments_offset < 0 ||
+            (size_t)record->params_offset < table_end ||
+            (size_t)record->fragments_offset < table_end ||
+            record->params_offset > record->pool_offset ||
+            record->pool_offset + (size_t)record->pool_length > library->map_length ||
+            record->fragments_offset + sizeof(struct MacroFragment) * record->fragment_count > library->map_length ||
+            memchr(record->name, '\0', sizeof(record->name)) == NULL ||
+            (record->param_count > 0 && library->map[record->pool_offset - 1] != '\0'))
+        {
+            return FALSE;
+        }
+
+        macroPtr = MacrosList_register(&library->macros, record->name);
+        if (macroPtr == NULL)
+        {
+            return FALSE; /* Same name twice */
+        }
+
+        /* Bodies are used in place, only the parameter table is built */
+        STATS_COUNT(allocations);
+        macroPtr->params = malloc(sizeof(*macroPtr->params) * (record->param_count + 1));
+        param = library->map + record->params_offset;
+        for (item = 0; item < record->param_count; item++)
+        {
+            macroPtr->params[item] = param;
+            param += strlen(param) + 1;
+        }
+        macroPtr->param_count = record->param_count;
+        macroPtr->pool = library->map + record->pool_offset;
+        macroPtr->pool_length = record->pool_length;
+        macroPtr->fragments = (struct MacroFragment *)(library->map + record->fragments_offset);
+        macroPtr->fragment_count = record->fragment_count;
+        macroPtr->borrowed = TRUE;
+
+        for (item = 0; item < macroPtr->fragment_count; item++)
+        {
+            if (macroPtr->fragments[item].slot >= macroPtr->param_count ||
+                macroPtr->fragments[item].slot < NO_PARAMETER_SLOT ||
+                macroPtr->fragments[item].offset < 0 ||
+                macroPtr->fragments[item].length < 0 ||
+                macroPtr->fragments[item].offset + macroPtr->fragments[item].length > macroPtr->pool_length)
+            {
+                return FALSE; /* Template points outside its own body */
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/* Write compiled macros as a precompiled library */
+int MacroLibrary_save(
+    const struct MacrosList *macros, 
+    const char *path
+)
+{
+    FILE *output;
+    long offset;
+    int id;
+    int item;
+    struct LibraryHeader header;
+    struct LibraryRecord record;
+    const struct Macro *macroPtr;
+    static const char padding[LIBRARY_ALIGN];
+
+    output = fopen(path, "wb");
+    if (output == NULL)
+    {
+        return FALSE;
+    }
+
+    memset(&header, 0, sizeof(header));
+    strcpy(header.magic, LIBRARY_MAGIC);
+    strcpy(header.version, ASSEMBLER_VERSION);
+    header.macro_count = macros->macro_count;
+    header.fragment_size = sizeof(struct MacroFragment);
+    fwrite(&header, sizeof(header), 1, output);
+
+    /* Records first, their offsets follow the layout of the data written below */
+    offset = sizeof(header) + sizeof(record) * macros->macro_count;
+    for (id = 0; id < macros->macro_count; id++)
+    {
+        macroPtr = macros->macros[id];
+        memset(&record, 0, sizeof(record));
+        strcpy(record.name, macroPtr->name);
+        record.param_count = macroPtr->param_count;
+        record.params_offset = offset;
+        for (item = 0; item < macroPtr->param_count; item++)
+        {
+            offset += strlen(macroPtr->params[item]) + 1;
+        }
+        record.pool_offset = offset;
+        record.pool_length = macroPtr->pool_length;
+        offset = align_offset(offset + macroPtr->pool_length);
+        record.fragments_offset = offset;
+        record.fragment_count = macroPtr->fragment_count;
+        offset += sizeof(struct MacroFragment) * macroPtr->fragment_count;
+        fwrite(&record, sizeof(record), 1, output);
+    }
+
+    offset = sizeof(header) + sizeof(record) * macros->macro_count;
+    for (id = 0; id < macros->macro_count; id++)
+    {
+        macroPtr = macros->macros[id];
+        for (item = 0; item < macroPtr->param_count; item++)
+        {
+            fwrite(macroPtr->params[item], 1, strlen(macroPtr->params[item]) + 1, output);
+            offset += strlen(macroPtr->params[item]) + 1;
+        }
+        if (macroPtr->pool_length > 0)
+        {
+            fwrite(macroPtr->pool, 1, macroPtr->pool_length, output);
+            offset += macroPtr->pool_length;
+        }
+        fwrite(padding, 1, align_offset(offset) - offset, output);
+        offset = align_offset(offset);
+        if (macroPtr->fragment_count > 0)
+        {
+            fwrite(macroPtr->fragments, sizeof(struct MacroFragment), macroPtr->fragment_count, output);
+            offset += sizeof(struct MacroFragment) * macroPtr->fragment_count;
+        }
+    }
+
+    return fclose(output) == 0;
+}
+
+/* Unmap and free every library of the run */
+void MacroLibrary_release_all(void)
+{
+    int id;
+    int item;
+    struct MacroLibrary *library;
+
+    for (id = 0; id < total_libraries; id++)
+    {
+        library = libraries[id];
+        if (library->map != NULL)
+        {
+            for (item = 0; item < library->macros.macro_count; item++)
+            {
+                free(library->macros.macros[item]->params); /* Built by MacroLibrary_map */
+            }
+            munmap(library->map, library->map_length);
+        }
+        MacrosList_free(&library->macros);
+        free(library);
+    }
+
+    free(libraries);
+    libraries = NULL;
+    total_libraries = 0;
+    libraries_limit = 0;
+}
@@ -1,6 +1,8 @@
+#include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
 #include "macros.h"
+#include "stats.h"
 
 /* Initialize a Macro structure */
 void Macro_init(
@@ -12,6 +14,18 @@ void Macro_init(
     macroPtr->lines = NULL; /* No lines yet */
     macroPtr->counter_line = 0; /* Line count is zero */
     macroPtr->max_line_limit = 0; /* No limit set yet */
+    macroPtr->params = NULL; /* No parameters yet */
+    macroPtr->param_count = 0; /* Parameter count is zero */
+    macroPtr->pool = NULL; /* Not compiled yet */
+    macroPtr->pool_length = 0; /* Pool is empty */
+    macroPtr->pool_limit = 0; /* No pool allocated */
+    macroPtr->fragments = NULL; /* No template yet */
+    macroPtr->fragment_count = 0; /* Fragment count is zero */
+    macroPtr->fragment_limit = 0; /* No fragments allocated */
+    macroPtr->flat_body = NULL; /* Nothing memoized yet */
+    macroPtr->flat_length = 0; /* Memoized length is zero */
+    macroPtr->state = MACRO_STATE_READY; /* Ready for expansion */
+    macroPtr->borrowed = FALSE; /* Template is owned */
 }
 
 /* Free memory used by a Macro */
@@ -23,6 +37,18 @@ void Macro_free(struct Macro *macroPtr)
         free(macroPtr->lines[id]); /* Free each line */
     }
     free(macroPtr->lines); /* Free the lines array */
+    free(macroPtr->flat_body); /* Free the memoized expansion */
+    if (macroPtr->borrowed)
+    {
+        return; /* Template belongs to a macro library */
+    }
+    for (id = 0; id < macroPtr->param_count; id++)
+    {
+        free(macroPtr->params[id]); /* Free each parameter name */
+    }
+    free(macroPtr->params); /* Free the parameters array */
+    free(macroPtr->pool); /* Free the literal pool */
+    free(macroPtr->fragments); /* Free the template */
 }
 
 /* Append a line to a Macro */
@@ -35,16 +61,264 @@ void Macro_append(
     if (macroPtr->counter_line == macroPtr->max_line_limit)
     {
         macroPtr->max_line_limit += MEMORY_BLOCK_SIZE; /* Increase line limit */
+        STATS_COUNT(allocations);
         macroPtr->lines = realloc(
             macroPtr->lines,
             sizeof(*macroPtr->lines) * macroPtr->max_line_limit); /* Reallocate memory */
     }
+    STATS_COUNT(allocations);
     copy_line = malloc(strlen(line) + 1); /* Allocate memory for new line */
     strcpy(copy_line, line); /* Copy the line */
     macroPtr->lines[macroPtr->counter_line] = copy_line; /* Add line to array */
     macroPtr->counter_line++; /* Increment line count */
 }
 
+/* Add a named parameter to a Macro */
+int Macro_add_parameter(
+    struct Macro *macroPtr, 
+    const char *name     
+)
+{
+    int id;
+    char *copy_name;
+    for (id = 0; id < macroPtr->param_count; id++)
+    {
+        if (strcmp(macroPtr->params[id], name) == 0)
+        {
+            return FALSE; /* Parameter already exists */
+        }
+    }
+    STATS_COUNT(allocations);
+    macroPtr->params = realloc(
+        macroPtr->params,
+        sizeof(*macroPtr->params) * (macroPtr->param_count + 1)); /* Grow parameters array */
+    STATS_COUNT(allocations);
+    copy_name = malloc(strlen(name) + 1); /* Allocate memory for the name */
+    strcpy(copy_name, name); /* Copy the name */
+    macroPtr->params[macroPtr->param_count] = copy_name; /* Add name to array */
+    macroPtr->param_count++; /* Increment parameter count */
+    return TRUE;
+}
+
+/* Check if a character can be part of a parameter name */
+static int is_name_char(char letter)
+{
+    return isalnum((unsigned char)letter) || letter == '_';
+}
+
+/* Add a fragment to the template of a Macro */
+static void Macro_add_fragment(
+    struct Macro *macroPtr, 
+    int offset,
+    int length,
+    int slot
+)
+{
+    struct MacroFragment *fragment;
+    if (macroPtr->fragment_count == macroPtr->fragment_limit)
+    {
+        macroPtr->fragment_limit += MEMORY_BLOCK_SIZE; /* Increase fragment limit */
+        STATS_COUNT(allocations);
+        macroPtr->fragments = realloc(
+            macroPtr->fragments,
+            sizeof(*macroPtr->fragments) * macroPtr->fragment_limit); /* Reallocate memory */
+    }
+    fragment = &macroPtr->fragments[macroPtr->fragment_count]; /* Point to new fragment */
+    fragment->offset = offset;
+    fragment->length = length;
+    fragment->slot = slot;
+    macroPtr->fragment_count++; /* Increment fragment count */
+}
+
+/* Append literal text to the template, merging with the previous literal */
+static void Macro_add_literal(
+    struct Macro *macroPtr, 
+    const char *text,
+    int length
+)
+{
+    struct MacroFragment *last;
+    if (length == 0)
+    {
+        return; /* Nothing to add */
+    }
+    while (macroPtr->pool_length + length > macroPtr->pool_limit)
+    {
+        macroPtr->pool_limit += TOTAL_LEN; /* Increase pool limit */
+        STATS_COUNT(allocations);
+        macroPtr->pool = realloc(macroPtr->pool, macroPtr->pool_limit); /* Reallocate memory */
+    }
+    memcpy(&macroPtr->pool[macroPtr->pool_length], text, length); /* Copy the text */
+
+    last = NULL;
+    if (macroPtr->fragment_count > 0)
+    {
+        last = &macroPtr->fragments[macroPtr->fragment_count - 1];
+    }
+    if (last != NULL && last->slot == NO_PARAMETER_SLOT)
+    {
+        last->length += length; /* Literal continues the previous one */
+    }
+    else
+    {
+        Macro_add_fragment(macroPtr, macroPtr->pool_length, length, NO_PARAMETER_SLOT);
+    }
+    macroPtr->pool_length += length;
+}
+
+/* Find the parameter index of a name inside a line */
+static int Macro_find_parameter(
+    const struct Macro *macroPtr, 
+    const char *name,
+    int length
+)
+{
+    int id;
+    for (id = 0; id < macroPtr->param_count; id++)
+    {
+        const char *param = macroPtr->params[id];
+        if (strncmp(param, name, length) == 0 && param[length] == '\0')
+        {
+            return id; /* Found the parameter */
+        }
+    }
+    return NO_PARAMETER_SLOT;
+}
+
+/* Compile the lines of a Macro into literal fragments and parameter slots */
+void Macro_compile(struct Macro *macroPtr)
+{
+    int id;
+    int start;
+    int end;
+    int name_start;
+    int slot;
+    int in_string;
+    const char *line;
+
+    for (id = 0; id < macroPtr->counter_line; id++)
+    {
+        line = macroPtr->lines[id];
+        in_string = FALSE;
+        start = 0;
+        end = 0;
+        while (line[end] != '\0')
+        {
+            if (!in_string && line[end] == ';')
+            {
+                break; /* Comments are copied as they are */
+            }
+            if (line[end] == '"')
+            {
+                in_string = !in_string; /* String literals are copied as they are */
+            }
+            if (in_string || !is_name_char(line[end]))
+            {
+                end++;
+                continue;
+            }
+
+            /* Found a name, check if it is a parameter */
+            name_start = end;
+            while (is_name_char(line[end]))
+            {
+                end++;
+            }
+            slot = Macro_find_parameter(macroPtr, &line[name_start], end - name_start);
+            if (slot != NO_PARAMETER_SLOT)
+            {
+                Macro_add_literal(macroPtr, &line[start], name_start - start); /* Text before the name */
+                Macro_add_fragment(macroPtr, 0, 0, slot);
+                start = end;
+            }
+        }
+        Macro_add_literal(macroPtr, &line[start], strlen(&line[start]) + 1); /* Keep line terminator */
+        free(macroPtr->lines[id]); /* Line is now part of the template */
+    }
+    free(macroPtr->lines); /* Free the lines array */
+    macroPtr->lines = NULL;
+    macroPtr->counter_line = 0;
+    macroPtr->max_line_limit = 0;
+}
+
+/* Splice arguments into the template of a Macro */
+char *Macro_expand(
+    const struct Macro *macroPtr, 
+    char **args,
+    int *length
+)
+{
+    int id;
+    int total;
+    char *buffer;
+    char *target;
+    const struct MacroFragment *fragment;
+
+    total = 0;
+    for (id = 0; id < macroPtr->fragment_count; id++)
+    {
+        fragment = &macroPtr->fragments[id];
+        if (fragment->slot == NO_PARAMETER_SLOT)
+        {
+            total += fragment->length;
+        }
+        else
+        {
+            total += strlen(args[fragment->slot]);
+        }
+    }
+
+    STATS_COUNT(allocations);
+    buffer = malloc(total + 1); /* Allocate memory for the expansion */
+    target = buffer;
+    for (id = 0; id < macroPtr->fragment_count; id++)
+    {
+        fragment = &macroPtr->fragments[id];
+        if (fragment->slot == NO_PARAMETER_SLOT)
+        {
+            memcpy(target, &macroPtr->pool[fragment->offset], fragment->length); /* Copy literal */
+            target += fragment->length;
+        }
+        else
+        {
+            strcpy(target, args[fragment->slot]); /* Copy argument */
+            target += strlen(args[fragment->slot]);
+        }
+    }
+
+    *length = total; /* Report the expansion length */
+    return buffer;
+}
+
+/* Share the compiled template of a library Macro */
+void Macro_borrow(
+    struct Macro *macroPtr, 
+    const struct Macro *template
+)
+{
+    macroPtr->params = template->params; /* Parameter names are shared */
+    macroPtr->param_count = template->param_count;
+    macroPtr->pool = template->pool; /* Literal pool is shared */
+    macroPtr->pool_length = template->pool_length;
+    macroPtr->fragments = template->fragments; /* Template is shared */
+    macroPtr->fragment_count = template->fragment_count;
+    macroPtr->borrowed = TRUE;
+}
+
+/* Keep the flattened expansion of a Macro */
+void Macro_memoize(
+    struct Macro *macroPtr, 
+    const char *body,
+    int length
+)
+{
+    free(macroPtr->flat_body); /* Drop any previous expansion */
+    STATS_COUNT(allocations);
+    macroPtr->flat_body = malloc(length + 1); /* Allocate memory for the copy */
+    memcpy(macroPtr->flat_body, body, length); /* Copy the expansion */
+    macroPtr->flat_length = length;
+}
+
 /* Initialize a list of Macros */
 void MacrosList_init(struct MacrosList *collection)
 {
@@ -102,10 +376,12 @@ struct Macro *MacrosList_register(
     if (collection->macro_count == collection->macro_limit)
     {
         collection->macro_limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
         collection->macros = realloc(
             collection->macros,
             sizeof(*collection->macros) * collection->macro_limit); /* Reallocate memory */
     }
+    STATS_COUNT(allocations);
     macroPtr = malloc(sizeof(*macroPtr)); /* Allocate memory for new Macro */
     Macro_init(macroPtr, name); /* Initialize Macro */
     collection->macros[collection->macro_count] = macroPtr; /* Add Macro to list */
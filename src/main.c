@@ -1,71 +1,163 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include "archive.h"
+#include "batchio.h"
+#include "cache.h"
 #include "definitions.h"
+#include "isa.h"
+#include "library.h"
 #include "passes.h"
+#include "stats.h"
+#include "trace.h"
 
 char file_name[TOTAL_LEN]; /* Buffer for input/output file names */
 
-int main(int argc, char *argv[])
+#define BATCH_OUTPUTS_PER_UNIT (5) /* .am, .rel, .ob, .ent and .ext files */
+
+/* Structure for command line options */
+struct options
+{
+    int stats_format; /* Statistics format, zero for none */
+    int pipelined; /* Pipelined second pass */
+    int batch; /* Read and write all files through batch I/O */
+    int cached; /* Reuse outputs of unchanged sources */
+    int incremental; /* Reuse results of unchanged statements */
+    int precompile; /* Write precompiled macro libraries instead of assembling */
+    int max_errors; /* Errors that stop a unit, zero for no limit */
+    const char *trace_path; /* Chrome trace output, NULL for none */
+    int grouped_externals; /* One .ext line per external symbol */
+    int relocations; /* Write a .rel relocation table */
+    int base_address; /* Address of the first word */
+    const char *archive_path; /* Archive receiving all batch outputs, NULL for none */
+    int optimize; /* Rewrite statements into shorter equivalents */
+    int strip_unused; /* Leave out code and data no entry point can reach */
+    struct BuildCache cache; /* Cache of assembled units */
+    char signature[TOTAL_LEN]; /* Options that change the output */
+};
+
+static void set_file_name(
+    char *path, 
+    const char *name, 
+    const char *extension
+)
+{
+    strcpy(path, name); /* Set base file name */
+    strcat(path, extension); /* Add extension */
+}
+
+static void configure_passes(
+    struct passes *passes, 
+    const char *name, 
+    const struct options *options
+)
+{
+    initialize_passes(passes); /* Initialize passes structure */
+    passes->pipelined = options->pipelined;
+    passes->max_errors = options->max_errors;
+    passes->grouped_externals = options->grouped_externals;
+    passes->base_address = options->base_address;
+    passes->optimize = options->optimize;
+    passes->strip_unused = options->strip_unused;
+    if (options->incremental)
+    {
+        set_file_name(passes->state_path, name, ".state"); /* Add .state extension */
+    }
+}
+
+static int assemble_file(
+    const char *name, 
+    const struct options *options
+)
 {
-    const char *name;
     FILE *fileas;
     FILE *fileam;
     FILE *fileent;
     FILE *filewrong;
     FILE *fileext;
     FILE *fileob;
+    FILE *filerel;
     int total_invalid;
     int del_entry;
     int del_extern;
     struct passes passes;
 
-    if (argc != 2)
+    trace_set_unit(name);
+    TRACE_BEGIN(TRACE_OPEN);
+    set_file_name(file_name, name, ".as"); /* Add .as extension */
+    fileas = fopen(file_name, "r"); /* Open assembly file for reading */
+    if (fileas == NULL)
     {
-        fprintf(stderr, "Usage: %s <file-name>\n", argv[0]); /* Print how to use message */
-        return (-1); /* Exit if incorrect number of arguments */
+        TRACE_END(TRACE_OPEN);
+        fprintf(stderr, "Cannot open file \"%s\"\n", file_name);
+        return (-1);
     }
 
-    name = argv[1];
-    initialize_passes(&passes); /* Initialize passes structure */
-    strcpy(file_name, name); /* Set base file name */
-    strcat(file_name, ".as"); /* Add .as extension */
-    fileas = fopen(file_name, "r"); /* Open assembly file for reading */
-    strcpy(file_name, name); /* Reset file name */
-    strcat(file_name, ".am"); /* Add .am extension */
+    configure_passes(&passes, name, options); /* Initialize passes structure */
+    set_file_name(file_name, name, ".am"); /* Add .am extension */
     fileam = fopen(file_name, "w+"); /* Open macro file for writing */
+    TRACE_END(TRACE_OPEN);
 
     filewrong = stderr; /* Set error output to stderr */
     del_entry = FALSE; /* Initialize entry deletion flag */
     del_extern = FALSE; /* Initialize extern deletion flag */
 
+    STATS_PHASE_BEGIN(STATS_PHASE_FIRST_PASS);
+    TRACE_BEGIN(TRACE_FIRST_PASS);
     total_invalid = assembler_first_pass(
         &passes,
         fileas,
         fileam,
         filewrong); /* Perform first assembler pass */
+    TRACE_END(TRACE_FIRST_PASS);
+    STATS_PHASE_END(STATS_PHASE_FIRST_PASS);
+    STATS_ADD(bytes_written[STATS_FILE_AM], ftell(fileam));
 
     if (total_invalid == 0)
     {
         fseek(fileam, 0, SEEK_SET); /* Reset file pointer for .am file */
+        TRACE_BEGIN(TRACE_OPEN);
 
-        strcpy(file_name, name); /* Reset file name */
-        strcat(file_name, ".ent"); /* Add .ent extension */
+        set_file_name(file_name, name, ".ent"); /* Add .ent extension */
         fileent = fopen(file_name, "w+"); /* Open entry file for writing */
 
-        strcpy(file_name, name); /* Reset file name */
-        strcat(file_name, ".ext"); /* Add .ext extension */
+        set_file_name(file_name, name, ".ext"); /* Add .ext extension */
         fileext = fopen(file_name, "w+"); /* Open extern file for writing */
 
-        strcpy(file_name, name); /* Reset file name */
-        strcat(file_name, ".ob"); /* Add .ob extension */
+        set_file_name(file_name, name, ".ob"); /* Add .ob extension */
         fileob = fopen(file_name, "w+"); /* Open object file for writing */
 
+        filerel = NULL;
+        if (options->relocations)
+        {
+            set_file_name(file_name, name, ".rel"); /* Add .rel extension */
+            filerel = fopen(file_name, "w+"); /* Open relocation table for writing */
+        }
+        passes.filerel = filerel;
+        TRACE_END(TRACE_OPEN);
+
+        STATS_PHASE_BEGIN(STATS_PHASE_SECOND_PASS);
+        TRACE_BEGIN(TRACE_SECOND_PASS);
         assembler_second_pass(
             &passes,
             fileam,
             fileent,
             fileext,
             fileob); /* Perform second assembler pass */
+        TRACE_END(TRACE_SECOND_PASS);
+        STATS_PHASE_END(STATS_PHASE_SECOND_PASS);
+        STATS_ADD(bytes_written[STATS_FILE_OB], ftell(fileob));
+        STATS_ADD(bytes_written[STATS_FILE_ENT], ftell(fileent));
+        STATS_ADD(bytes_written[STATS_FILE_EXT], ftell(fileext));
+        STATS_PHASE_BEGIN(STATS_PHASE_OUTPUT);
+
+        if (filerel != NULL)
+        {
+            STATS_ADD(bytes_written[STATS_FILE_REL], ftell(filerel));
+            fclose(filerel); /* Close relocation table */
+        }
+        TRACE_BEGIN(TRACE_OUTPUT);
 
         if (ftell(fileent) == 0)
         {
@@ -80,6 +172,8 @@ int main(int argc, char *argv[])
         fclose(fileent); /* Close entry file */
         fclose(fileext); /* Close extern file */
         fclose(fileob); /* Close object file */
+        TRACE_END(TRACE_OUTPUT);
+        STATS_PHASE_END(STATS_PHASE_OUTPUT);
     }
 
     fclose(fileam); /* Close macro file */
@@ -89,17 +183,553 @@ int main(int argc, char *argv[])
 
     if (del_entry)
     {
-        strcpy(file_name, name); /* Reset file name */
-        strcat(file_name, ".ent"); /* Add .ent extension */
+        set_file_name(file_name, name, ".ent"); /* Add .ent extension */
         remove(file_name); /* Remove entry file */
     }
 
     if (del_extern)
     {
-        strcpy(file_name, name); /* Reset file name */
-        strcat(file_name, ".ext"); /* Add .ext extension */
+        set_file_name(file_name, name, ".ext"); /* Add .ext extension */
         remove(file_name); /* Remove extern file */
     }
 
+    return total_invalid; 
+}
+
+static int precompile_library(
+    const char *name, 
+    const struct options *options
+)
+{
+    FILE *filelib;
+    int total_invalid;
+    char library_path[TOTAL_LEN];
+    struct passes passes;
+
+    set_file_name(file_name, name, ".as"); /* Add .as extension */
+    filelib = fopen(file_name, "r"); /* Open macro library source for reading */
+    if (filelib == NULL)
+    {
+        fprintf(stderr, "Cannot open file \"%s\"\n", file_name);
+        return (-1);
+    }
+
+    initialize_passes(&passes); /* Initialize passes structure */
+    passes.max_errors = options->max_errors;
+    set_file_name(library_path, name, MACRO_LIBRARY_EXTENSION); /* Add .mlib extension */
+    total_invalid = assembler_precompile(
+        &passes,
+        filelib,
+        library_path,
+        stderr); /* Compile the macros once for every later run */
+
+    fclose(filelib); /* Close macro library source */
+    release_passes_memory(&passes); /* Free memory used by passes */
+    return total_invalid; 
+}
+
+static int uses_macro_library(const char *data)
+{
+    /* Outputs also depend on the libraries, which the cache key does not cover */
+    return strstr(data, DIRECTIVE_INCLUDE) != NULL;
+}
+
+static int restore_cached_file(
+    const char *name, 
+    const struct options *options, 
+    char *key
+)
+{
+    FILE *fileas;
+    char *data;
+    long length;
+    int restored;
+
+    set_file_name(file_name, name, ".as"); /* Add .as extension */
+    fileas = fopen(file_name, "rb"); /* Read the whole source for its key */
+    if (fileas == NULL)
+    {
+        return FALSE;
+    }
+
+    fseek(fileas, 0, SEEK_END);
+    length = ftell(fileas);
+    fseek(fileas, 0, SEEK_SET);
+    data = malloc(length + 1);
+    length = fread(data, 1, length, fileas);
+    data[length] = '\0';
+    fclose(fileas);
+
+    key[0] = '\0'; /* Nothing to store in the cache */
+    restored = FALSE;
+    if (!uses_macro_library(data))
+    {
+        cache_key(data, length, options->signature, key);
+        restored = cache_restore(&options->cache, key, name, data, length);
+    }
+    free(data);
+    return restored;
+}
+
+static struct BatchFile *add_output(
+    struct BatchFile *outputs, 
+    int *total_outputs, 
+    const char *name, 
+    const char *extension
+)
+{
+    struct BatchFile *output;
+
+    output = &outputs[*total_outputs]; /* Next free output */
+    set_file_name(output->path, name, extension);
+    output->data = NULL;
+    output->length = 0;
+    (*total_outputs)++;
+    return output;
+}
+
+static int assemble_memory(
+    const char *name, 
+    struct BatchFile *input, 
+    struct BatchFile *outputs, 
+    int *total_outputs, 
+    const struct options *options
+)
+{
+    FILE *fileas;
+    FILE *fileam;
+    FILE *fileent;
+    FILE *fileext;
+    FILE *fileob;
+    int total_invalid;
+    struct BatchFile *am;
+    struct BatchFile *ent;
+    struct BatchFile *ext;
+    struct BatchFile *ob;
+    struct BatchFile *rel;
+    FILE *filerel;
+    struct passes passes;
+
+    if (input->failed)
+    {
+        fprintf(stderr, "Cannot open file \"%s\"\n", input->path);
+        return (-1);
+    }
+
+    trace_set_unit(name);
+    configure_passes(&passes, name, options); /* Initialize passes structure */
+
+    am = add_output(outputs, total_outputs, name, ".am");
+    fileas = fmemopen(input->data, input->length, "r"); /* Read source from memory */
+    fileam = open_memstream(&am->data, &am->length); /* Collect macro file in memory */
+
+    STATS_PHASE_BEGIN(STATS_PHASE_FIRST_PASS);
+    TRACE_BEGIN(TRACE_FIRST_PASS);
+    total_invalid = assembler_first_pass(
+        &passes,
+        fileas,
+        fileam,
+        stderr); /* Perform first assembler pass */
+    TRACE_END(TRACE_FIRST_PASS);
+    STATS_PHASE_END(STATS_PHASE_FIRST_PASS);
+
+    fclose(fileas);
+    fclose(fileam);
+    STATS_ADD(bytes_written[STATS_FILE_AM], am->length);
+
+    if (total_invalid == 0)
+    {
+        /* Optional outputs go first, empty .ent and .ext are dropped from the end */
+        rel = NULL;
+        filerel = NULL;
+        if (options->relocations)
+        {
+            rel = add_output(outputs, total_outputs, name, ".rel");
+            filerel = open_memstream(&rel->data, &rel->length);
+        }
+        passes.filerel = filerel;
+
+        ob = add_output(outputs, total_outputs, name, ".ob");
+        ent = add_output(outputs, total_outputs, name, ".ent");
+        ext = add_output(outputs, total_outputs, name, ".ext");
+
+        fileam = fmemopen(am->data, am->length, "r"); /* Read macro file back */
+        fileob = open_memstream(&ob->data, &ob->length);
+        fileent = open_memstream(&ent->data, &ent->length);
+        fileext = open_memstream(&ext->data, &ext->length);
+
+        STATS_PHASE_BEGIN(STATS_PHASE_SECOND_PASS);
+        TRACE_BEGIN(TRACE_SECOND_PASS);
+        assembler_second_pass(
+            &passes,
+            fileam,
+            fileent,
+            fileext,
+            fileob); /* Perform second assembler pass */
+        TRACE_END(TRACE_SECOND_PASS);
+        STATS_PHASE_END(STATS_PHASE_SECOND_PASS);
+
+        fclose(fileam);
+        fclose(fileob);
+        fclose(fileent);
+        fclose(fileext);
+        STATS_ADD(bytes_written[STATS_FILE_OB], ob->length);
+        STATS_ADD(bytes_written[STATS_FILE_ENT], ent->length);
+        STATS_ADD(bytes_written[STATS_FILE_EXT], ext->length);
+
+        if (filerel != NULL)
+        {
+            fclose(filerel);
+            STATS_ADD(bytes_written[STATS_FILE_REL], rel->length);
+        }
+
+        /* Empty entry and extern files are removed, not written */
+        if (ext->length == 0)
+        {
+            if (options->archive_path == NULL)
+            {
+                remove(ext->path);
+            }
+            free(ext->data);
+            (*total_outputs)--;
+        }
+
+        if (ent->length == 0)
+        {
+            if (options->archive_path == NULL)
+            {
+                remove(ent->path);
+            }
+            free(ent->data);
+            *ent = *ext; /* Keep the outputs contiguous */
+            (*total_outputs)--;
+        }
+    }
+
+    release_passes_memory(&passes); /* Free memory used by passes */
+    return total_invalid; 
+}
+
+static void assemble_batch(
+    char **names, 
+    int count, 
+    const struct options *options
+)
+{
+    int id;
+    int total_outputs;
+    int *results;
+    char (*keys)[CACHE_KEY_LEN];
+    struct BatchFile *inputs;
+    struct BatchFile *outputs;
+
+    results = malloc(sizeof(*results) * count);
+    keys = malloc(sizeof(*keys) * count);
+    inputs = malloc(sizeof(*inputs) * count);
+    outputs = malloc(sizeof(*outputs) * count * BATCH_OUTPUTS_PER_UNIT);
+    total_outputs = 0;
+
+    for (id = 0; id < count; id++)
+    {
+        set_file_name(inputs[id].path, names[id], ".as"); /* Add .as extension */
+    }
+
+    trace_set_unit("batch");
+    TRACE_BEGIN(TRACE_OPEN);
+    batch_read_files(inputs, count); /* Read every source at once */
+    TRACE_END(TRACE_OPEN);
+
+    for (id = 0; id < count; id++)
+    {
+        results[id] = (-1); /* Nothing to store in the cache */
+        keys[id][0] = '\0';
+        if (options->cached && !inputs[id].failed && !uses_macro_library(inputs[id].data))
+        {
+            cache_key(inputs[id].data, inputs[id].length, options->signature, keys[id]);
+            if (cache_restore(&options->cache, keys[id], names[id], inputs[id].data, inputs[id].length))
+            {
+                free(inputs[id].data);
+                continue; /* Unchanged source, outputs restored */
+            }
+        }
+
+        results[id] = assemble_memory(names[id], &inputs[id], outputs, &total_outputs, options);
+        free(inputs[id].data);
+    }
+
+    trace_set_unit("batch");
+    STATS_PHASE_BEGIN(STATS_PHASE_OUTPUT);
+    TRACE_BEGIN(TRACE_OUTPUT);
+    if (options->archive_path == NULL)
+    {
+        batch_write_files(outputs, total_outputs); /* Write every output at once */
+    }
+    else if (!Archive_write(options->archive_path, outputs, total_outputs))
+    {
+        fprintf(stderr, "Cannot write file \"%s\"\n", options->archive_path);
+    }
+    TRACE_END(TRACE_OUTPUT);
+    STATS_PHASE_END(STATS_PHASE_OUTPUT);
+
+    for (id = 0; options->cached && id < count; id++)
+    {
+        if (results[id] == 0 && keys[id][0] != '\0')
+        {
+            cache_store(&options->cache, keys[id], names[id]); /* Keep outputs for later runs */
+        }
+    }
+
+    for (id = 0; id < total_outputs; id++)
+    {
+        free(outputs[id].data);
+    }
+    free(outputs);
+    free(inputs);
+    free(keys);
+    free(results);
+}
+
+/* Read a load address, FALSE unless the whole text is a number that fits an address */
+static int parse_base(
+    const char *text, 
+    int *base
+)
+{
+    char *end;
+    long value;
+
+    value = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || value < 0 || value > ISA_VALUE_MASK)
+    {
+        return FALSE;
+    }
+
+    *base = (int)value;
+    return TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+    char **names;
+    char key[CACHE_KEY_LEN];
+    int total_names;
+    int id;
+    int base;
+    struct options options;
+
+    names = malloc(sizeof(*names) * argc);
+    total_names = 0;
+    options.stats_format = 0; /* No statistics by default */
+    options.pipelined = FALSE; /* Serial second pass by default */
+    options.batch = FALSE; /* One file at a time by default */
+    options.cached = FALSE; /* No build cache by default */
+    options.incremental = FALSE; /* Full reassembly by default */
+    options.precompile = FALSE; /* Assemble by default */
+    options.max_errors = 0; /* Report every error by default */
+    options.trace_path = NULL; /* No trace by default */
+    options.grouped_externals = FALSE; /* One .ext line per reference by default */
+    options.relocations = FALSE; /* No relocation table by default */
+    options.base_address = LOAD_BASE_ADDRESS; /* Default load address */
+    options.archive_path = NULL; /* Separate output files by default */
+    options.optimize = FALSE; /* Statements are encoded as written by default */
+    options.strip_unused = FALSE; /* Every statement is kept by default */
+    options.cache.size_limit = CACHE_DEFAULT_SIZE;
+    options.cache.relocations = FALSE;
+    options.signature[0] = '\0'; /* Filled in once all options are read */
+
+    for (id = 1; id < argc; id++)
+    {
+        if (strcmp(argv[id], "--batch") == 0)
+        {
+            options.batch = TRUE; /* Batch file I/O */
+        }
+        else if (strcmp(argv[id], "--no-uring") == 0)
+        {
+            batch_io_disable_uring(); /* Batch file I/O through stdio */
+        }
+        else if (strncmp(argv[id], "--cache=", 8) == 0 && strlen(argv[id]) - 8 < TOTAL_LEN)
+        {
+            options.cached = TRUE; /* Reuse outputs of unchanged sources */
+            strcpy(options.cache.directory, &argv[id][8]);
+        }
+        else if (strncmp(argv[id], "--cache-size=", 13) == 0)
+        {
+            options.cache.size_limit = atol(&argv[id][13]); /* Bytes kept in the cache */
+        }
+        else if (strcmp(argv[id], "--incremental") == 0)
+        {
+            options.incremental = TRUE; /* Reuse results of unchanged statements */
+        }
+        else if (strncmp(argv[id], "--max-errors=", 13) == 0 && atoi(&argv[id][13]) > 0)
+        {
+            options.max_errors = atoi(&argv[id][13]); /* Stop a unit after this many errors */
+        }
+        else if (strcmp(argv[id], "--ext-format=grouped") == 0)
+        {
+            options.grouped_externals = TRUE; /* One .ext line per external symbol */
+        }
+        else if (strcmp(argv[id], "--reloc") == 0)
+        {
+            options.relocations = TRUE; /* Write a .rel relocation table */
+            options.cache.relocations = TRUE;
+        }
+        else if (strncmp(argv[id], "--base=", 7) == 0 && parse_base(&argv[id][7], &base))
+        {
+            options.base_address = base; /* Address of the first word */
+        }
+        else if (strncmp(argv[id], "--archive=", 10) == 0 && argv[id][10] != '\0')
+        {
+            options.archive_path = &argv[id][10]; /* One archive for all outputs */
+            options.batch = TRUE; /* Outputs are collected in memory */
+        }
+        else if (strcmp(argv[id], "--optimize") == 0)
+        {
+            options.optimize = TRUE; /* Rewrite statements into shorter equivalents */
+        }
+        else if (strcmp(argv[id], "--strip-unused") == 0)
+        {
+            options.strip_unused = TRUE; /* Leave out unreachable code and data */
+        }
+        else if (strcmp(argv[id], "--ext-format=lines") == 0)
+        {
+            options.grouped_externals = FALSE; /* One .ext line per reference */
+        }
+        else if (strncmp(argv[id], "--trace=", 8) == 0 && argv[id][8] != '\0')
+        {
+            options.trace_path = &argv[id][8]; /* Record a Chrome trace */
+        }
+        else if (strcmp(argv[id], "--precompile") == 0)
+        {
+            options.precompile = TRUE; /* Write precompiled macro libraries */
+        }
+        else if (strcmp(argv[id], "--pipeline") == 0)
+        {
+            options.pipelined = TRUE; /* Pipelined second pass */
+        }
+        else if (strcmp(argv[id], "--stats") == 0)
+        {
+            options.stats_format = STATS_FORMAT_TEXT; /* Human readable statistics */
+        }
+        else if (strcmp(argv[id], "--stats=json") == 0)
+        {
+            options.stats_format = STATS_FORMAT_JSON; /* Machine readable statistics */
+        }
+        else if (argv[id][0] != '-')
+        {
+            names[total_names] = argv[id]; /* Base file name */
+            total_names++;
+        }
+        else
+        {
+            total_names = 0;
+            break;
+        }
+    }
+
+    /* Cached outputs are only reused under the same output options */
+    if (options.grouped_externals)
+    {
+        strcat(options.signature, " --ext-format=grouped");
+    }
+    if (options.relocations)
+    {
+        strcat(options.signature, " --reloc");
+    }
+    if (options.base_address != LOAD_BASE_ADDRESS)
+    {
+        sprintf(&options.signature[strlen(options.signature)], " --base=%d", options.base_address);
+    }
+    if (options.optimize)
+    {
+        strcat(options.signature, " --optimize");
+    }
+    if (options.strip_unused)
+    {
+        strcat(options.signature, " --strip-unused");
+    }
+
+    if (total_names == 0 || (options.archive_path != NULL && options.cached))
+    {
+        fprintf(
+            stderr,
+            "Usage: %s [--batch [--no-uring] | --archive=FILE] [--pipeline] [--incremental] [--cache=DIR [--cache-size=BYTES]]\n"
+            "       [--ext-format=lines|grouped] [--reloc] [--base=ADDRESS] [--optimize] [--strip-unused]\n"
+            "       [--max-errors=N] [--trace=FILE] [--stats[=json]]\n"
+            "       <file-name>...\n"
+            "       %s --precompile <library-name>...\n",
+            argv[0],
+            argv[0]); /* Print how to use message */
+        free(names);
+        return (-1); /* Exit if incorrect arguments */
+    }
+
+    if (options.stats_format != 0)
+    {
+        stats_enable(); /* Collect statistics for this run */
+    }
+    if (options.trace_path != NULL)
+    {
+        trace_enable(); /* Record phase events for this run */
+    }
+    STATS_PHASE_BEGIN(STATS_PHASE_TOTAL);
+
+    if (options.precompile)
+    {
+        for (id = 0; id < total_names; id++)
+        {
+            precompile_library(names[id], &options);
+        }
+    }
+    else if (options.batch)
+    {
+        assemble_batch(names, total_names, &options);
+    }
+    else
+    {
+        for (id = 0; id < total_names; id++)
+        {
+            if (options.cached && restore_cached_file(names[id], &options, key))
+            {
+                continue; /* Unchanged source, outputs restored */
+            }
+
+            if (assemble_file(names[id], &options) == 0 && options.cached && key[0] != '\0')
+            {
+                cache_store(&options.cache, key, names[id]); /* Keep outputs for later runs */
+            }
+        }
+    }
+
+    if (options.cached)
+    {
+        cache_evict(&options.cache); /* Keep the cache within its limit */
+    }
+
+    MacroLibrary_release_all(); /* Free libraries shared by the units */
+
+    if (options.trace_path != NULL)
+    {
+        if (!trace_write(options.trace_path))
+        {
+            fprintf(stderr, "Cannot write file \"%s\"\n", options.trace_path);
+        }
+        trace_release();
+    }
+
+    STATS_PHASE_END(STATS_PHASE_TOTAL);
+    if (options.stats_format != 0)
+    {
+        if (total_names > 1)
+        {
+            sprintf(file_name, "%d files", total_names);
+        }
+        else
+        {
+            strcpy(file_name, names[0]);
+        }
+        stats_report(stdout, file_name, options.stats_format); /* Print collected statistics */
+    }
+
+    free(names);
     return 0; /* Exit successfully */
 }
@@ -1,9 +1,21 @@
+#define _POSIX_C_SOURCE 200809L
+#include <ctype.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "definitions.h"
+#include "diagnostics.h"
+#include "expression.h"
+#include "hashtable.h"
+#include "incremental.h"
+#include "isa.h"
+#include "library.h"
 #include "passes.h"
+#include "ring.h"
+#include "stats.h"
 #include "tokens.h"
+#include "trace.h"
 
 static char line_buffer[TOTAL_LEN]; /* Buffer for current line */
 static int current_line_number; /* Line number tracker */
@@ -11,83 +23,114 @@ static int total_functions; /* Total functions count */
 static int total_code_lines; /* Total code lines count */
 static int total_data_lines; /* Total data lines count */
 static int total_errors_found; /* Total errors found */
+static int base_address; /* Address of the first word */
+static FILE *relocation_file; /* Relocation table, NULL if not requested */
+static int max_errors; /* Errors that stop the first pass, zero for no limit */
+static struct DiagnosticBuffer diagnostics; /* Errors waiting to be printed */
+static struct LineCache line_cache; /* Statement results kept between runs */
+static int incremental; /* TRUE while line_cache is in use */
+static struct LineRecord *statement_record; /* Record filled by the first pass */
+static struct LineRecord *encoding_record; /* Record filled by the second pass */
+static const char *encoding_symbol; /* Label behind the next encoded word */
+static int optimize; /* TRUE to rewrite statements into shorter equivalents */
+static char rewritten_line[TOTAL_LEN * 2]; /* Statement after rewriting */
+static char pending_statement[TOTAL_LEN]; /* Statement held back until the next one is read, empty for none */
+static char pending_target[TOTAL_LEN]; /* Label the held jump goes to */
+static char pending_clear[TOTAL_LEN]; /* clr form of a held mov #0 */
+static int pending_hold; /* Why the statement is held */
+static int pending_line_number; /* Line number of the held statement */
+static int strip_unused; /* TRUE to leave out blocks nothing refers to */
+static struct ExpansionBuffer held_text; /* Statements waiting for the reference graph */
+static struct HeldStatement *held_statements; /* Statements in source order */
+static int total_held; /* Number of held statements */
+static int held_limit; /* Allocated held statements */
+static struct ConstantTable constants; /* Names defined by .define */
+static struct LabelStruct *offset_references; /* Labels used with an offset, checked after the first pass */
+static int total_offsets; /* Number of offset references */
+static int offsets_limit; /* Allocated offset references */
+static int unstable_statement; /* TRUE if the statement depends on constants or label offsets */
+static struct LineCache encoding_memo; /* Results of label-free statements, kept for one run */
+static int symbol_statement; /* TRUE if the statement refers to a label */
+static char memo_key[TOTAL_LEN]; /* Normalized text of the last statement looked up */
 
 #define GROUP0 (0) /* Group 0 for instruction types */
 #define GROUP1_CODE (1) /* Group 1 for code instructions */
 #define GROUP2_DATA (2) /* Group 2 for data instructions */
 
-#define NO_OPERANDS_GROUP (0) /* No operands */
-#define ONE_OPERAND_GROUP (1) /* One operand */
-#define TWO_OPERANDS_GROUP (2) /* Two operands */
-
-#define IMMEDIATE_GROUP_OPERAND (1) /* Immediate operand */
-#define DIR_GROUP_OPERAND (2) /* Direct operand */
-#define INDIR_GROUP_OPERAND (4) /* Indirect operand */
-#define REGISTER_GROUP_OPERAND (8) /* Register operand */
-
 #define FIRST_OPERAND (0) /* First operand index */
 #define SECOND_OPERAND (1) /* Second operand index */
 
-#define ABSOLUTE_FLAG (0x4) /* Absolute address flag */
-#define RELOCATABLE_FLAG (0x2) /* Relocatable address flag */
-#define EXTERNAL_FLAG (0x1) /* External address flag */
+#define HOLD_NONE (0) /* Statement is passed on at once */
+#define HOLD_JUMP (1) /* Jump that may go to the next statement */
+#define HOLD_CLEAR (2) /* mov #0 that may become clr, which also sets the flags */
 
-#define MAX_GUIDE_DIRECTIVES (4) /* Maximum guide directives count */
+#define MAX_GUIDE_DIRECTIVES (7) /* Maximum guide directives count */
 
 const char *guide_directives[] = {
     ".data",
     ".entry",
     ".extern",
-    ".string"};
+    ".string",
+    ".space",
+    ".fill",
+    ".define"};
 
 struct LabelStruct
 {
     char name[TOTAL_LEN]; /* Label name */
     int address; /* Label address */
+    int line_number; /* Line that defined or exported the name */
 };
 
 struct LabelStruct *labels; /* Array of labels */
 int total_labels; /* Total number of labels */
 int max_labels; /* Maximum number of labels */
+struct HashTable label_index; /* Label name to labels index */
 
 struct LabelStruct *val_arr; /* Array for entries */
 int total_input; /* Total number of entries */
 int limit; /* Limit of entries */
+struct HashTable entry_index; /* Entry name to val_arr index */
+
+struct ExternalGroup
+{
+    char name[TOTAL_LEN]; /* External symbol */
+    int *addresses; /* Words that refer to the symbol, in ascending order */
+    int count; /* Number of addresses */
+    int limit; /* Allocated addresses */
+};
+
+struct ExternalGroup *external_groups; /* External symbols in order of first use */
+int total_groups; /* Number of external symbols */
+int groups_limit; /* Allocated external symbols */
+struct HashTable external_index; /* External name to external_groups index */
+int grouped_externals; /* TRUE to collect external references instead of writing them */
+
+struct ExpansionBuffer
+{
+    char *data; /* Expanded lines separated by NUL characters */
+    int length; /* Used bytes */
+    int limit; /* Allocated bytes */
+};
 
-struct instruction
+struct HeldStatement
 {
-    const char *name; /* Instruction name */
-    int command_opcode; /* Opcode for instruction */
-    int group; /* Group for instruction */
+    int offset; /* Text of the statement in held_text */
+    int line_number; /* Line the statement came from */
+    int block; /* Labeled block the statement belongs to */
 };
 
-#define TOTAL_COMMANDS (16) /* Total number of commands */
-
-const struct instruction valid_commands_sizes[] = {
-    {"mov", 0, 2},
-    {"cmp", 1, 2},
-    {"add", 2, 2},
-    {"sub", 3, 2},
-    {"lea", 4, 2},
-    {"clr", 5, 1},
-    {"not", 6, 1},
-    {"inc", 7, 1},
-    {"dec", 8, 1},
-    {"jmp", 9, 1},
-    {"bne", 10, 1},
-    {"red", 11, 1},
-    {"prn", 12, 1},
-    {"jsr", 13, 1},
-    {"rts", 14, 0},
-    {"stop", 15, 0}};
-
-#define MAX_RESERVED_WORD (20) /* Max number of reserved words */
+#define MAX_RESERVED_WORD (24) /* Max number of reserved words */
 
 const char *valid_commands[] = {
     ".data",
     ".entry",
     ".extern",
     ".string",
+    ".space",
+    ".fill",
+    ".include",
+    ".define",
     "mov",
     "cmp",
     "add",
@@ -107,6 +150,16 @@ const char *valid_commands[] = {
 
 void initialize_passes(struct passes *passes)
 {
+    passes->pass_number = 0; /* No pass has run yet */
+    passes->pipelined = FALSE; /* Serial second pass by default */
+    passes->state_path[0] = '\0'; /* No incremental state by default */
+    passes->max_errors = 0; /* Report every error by default */
+    passes->grouped_externals = FALSE; /* One .ext line per reference by default */
+    passes->base_address = LOAD_BASE_ADDRESS; /* Default load address */
+    passes->filerel = NULL; /* No relocation table by default */
+    passes->optimize = FALSE; /* Statements are encoded as written by default */
+    passes->strip_unused = FALSE; /* Every statement is kept by default */
+
     val_arr = NULL; /* Initialize entry array */
     total_input = 0; /* Reset total entries */
     limit = 0; /* Reset entry limit */
@@ -114,12 +167,60 @@ void initialize_passes(struct passes *passes)
     labels = NULL; /* Initialize labels array */
     total_labels = 0; /* Reset total labels */
     max_labels = 0; /* Reset max labels */
+    HashTable_init(&label_index); /* Empty label index */
+    HashTable_init(&entry_index); /* Empty entry index */
+
+    external_groups = NULL; /* No external references yet */
+    total_groups = 0;
+    groups_limit = 0;
+    HashTable_init(&external_index);
+
+    ConstantTable_init(&constants); /* No constants yet */
+    LineCache_init(&encoding_memo); /* No statements seen yet */
+    offset_references = NULL;
+    total_offsets = 0;
+    offsets_limit = 0;
 }
 
 void release_passes_memory(struct passes *passes)
 {
+    int id;
+
     free(val_arr); /* Free entry array memory */
     free(labels); /* Free labels memory */
+    HashTable_free(&label_index); /* Free label index */
+    HashTable_free(&entry_index); /* Free entry index */
+
+    for (id = 0; id < total_groups; id++)
+    {
+        free(external_groups[id].addresses); /* Free reference addresses */
+    }
+    free(external_groups); /* Free external symbols */
+    HashTable_free(&external_index);
+    ConstantTable_free(&constants); /* Free constants */
+    free(offset_references); /* Free offset references */
+    LineCache_free(&encoding_memo); /* Free memoized statements */
+
+    if (incremental)
+    {
+        LineCache_free(&line_cache); /* Free statement records */
+        incremental = FALSE;
+    }
+}
+
+static void report_error(
+    int code, 
+    const char *argument, 
+    int column
+)
+{
+    Diagnostics_add(&diagnostics, current_line_number, column, code, argument);
+    total_errors_found++;
+}
+
+static int error_limit_reached(void)
+{
+    return max_errors > 0 && total_errors_found >= max_errors;
 }
 
 static void insert_entry(
@@ -127,26 +228,29 @@ static void insert_entry(
     const char *name
 )
 {
-    int id;
     struct LabelStruct *entry; /* Pointer to new entry */
 
-    for (id = 0; id < total_input; id++)
+    if (statement_record != NULL)
     {
-        if (strcmp(val_arr[id].name, name) == 0)
-        {
-            return; /* Entry already exists */
-        }
+        LineRecord_set_entry(statement_record, name); /* Replayed on later runs */
+    }
+
+    if (!HashTable_insert(&entry_index, name, total_input))
+    {
+        return; /* Entry already exists */
     }
 
     if (total_input == limit)
     {
         limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
         val_arr = realloc(val_arr, sizeof(*val_arr) * limit); /* Resize entry array */
     }
 
     entry = &val_arr[total_input]; /* Point to new entry */
     strcpy(entry->name, name); /* Copy entry name */
     entry->address = 0; /* Initialize address */
+    entry->line_number = current_line_number; /* Reported if the label is missing */
 
     total_input++; /* Increment total entries */
 }
@@ -156,26 +260,24 @@ static int insert_label(
     const char *name
 )
 {
-    int id;
     struct LabelStruct *LabelStruct; /* Pointer to new label */
 
-    for (id = 0; id < total_labels; id++)
+    if (!HashTable_insert(&label_index, name, total_labels))
     {
-        if (strcmp(labels[id].name, name) == 0)
-        {
-            return FALSE; /* Label already exists */
-        }
+        return FALSE; /* Label already exists */
     }
 
     if (total_labels == max_labels)
     {
         max_labels += MEMORY_BLOCK_SIZE; /* Increase max labels */
+        STATS_COUNT(allocations);
         labels = realloc(labels, sizeof(*labels) * max_labels); /* Resize labels array */
     }
 
     LabelStruct = &labels[total_labels]; /* Point to new label */
     strcpy(LabelStruct->name, name); /* Copy label name */
     LabelStruct->address = total_functions; /* Set label address */
+    LabelStruct->line_number = current_line_number;
 
     total_labels++; /* Increment total labels */
     return TRUE; /* Label inserted successfully */
@@ -204,6 +306,20 @@ static int confirm_label(const char *name)
     return TRUE; /* Name is not a valid command or directive */
 }
 
+static int parse_block_count(const char *word)
+{
+    int count;
+    char trailing;
+
+    /* Accept a single positive decimal number only */
+    if (sscanf(word, "%d%c", &count, &trailing) != 1 || count <= 0)
+    {
+        return 0;
+    }
+
+    return count;
+}
+
 static int confirm_guide_keyword(
     struct passes *passes, 
     const char *line,            
@@ -290,6 +406,54 @@ static int confirm_guide_keyword(
         return TRUE; 
     }
 
+    /* Check for reserve block directive */
+    if (strcmp(word, DIRECTIVE_SPACE_RESERVE) == 0)
+    {
+        /* Ensure exactly two words and a positive block size */
+        if (total_words_in_row != 2)
+        {
+            return FALSE;
+        }
+
+        word = get_word_number(line, index_base + 1);
+        return parse_block_count(word) > 0;
+    }
+
+    /* Check for fill block directive */
+    if (strcmp(word, DIRECTIVE_FILL_BLOCK) == 0)
+    {
+        int value;
+        char trailing;
+
+        /* Ensure block size, comma and fill value are present */
+        if (total_words_in_row != 4)
+        {
+            return FALSE;
+        }
+
+        word = get_word_number(line, index_base + 2);
+        if (strcmp(word, SEPARATOR_COMMA) != 0)
+        {
+            return FALSE;
+        }
+
+        word = get_word_number(line, index_base + 3);
+        if (sscanf(word, "%d%c", &value, &trailing) != 1)
+        {
+            return FALSE;
+        }
+
+        word = get_word_number(line, index_base + 1);
+        return parse_block_count(word) > 0;
+    }
+
+    /* Check for constant definition directive */
+    if (strcmp(word, DIRECTIVE_DEFINE) == 0)
+    {
+        /* Ensure a name and a value are present */
+        return total_words_in_row == 3;
+    }
+
     return FALSE; 
 }
 
@@ -419,6 +583,14 @@ static int check_guide_length(
         totalen = strlen(word) - 1; 
     }
 
+    /* Block directives reserve their count without expanding words */
+    if (strcmp(word, DIRECTIVE_SPACE_RESERVE) == 0 ||
+        strcmp(word, DIRECTIVE_FILL_BLOCK) == 0)
+    {
+        word = get_word_number(line, index_base + 1);
+        totalen = parse_block_count(word);
+    }
+
     return totalen; 
 }
 
@@ -488,12 +660,12 @@ static int check_command_length(
 
                 totalen = 1;
 
-                token_a = get_word_number(line_buffer, index_base + 1);
+                token_a = get_word_number(line, index_base + 1);
                 test_indirect = token_a[0] == 'r';
                 test_operand = token_a[0] == '*' && token_a[1] == 'r';
                 test_group1 = test_indirect || test_operand;
 
-                token_b = get_word_number(line_buffer, index_base + 3);
+                token_b = get_word_number(line, index_base + 3);
                 test_indirect_group2 = token_b[0] == 'r';
                 test_operand_group2 = token_b[0] == '*' && token_b[1] == 'r';
                 test_group2 = test_indirect_group2 || test_operand_group2;
@@ -516,6 +688,114 @@ static int check_command_length(
 }
 
 
+/* Split a LABEL+offset operand, FALSE if the operand is a plain name */
+static int split_label_offset(
+    const char *operand,
+    char *name,
+    int *offset
+)
+{
+    int length;
+    int uses_constants;
+
+    length = strcspn(operand, "+-");
+    if (length == 0 || operand[length] == '\0' ||
+        !expression_evaluate(&operand[length], &constants, offset, &uses_constants))
+    {
+        return FALSE;
+    }
+
+    memcpy(name, operand, length);
+    name[length] = '\0';
+    return TRUE;
+}
+
+static void add_offset_reference(const char *name)
+{
+    struct LabelStruct *reference;
+
+    if (total_offsets == offsets_limit)
+    {
+        offsets_limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        offset_references = realloc(offset_references, sizeof(*offset_references) * offsets_limit);
+    }
+
+    reference = &offset_references[total_offsets];
+    strcpy(reference->name, name);
+    reference->address = 0;
+    reference->line_number = current_line_number; /* Reported if the label is missing */
+    total_offsets++;
+}
+
+static void define_constant(
+    const char *line,
+    int index_base
+)
+{
+    char name[TOTAL_LEN];
+    char *word;
+    int value;
+    int uses_constants;
+
+    unstable_statement = TRUE; /* Later statements depend on the value */
+    strcpy(name, get_word_number(line, index_base + 1));
+    if (!expression_is_name(name) || !confirm_label(name))
+    {
+        report_error(DIAG_DUPLICATE_CONSTANT, name, get_word_column(line, index_base + 1));
+        return;
+    }
+
+    word = get_word_number(line, index_base + 2);
+    if (!expression_evaluate(word, &constants, &value, &uses_constants))
+    {
+        report_error(DIAG_INVALID_EXPRESSION, word, get_word_column(line, index_base + 2));
+        return;
+    }
+
+    if (!ConstantTable_define(&constants, name, value))
+    {
+        report_error(DIAG_DUPLICATE_CONSTANT, name, get_word_column(line, index_base + 1));
+    }
+}
+
+/* Fold the immediates and .data values of a statement once to report errors early */
+static void check_expressions(
+    const char *line,
+    int index_base,
+    int total_words
+)
+{
+    char name[TOTAL_LEN];
+    char *word;
+    int is_data;
+    int value;
+    int uses_constants;
+
+    is_data = strcmp(get_word_number(line, index_base), DIRECTIVE_DATA_SECTION) == 0;
+    for (index_base++; total_words > 1; index_base += 2, total_words -= 2)
+    {
+        word = get_word_number(line, index_base);
+        if (is_data || allocate_op_group(word) == IMMEDIATE_GROUP_OPERAND)
+        {
+            if (!expression_evaluate(is_data ? word : &word[1], &constants, &value, &uses_constants))
+            {
+                report_error(DIAG_INVALID_EXPRESSION, word, get_word_column(line, index_base));
+            }
+            unstable_statement = unstable_statement || uses_constants;
+        }
+        else if (allocate_op_group(word) == DIR_GROUP_OPERAND)
+        {
+            symbol_statement = TRUE;
+            if (split_label_offset(word, name, &value))
+            {
+                add_offset_reference(name); /* The label must be defined in this file */
+                unstable_statement = TRUE;
+            }
+        }
+    }
+}
+
 static void process_one_line(
     struct passes *passes, 
     const char *line,            
@@ -548,25 +828,19 @@ static void process_one_line(
             lbl_correct = confirm_label(word);
             if (lbl_correct == FALSE)
             {
-                fprintf(
-                    assembly_file_error,
-                    "There is an error in line number%d: duplicate labels defined \"%s\"\n",
-                    current_line_number,
-                    word);
-                total_errors_found++;
+                report_error(DIAG_DUPLICATE_LABEL, word, get_word_column(line, index_base - 2));
                 continue;
             }
             lbl_diff = insert_label(passes, word);
             if (lbl_diff == FALSE)
             {
-                fprintf(
-                    assembly_file_error,
-                    "There is an error in line number%d: duplicate labels defined \"%s\"\n",
-                    current_line_number,
-                    word);
-                total_errors_found++;
+                report_error(DIAG_DUPLICATE_LABEL, word, get_word_column(line, index_base - 2));
                 continue;
             }
+            if (statement_record != NULL)
+            {
+                LineRecord_add_label(statement_record, word); /* Replayed on later runs */
+            }
         }
         else
         {
@@ -601,21 +875,27 @@ static void process_one_line(
     {
         totalen = check_command_length(passes, line, index_base, total_words);
         total_code_lines += totalen;
+        check_expressions(line, index_base, total_words);
         break;
     }
     case GROUP2_DATA:
     {
         totalen = check_guide_length(passes, line, index_base, total_words);
         total_data_lines += totalen;
+        word = get_word_number(line, index_base);
+        if (strcmp(word, DIRECTIVE_DEFINE) == 0)
+        {
+            define_constant(line, index_base);
+        }
+        else if (strcmp(word, DIRECTIVE_DATA_SECTION) == 0)
+        {
+            check_expressions(line, index_base, total_words);
+        }
         break;
     }
     default:
     {
-        fprintf(
-            assembly_file_error,
-            "There is an error in line number%d: invalid syntax detected\n",
-            current_line_number);
-        total_errors_found++;
+        report_error(DIAG_INVALID_SYNTAX, NULL, get_word_column(line, 0));
         break;
     }
     }
@@ -623,200 +903,1493 @@ static void process_one_line(
     total_functions += totalen; 
 }
 
-int assembler_first_pass(
+static int replay_statement(
     struct passes *passes, 
-    FILE *assembly_fileas,   
-    FILE *assembly_file_output,  
-    FILE *assembly_file_error    
+    struct LineRecord *record
 )
 {
-    int id;
-    int saved_keyword;
-    char *word;
-    int total_words;
-    struct Macro *currently_in_macro_block;      
-    struct Macro *macroPtr;           
-    struct MacrosList macros; 
-
-    current_line_number = 0;
-    total_code_lines = 0;
-    total_data_lines = 0;
-    total_errors_found = 0;
-    currently_in_macro_block = NULL;
+    int item;
 
-    MacrosList_init(&macros); /* Initialize macro list */
-    total_functions = 100; 
-
-    while (fgets(line_buffer, TOTAL_LEN, assembly_fileas) != NULL)
+    /* A label defined again must be reported, so it takes the full path */
+    for (item = 0; item < record->label_count; item++)
     {
-        current_line_number++; /* Increment line number */
-        total_words = total_words_in_row(line_buffer); /* Count words in line */
-
-        if (total_words == 1)
+        if (HashTable_find(&label_index, record->labels[item]) >= 0)
         {
-            word = get_word_number(line_buffer, 0);
-            
-            if (strcmp(word, MACRO_TERMINATION) == 0)
-            {
-                if (currently_in_macro_block == NULL)
-                {
-                    /* Error: endmacro outside macro */
-                    fprintf(
-                        assembly_file_error,
-                        "There is an error in line number%d: \"endmacro keyword\" is outside the macro\n",
-                        current_line_number);
-                    total_errors_found++;
-                    continue;
-                }
-                currently_in_macro_block = NULL; /* End macro block */
-                continue;
-            }
-
-            saved_keyword = FALSE;
+            return FALSE;
+        }
+    }
 
-            for (id = 0; id < MAX_RESERVED_WORD; id++)
-            {
-                if (strcmp(valid_commands[id], word) == 0)
-                {
-                    saved_keyword = TRUE;
-                    break;
-                }
-            }
+    for (item = 0; item < record->label_count; item++)
+    {
+        insert_label(passes, record->labels[item]); /* Label at the current address */
+    }
 
-            if (!saved_keyword)
-            {
-                macroPtr = MacrosList_find(&macros, word);
+    if (record->entry != NULL)
+    {
+        insert_entry(passes, record->entry);
+    }
 
-                if (macroPtr == NULL)
-                {
-                    /* Error: undefined macro usage */
-                    fprintf(
-                        assembly_file_error,
-                        "There is an error in line number%d: undefined macro usage \"%s\"\n",
-                        current_line_number,
-                        word);
-                    total_errors_found++;
-                    continue;
-                }
+    total_code_lines += record->code_size;
+    total_data_lines += record->data_size;
+    total_functions += record->code_size + record->data_size;
+    record->used = TRUE;
+    return TRUE;
+}
 
-                for (id = 0; id < macroPtr->counter_line; id++)
-                {
-                    process_one_line(passes, macroPtr->lines[id], assembly_file_error);
-                    fputs(macroPtr->lines[id], assembly_file_output); 
-                }
-                continue;
-            }
-        }
+/* Key of a statement without its comment and extra blanks, FALSE if it defines labels */
+static int normalize_statement(
+    const char *line,
+    char *key
+)
+{
+    int length;
+    int blank;
 
-        if (total_words == 2)
+    length = 0;
+    blank = FALSE;
+    for (; *line != '\0' && *line != ';'; line++)
+    {
+        if (isspace((unsigned char)*line))
         {
-            word = get_word_number(line_buffer, 0);
-            
-            if (strcmp(word, MACRO_DEFINITION) == 0)
-            {
-                word = get_word_number(line_buffer, 1);
-                currently_in_macro_block = MacrosList_register(&macros, word); 
-
-                if (currently_in_macro_block == NULL)
-                {
-                    /* Error: duplicate macro name */
-                    fprintf(
-                        assembly_file_error,
-                        "There is an error in line number%d: duplicate macro name definition \"%s\"\n",
-                        current_line_number,
-                        word);
-                    total_errors_found++;
-                    continue;
-                }
-                continue;
-            }
+            blank = length > 0; /* Tokens split the same on one blank */
+            continue;
         }
-
-        if (currently_in_macro_block == NULL)
+        if (*line == ':')
         {
-            process_one_line(passes, line_buffer, assembly_file_error); 
-            fputs(line_buffer, assembly_file_output);                                 
+            return FALSE; /* Labels never repeat */
         }
-        else
+        if (blank && *line != ',' && key[length - 1] != ',')
         {
-            Macro_append(currently_in_macro_block, line_buffer); 
+            key[length] = ' ';
+            length++;
         }
+        blank = FALSE;
+        key[length] = *line;
+        length++;
     }
 
-    MacrosList_free(&macros); /* Free macro list */
-
-    return total_errors_found; 
+    key[length] = '\0';
+    return length > 0;
 }
 
-static void generate_objects_output(
-    struct passes *passes, 
-    FILE *output_file_pointer,   
-    int counter,                 
-    int value                    
+/* Record of a statement in the incremental state or the encoding memo, NULL if there is none */
+static struct LineRecord *find_statement_record(
+    const char *line,
+    const char **key
 )
 {
-    /* Print formatted output to file */
-    fprintf(
-        output_file_pointer,
-        "%d %05o\n", 
-        counter,
-        value & 0x7FFF 
-    );
-}
-
-static int parse_register_value(const char *operand)
-{
-    int register_val;
-    register_val = (-1); 
+    struct LineRecord *record;
 
-    /* Check if operand starts with 'r' */
-    if (operand[0] == 'r')
+    if (incremental)
     {
-        sscanf(&operand[1], "%d", &register_val);
+        *key = line;
+        return LineCache_find(&line_cache, line);
     }
 
-    /* Check if operand starts with '*' */
-    if (operand[0] == '*')
+    *key = NULL;
+    if (!normalize_statement(line, memo_key))
     {
-        sscanf(&operand[2], "%d", &register_val);
+        return NULL;
     }
 
-    return register_val; 
+    *key = memo_key;
+    record = LineCache_find(&encoding_memo, memo_key);
+    if (record != NULL)
+    {
+        STATS_COUNT(memo_hits);
+    }
+    return record;
 }
 
-static void out_object_operand_file(
+static void first_pass_line(
     struct passes *passes, 
-    FILE *fileext,       
-    FILE *output_file_pointer,   
-    int counter,                 
-    const char *operand,         
-    int order                    
+    const char *line,            
+    FILE *assembly_file_error    
 )
 {
-    int group;
-    int imd_value;
-    int id;
-    int register_val;
-    int value;
+    struct LineRecord *record;
+    const char *key;
+    int errors;
+    int code_lines;
+    int data_lines;
 
-    group = allocate_op_group(operand); /* Determine operand group */
+    record = find_statement_record(line, &key);
 
-    switch (group)
+    if (record != NULL && !record->failed && replay_statement(passes, record))
     {
-    case IMMEDIATE_GROUP_OPERAND:
-    { 
-        sscanf(&operand[1], "%d", &imd_value); /* Read immediate value */
-        value = (imd_value << 3) | ABSOLUTE_FLAG; /* Prepare value */
-        generate_objects_output(
-            passes,
-            output_file_pointer,
-            counter,
-            value);
-        total_functions++; /* Increment function count */
-        break;
+        return; /* Unchanged statement, nothing to lex */
     }
-    case INDIR_GROUP_OPERAND: 
-    case REGISTER_GROUP_OPERAND:
+
+    if (record != NULL || key == NULL)
+    {
+        process_one_line(passes, line, assembly_file_error);
+        return;
+    }
+
+    /* New statement, keep its results for the second pass and later runs */
+    errors = total_errors_found;
+    code_lines = total_code_lines;
+    data_lines = total_data_lines;
+
+    if (incremental)
+    {
+        statement_record = LineCache_add(&line_cache, key);
+    }
+    unstable_statement = FALSE;
+    symbol_statement = FALSE;
+    process_one_line(passes, line, assembly_file_error);
+
+    if (!incremental)
+    {
+        /* Only words that never change within the run are memoized */
+        if (total_errors_found != errors || unstable_statement || symbol_statement)
+        {
+            return;
+        }
+        statement_record = LineCache_add(&encoding_memo, key);
+    }
+
+    statement_record->code_size = total_code_lines - code_lines;
+    statement_record->data_size = total_data_lines - data_lines;
+    statement_record->failed = total_errors_found != errors || unstable_statement;
+    statement_record = NULL;
+}
+
+static int is_reserved_word(const char *word)
+{
+    int id;
+
+    for (id = 0; id < MAX_RESERVED_WORD; id++)
+    {
+        if (strcmp(valid_commands[id], word) == 0)
+        {
+            return TRUE; /* Word is a command or directive */
+        }
+    }
+
+    return FALSE; 
+}
+
+static struct Macro *define_macro(
+    struct MacrosList *macros, 
+    const char *line,            
+    int total_words,            
+    FILE *assembly_file_error    
+)
+{
+    char *word;
+    int index_base;
+    int params_valid;
+    struct Macro *macroPtr;
+
+    word = get_word_number(line, 1);
+    macroPtr = MacrosList_register(macros, word); 
+
+    if (macroPtr == NULL)
+    {
+        /* Error: duplicate macro name */
+        report_error(DIAG_DUPLICATE_MACRO, word, get_word_column(line, 1));
+        return NULL;
+    }
+
+    /* Parameter names follow the macro name, separated by commas */
+    params_valid = total_words == 2 || total_words % 2 == 1;
+
+    for (index_base = 2; params_valid && index_base < total_words; index_base += 2)
+    {
+        if (index_base > 2)
+        {
+            word = get_word_number(line, index_base - 1);
+            if (strcmp(word, SEPARATOR_COMMA) != 0)
+            {
+                params_valid = FALSE;
+                break;
+            }
+        }
+
+        word = get_word_number(line, index_base);
+        params_valid = isalpha((unsigned char)word[0]) && !is_reserved_word(word);
+        params_valid = params_valid && Macro_add_parameter(macroPtr, word);
+    }
+
+    if (!params_valid)
+    {
+        /* Error: the body still belongs to this macro */
+        report_error(DIAG_MACRO_PARAMETERS, macroPtr->name, get_word_column(line, 1));
+    }
+
+    return macroPtr; 
+}
+
+static int parse_macro_library(
+    struct MacrosList *macros,   
+    FILE *library_file,          
+    FILE *assembly_file_error    
+)
+{
+    char library_line[TOTAL_LEN];
+    char *word;
+    int total_words;
+    int errors;
+    int include_line_number;
+    struct Macro *currently_in_macro_block;
+
+    /* Errors inside the library point at its own lines */
+    include_line_number = current_line_number;
+    current_line_number = 0;
+    errors = total_errors_found;
+    currently_in_macro_block = NULL;
+
+    while (!error_limit_reached() && fgets(library_line, TOTAL_LEN, library_file) != NULL)
+    {
+        current_line_number++; /* Increment line number */
+        total_words = total_words_in_row(library_line);
+        word = get_word_number(library_line, 0);
+
+        if (currently_in_macro_block != NULL)
+        {
+            if (total_words == 1 && strcmp(word, MACRO_TERMINATION) == 0)
+            {
+                Macro_compile(currently_in_macro_block); /* Body is complete */
+                currently_in_macro_block = NULL;
+                continue;
+            }
+            Macro_append(currently_in_macro_block, library_line);
+            continue;
+        }
+
+        if (total_words == 0)
+        {
+            continue; /* Blank and comment lines */
+        }
+
+        if (total_words >= 2 && strcmp(word, MACRO_DEFINITION) == 0)
+        {
+            currently_in_macro_block = define_macro(
+                macros,
+                library_line,
+                total_words,
+                assembly_file_error);
+            continue;
+        }
+
+        /* Error: libraries hold macro definitions only */
+        report_error(DIAG_LIBRARY_CONTENT, NULL, get_word_column(library_line, 0));
+    }
+
+    if (currently_in_macro_block != NULL)
+    {
+        Macro_compile(currently_in_macro_block); /* Body runs to the end of the file */
+    }
+
+    current_line_number = include_line_number;
+    return total_errors_found == errors;
+}
+
+static void include_macro_library(
+    struct MacrosList *macros,   
+    const char *line,            
+    FILE *assembly_file_error    
+)
+{
+    char path[MAX_PATH_LEN];
+    char *word;
+    int length;
+    int id;
+    FILE *library_file;
+    struct Macro *macroPtr;
+    struct MacroLibrary *library;
+
+    word = get_word_number(line, 1);
+    length = strlen(word);
+    if (length < 3 || word[0] != '"' || word[length - 1] != '"')
+    {
+        /* Error: the file name must be quoted */
+        report_error(DIAG_INCLUDE_NAME, word, get_word_column(line, 1));
+        return;
+    }
+    memcpy(path, &word[1], length - 2);
+    path[length - 2] = '\0';
+
+    /* Each library is read once per run and shared by every unit */
+    library = MacroLibrary_find(path);
+    if (library == NULL)
+    {
+        library = MacroLibrary_add(path);
+        if (MacroLibrary_is_precompiled(path))
+        {
+            library->failed = !MacroLibrary_map(library);
+        }
+        else if ((library_file = fopen(path, "r")) != NULL)
+        {
+            library->failed = !parse_macro_library(&library->macros, library_file, assembly_file_error);
+            fclose(library_file);
+        }
+        else
+        {
+            library->failed = TRUE;
+        }
+    }
+
+    if (library->failed)
+    {
+        /* Error: missing or invalid library */
+        report_error(DIAG_INCLUDE_FAILED, path, get_word_column(line, 1));
+        return;
+    }
+
+    for (id = 0; id < library->macros.macro_count; id++)
+    {
+        macroPtr = MacrosList_register(macros, library->macros.macros[id]->name);
+        if (macroPtr == NULL)
+        {
+            /* Error: duplicate macro name */
+            report_error(DIAG_DUPLICATE_MACRO, library->macros.macros[id]->name, get_word_column(line, 0));
+            continue;
+        }
+        Macro_borrow(macroPtr, library->macros.macros[id]);
+    }
+}
+
+static struct Macro *find_macro_call(
+    struct MacrosList *macros, 
+    const char *line,            
+    int total_words             
+)
+{
+    char *word;
+
+    if (macros->macro_count == 0)
+    {
+        return NULL; /* Nothing to call */
+    }
+
+    if (total_words >= 2)
+    {
+        word = get_word_number(line, 1);
+        if (strcmp(word, LABEL_DEFINITION_SEPARATOR) == 0)
+        {
+            return NULL; /* Line starts with a label */
+        }
+    }
+
+    word = get_word_number(line, 0);
+    if (is_reserved_word(word))
+    {
+        return NULL; 
+    }
+
+    return MacrosList_find(macros, word); 
+}
+
+static char **collect_macro_args(
+    struct Macro *macroPtr,      
+    const char *line,            
+    int total_words,            
+    FILE *assembly_file_error    
+)
+{
+    int id;
+    int arg_count;
+    char *word;
+    char **args;
+
+    /* Arguments follow the macro name, separated by commas */
+    arg_count = total_words / 2;
+    if (total_words != 1 && total_words % 2 != 0)
+    {
+        arg_count = -1;
+    }
+
+    for (id = 1; id < arg_count; id++)
+    {
+        word = get_word_number(line, 2 * id);
+        if (strcmp(word, SEPARATOR_COMMA) != 0)
+        {
+            arg_count = -1;
+            break;
+        }
+    }
+
+    if (arg_count != macroPtr->param_count)
+    {
+        /* Error: arguments do not match the parameters */
+        report_error(DIAG_MACRO_ARGUMENTS, macroPtr->name, get_word_column(line, 0));
+        return NULL;
+    }
+
+    STATS_COUNT(allocations);
+    args = malloc(sizeof(*args) * (arg_count + 1)); /* Allocate argument array */
+    for (id = 0; id < arg_count; id++)
+    {
+        word = get_word_number(line, 2 * id + 1);
+        STATS_COUNT(allocations);
+        args[id] = malloc(strlen(word) + 1); /* Allocate memory for argument */
+        strcpy(args[id], word); /* Copy the argument */
+    }
+
+    return args; 
+}
+
+static void free_macro_args(
+    char **args,                 
+    int arg_count               
+)
+{
+    int id;
+
+    for (id = 0; id < arg_count; id++)
+    {
+        free(args[id]); /* Free each argument */
+    }
+    free(args); /* Free argument array */
+}
+
+static void expansion_append(
+    struct ExpansionBuffer *expansion, 
+    const char *text,            
+    int length                  
+)
+{
+    while (expansion->length + length > expansion->limit)
+    {
+        expansion->limit += TOTAL_LEN; /* Increase buffer limit */
+        STATS_COUNT(allocations);
+        expansion->data = realloc(expansion->data, expansion->limit); /* Reallocate memory */
+    }
+    memcpy(&expansion->data[expansion->length], text, length); /* Copy the text */
+    expansion->length += length;
+}
+
+static int flatten_macro(
+    struct MacrosList *macros,   
+    struct Macro *macroPtr,      
+    char **args,                 
+    struct ExpansionBuffer *expansion, 
+    int column,
+    FILE *assembly_file_error    
+)
+{
+    int length;
+    int start;
+    int total_words;
+    int flattened;
+    char *body;
+    char *body_line;
+    char **inner_args;
+    struct Macro *inner;
+
+    /* Calls without arguments always flatten to the same text */
+    if (macroPtr->flat_body != NULL)
+    {
+        expansion_append(expansion, macroPtr->flat_body, macroPtr->flat_length);
+        return TRUE;
+    }
+
+    if (macroPtr->state != MACRO_STATE_READY)
+    {
+        /* Error: the macro is already being expanded */
+        report_error(DIAG_RECURSIVE_MACRO, macroPtr->name, DIAG_NO_COLUMN);
+        macroPtr->state = MACRO_STATE_RECURSIVE;
+        return FALSE;
+    }
+
+    macroPtr->state = MACRO_STATE_EXPANDING;
+    flattened = TRUE;
+    start = expansion->length;
+    body = Macro_expand(macroPtr, args, &length); 
+
+    /* Copy each body line, expanding the lines that call macros */
+    for (body_line = body; flattened && body_line < body + length; body_line += strlen(body_line) + 1)
+    {
+        if (strlen(body_line) >= TOTAL_LEN)
+        {
+            /* Error: the line would not fit the token and line buffers of either pass */
+            report_error(DIAG_LONG_EXPANSION, macroPtr->name, column);
+            flattened = FALSE;
+            break;
+        }
+
+        total_words = total_words_in_row(body_line);
+        inner = find_macro_call(macros, body_line, total_words);
+
+        if (inner == NULL)
+        {
+            expansion_append(expansion, body_line, strlen(body_line) + 1);
+            continue;
+        }
+
+        inner_args = collect_macro_args(inner, body_line, total_words, assembly_file_error);
+        if (inner_args == NULL)
+        {
+            flattened = FALSE;
+            break;
+        }
+        flattened = flatten_macro(macros, inner, inner_args, expansion, column, assembly_file_error);
+        free_macro_args(inner_args, inner->param_count);
+    }
+
+    free(body); /* Free expanded body */
+
+    if (macroPtr->state == MACRO_STATE_EXPANDING)
+    {
+        macroPtr->state = MACRO_STATE_READY; /* Expansion is complete */
+    }
+
+    if (flattened && macroPtr->param_count == 0)
+    {
+        Macro_memoize(macroPtr, &expansion->data[start], expansion->length - start);
+    }
+
+    return flattened; 
+}
+
+static int is_plain_register(const char *operand)
+{
+    return operand[0] == 'r' && operand[1] >= '0' && operand[1] <= '7' && operand[2] == '\0';
+}
+
+/* Check whether a statement defines a label */
+static int defines_label(
+    const char *line,
+    const char *name
+)
+{
+    int total_words;
+    int index_base;
+
+    total_words = total_words_in_row(line);
+    for (index_base = 0; index_base + 1 < total_words; index_base += 2)
+    {
+        if (strcmp(get_word_number(line, index_base + 1), LABEL_DEFINITION_SEPARATOR) != 0)
+        {
+            break;
+        }
+        if (strcmp(get_word_number(line, index_base), name) == 0)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Number of tokens taken by the labels at the start of a statement */
+static int skip_labels(
+    const char *line,
+    int total_words
+)
+{
+    int index_base;
+
+    index_base = 0;
+    while (index_base + 1 < total_words &&
+           strcmp(get_word_number(line, index_base + 1), LABEL_DEFINITION_SEPARATOR) == 0)
+    {
+        index_base += 2;
+    }
+    return index_base;
+}
+
+/* Check whether a statement replaces the flags before anything can read them */
+static int overwrites_flags(const char *line)
+{
+    static const char *const commands[] = {"cmp", "add", "sub", "clr", "not", "inc", "dec", "stop"};
+    const char *command;
+    int total_words;
+    int id;
+
+    total_words = total_words_in_row(line);
+    command = get_word_number(line, skip_labels(line, total_words));
+    for (id = 0; id < (int)(sizeof(commands) / sizeof(commands[0])); id++)
+    {
+        if (strcmp(command, commands[id]) == 0)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Shorter form of a statement, the line itself if there is none and NULL if it does nothing,
+   a held statement is only rewritten once the next one shows it is safe */
+static const char *optimize_statement(
+    const char *line,
+    int *hold
+)
+{
+    char command[TOTAL_LEN];
+    char source[TOTAL_LEN];
+    char target[TOTAL_LEN];
+    const char *shorter;
+    int total_words;
+    int index_base;
+    int id;
+
+    *hold = HOLD_NONE;
+    total_words = total_words_in_row(line);
+    index_base = skip_labels(line, total_words);
+
+    strcpy(command, get_word_number(line, index_base));
+
+    /* A jump may go to the statement right after it, which is only known later */
+    if (index_base == 0 && total_words == 2 &&
+        (strcmp(command, "jmp") == 0 || strcmp(command, "bne") == 0))
+    {
+        strcpy(target, get_word_number(line, 1));
+        if (allocate_op_group(target) == DIR_GROUP_OPERAND)
+        {
+            strcpy(pending_target, target);
+            *hold = HOLD_JUMP;
+        }
+        return line;
+    }
+
+    if (total_words - index_base != 4 ||
+        strcmp(get_word_number(line, index_base + 2), SEPARATOR_COMMA) != 0)
+    {
+        return line;
+    }
+    strcpy(source, get_word_number(line, index_base + 1));
+    strcpy(target, get_word_number(line, index_base + 3));
+
+    /* Copying a register to itself, a label still needs the statement */
+    if (strcmp(command, "mov") == 0 && is_plain_register(source) && strcmp(source, target) == 0)
+    {
+        return index_base == 0 ? NULL : line;
+    }
+
+    /* Immediate operands take a word of their own, one operand commands do not need it.
+       Unlike mov, clr sets the flags, so a bne could tell them apart */
+    shorter = NULL;
+    if (strcmp(command, "mov") == 0 && strcmp(source, "#0") == 0)
+    {
+        shorter = "clr";
+        *hold = HOLD_CLEAR;
+    }
+    else if ((strcmp(command, "add") == 0 && strcmp(source, "#1") == 0) ||
+             (strcmp(command, "sub") == 0 && strcmp(source, "#-1") == 0))
+    {
+        shorter = "inc";
+    }
+    else if ((strcmp(command, "sub") == 0 && strcmp(source, "#1") == 0) ||
+             (strcmp(command, "add") == 0 && strcmp(source, "#-1") == 0))
+    {
+        shorter = "dec";
+    }
+    if (shorter == NULL || allocate_op_group(target) == IMMEDIATE_GROUP_OPERAND)
+    {
+        *hold = HOLD_NONE;
+        return line;
+    }
+
+    /* Keep the indentation of the statement */
+    id = strspn(line, " \t");
+    memcpy(rewritten_line, line, id);
+    rewritten_line[id] = '\0';
+    for (id = 0; id < index_base; id += 2)
+    {
+        strcat(rewritten_line, get_word_number(line, id));
+        strcat(rewritten_line, LABEL_DEFINITION_SEPARATOR " ");
+    }
+    strcat(rewritten_line, shorter);
+    strcat(rewritten_line, " ");
+    strcat(rewritten_line, target);
+    strcat(rewritten_line, "\n");
+    return strlen(rewritten_line) < TOTAL_LEN ? rewritten_line : line;
+}
+
+/* Run the first pass on a statement, or keep it until the reference graph is complete */
+static void pass_statement(
+    struct passes *passes,
+    const char *line,
+    FILE *assembly_file_output,
+    FILE *assembly_file_error
+)
+{
+    struct HeldStatement *statement;
+
+    if (!strip_unused)
+    {
+        first_pass_line(passes, line, assembly_file_error);
+        fputs(line, assembly_file_output);
+        return;
+    }
+
+    if (total_held == held_limit)
+    {
+        held_limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        held_statements = realloc(held_statements, sizeof(*held_statements) * held_limit);
+    }
+    statement = &held_statements[total_held];
+    statement->offset = held_text.length;
+    statement->line_number = current_line_number;
+    statement->block = 0;
+    total_held++;
+    expansion_append(&held_text, line, strlen(line) + 1);
+}
+
+/* Check whether a statement takes no memory, only .entry, .extern and .define do that */
+static int is_symbol_directive(const char *command)
+{
+    return strcmp(command, DIRECTIVE_ENTRY_POINT) == 0 ||
+           strcmp(command, DIRECTIVE_EXTERNAL_REFERENCE) == 0 ||
+           strcmp(command, DIRECTIVE_DEFINE) == 0;
+}
+
+static void mark_block(
+    int block,
+    char *reachable,
+    int *worklist,
+    int *total_work
+)
+{
+    if (block >= 0 && !reachable[block])
+    {
+        reachable[block] = TRUE;
+        worklist[*total_work] = block;
+        (*total_work)++;
+    }
+}
+
+/* Count entries and labels with an offset that no statement defined, reporting them if asked */
+static int check_undefined_symbols(int report)
+{
+    int id;
+    int undefined;
+
+    undefined = 0;
+    for (id = 0; id < total_input && !error_limit_reached(); id++)
+    {
+        if (HashTable_find(&label_index, val_arr[id].name) < 0)
+        {
+            undefined++;
+            if (report)
+            {
+                Diagnostics_add(
+                    &diagnostics,
+                    val_arr[id].line_number,
+                    DIAG_NO_COLUMN,
+                    DIAG_UNDEFINED_ENTRY,
+                    val_arr[id].name);
+                total_errors_found++;
+            }
+        }
+    }
+
+    /* An offset cannot be added to an external address */
+    for (id = 0; id < total_offsets && !error_limit_reached(); id++)
+    {
+        if (HashTable_find(&label_index, offset_references[id].name) < 0)
+        {
+            undefined++;
+            if (report)
+            {
+                Diagnostics_add(
+                    &diagnostics,
+                    offset_references[id].line_number,
+                    DIAG_NO_COLUMN,
+                    DIAG_UNDEFINED_OFFSET_LABEL,
+                    offset_references[id].name);
+                total_errors_found++;
+            }
+        }
+    }
+
+    return undefined;
+}
+
+/* Forget the labels, entries, constants and sizes found so far, so statements can be passed again */
+static void reset_first_pass(void)
+{
+    total_labels = 0;
+    HashTable_free(&label_index);
+    HashTable_init(&label_index);
+    total_input = 0;
+    HashTable_free(&entry_index);
+    HashTable_init(&entry_index);
+    ConstantTable_free(&constants);
+    ConstantTable_init(&constants);
+    total_offsets = 0;
+    total_functions = base_address;
+    total_code_lines = 0;
+    total_data_lines = 0;
+}
+
+/* Pass the statements of reachable blocks to the first pass, a block runs from one label to the next */
+static void strip_unused_statements(
+    struct passes *passes,
+    FILE *assembly_file_output,
+    FILE *assembly_file_error
+)
+{
+    struct HashTable label_blocks;
+    char command[TOTAL_LEN];
+    char name[TOTAL_LEN];
+    const char *line;
+    char *reachable;
+    int *block_starts;
+    int *worklist;
+    int total_work;
+    int total_blocks;
+    int total_words;
+    int index_base;
+    int root;
+    int falls_through;
+    int block;
+    int id;
+    int operand;
+    int offset;
+    int line_number;
+
+    /* Every statement is checked first, a program with errors is reported and kept whole */
+    line_number = current_line_number;
+    for (id = 0; id < total_held && !error_limit_reached(); id++)
+    {
+        line = &held_text.data[held_statements[id].offset];
+        current_line_number = held_statements[id].line_number;
+        first_pass_line(passes, line, assembly_file_error);
+    }
+    current_line_number = line_number;
+    if (total_errors_found > 0 || check_undefined_symbols(FALSE) > 0)
+    {
+        for (id = 0; id < total_held; id++)
+        {
+            fputs(&held_text.data[held_statements[id].offset], assembly_file_output);
+        }
+        free(held_statements);
+        free(held_text.data);
+        held_statements = NULL;
+        held_text.data = NULL;
+        return;
+    }
+
+    /* Only statements of reachable blocks are passed again, and only they reach the output */
+    reset_first_pass();
+
+    /* Blocks and the labels that name them */
+    HashTable_init(&label_blocks);
+    block_starts = malloc(sizeof(*block_starts) * (total_held + 1));
+    block_starts[0] = 0;
+    total_blocks = 1;
+    root = -1;
+    for (id = 0; id < total_held; id++)
+    {
+        line = &held_text.data[held_statements[id].offset];
+        total_words = total_words_in_row(line);
+        index_base = skip_labels(line, total_words);
+        if (index_base > 0)
+        {
+            block_starts[total_blocks] = id;
+            total_blocks++;
+        }
+        for (operand = 0; operand < index_base; operand += 2)
+        {
+            HashTable_insert(&label_blocks, get_word_number(line, operand), total_blocks - 1);
+        }
+        held_statements[id].block = total_blocks - 1;
+
+        /* Execution starts at the first word */
+        if (root < 0 && total_words > index_base && !is_symbol_directive(get_word_number(line, index_base)))
+        {
+            root = total_blocks - 1;
+        }
+    }
+    block_starts[total_blocks] = total_held;
+
+    reachable = calloc(total_blocks, 1);
+    worklist = malloc(sizeof(*worklist) * total_blocks);
+    total_work = 0;
+    mark_block(root, reachable, worklist, &total_work);
+
+    /* Exported labels are used from other units */
+    for (id = 0; id < total_held; id++)
+    {
+        line = &held_text.data[held_statements[id].offset];
+        total_words = total_words_in_row(line);
+        index_base = skip_labels(line, total_words);
+        if (index_base + 2 == total_words && strcmp(get_word_number(line, index_base), DIRECTIVE_ENTRY_POINT) == 0)
+        {
+            mark_block(HashTable_find(&label_blocks, get_word_number(line, index_base + 1)), reachable, worklist, &total_work);
+        }
+    }
+
+    while (total_work > 0)
+    {
+        total_work--;
+        block = worklist[total_work];
+        falls_through = TRUE; /* A block of bare labels runs into the next */
+        for (id = block_starts[block]; id < block_starts[block + 1]; id++)
+        {
+            line = &held_text.data[held_statements[id].offset];
+            total_words = total_words_in_row(line);
+            index_base = skip_labels(line, total_words);
+            if (total_words == index_base)
+            {
+                continue;
+            }
+            strcpy(command, get_word_number(line, index_base));
+            if (is_symbol_directive(command))
+            {
+                continue;
+            }
+
+            /* Data never runs into the next block, and neither does a jump */
+            falls_through = command[0] != '.' && strcmp(command, "stop") != 0 &&
+                            strcmp(command, "rts") != 0 && strcmp(command, "jmp") != 0;
+            if (command[0] == '.')
+            {
+                continue;
+            }
+
+            for (operand = index_base + 1; operand < total_words; operand += 2)
+            {
+                strcpy(command, get_word_number(line, operand));
+                if (allocate_op_group(command) != DIR_GROUP_OPERAND)
+                {
+                    continue;
+                }
+                if (!split_label_offset(command, name, &offset))
+                {
+                    strcpy(name, command); /* Plain label, not LABEL+offset */
+                }
+                mark_block(HashTable_find(&label_blocks, name), reachable, worklist, &total_work);
+            }
+        }
+        if (falls_through && block + 1 < total_blocks)
+        {
+            mark_block(block + 1, reachable, worklist, &total_work);
+        }
+    }
+
+    line_number = current_line_number;
+    for (id = 0; id < total_held && !error_limit_reached(); id++)
+    {
+        line = &held_text.data[held_statements[id].offset];
+        total_words = total_words_in_row(line);
+        index_base = skip_labels(line, total_words);
+        if (reachable[held_statements[id].block] ||
+            (total_words > index_base && is_symbol_directive(get_word_number(line, index_base))))
+        {
+            current_line_number = held_statements[id].line_number;
+            first_pass_line(passes, line, assembly_file_error);
+            fputs(line, assembly_file_output);
+        }
+    }
+    current_line_number = line_number;
+
+    HashTable_free(&label_blocks);
+    free(block_starts);
+    free(reachable);
+    free(worklist);
+    free(held_statements);
+    free(held_text.data);
+    held_statements = NULL;
+    held_text.data = NULL;
+}
+
+/* Pass the held statement to the first pass, reported under its own line number */
+static void flush_pending_statement(
+    struct passes *passes,
+    FILE *assembly_file_output,
+    FILE *assembly_file_error
+)
+{
+    int line_number;
+
+    if (pending_statement[0] == '\0')
+    {
+        return;
+    }
+
+    line_number = current_line_number;
+    current_line_number = pending_line_number;
+    pass_statement(passes, pending_statement, assembly_file_output, assembly_file_error);
+    current_line_number = line_number;
+    pending_statement[0] = '\0';
+}
+
+/* Run the first pass on a statement and write it to the .am file */
+static void emit_statement(
+    struct passes *passes,
+    const char *line,
+    FILE *assembly_file_output,
+    FILE *assembly_file_error
+)
+{
+    const char *statement;
+    int hold;
+
+    if (!optimize || total_words_in_row(line) == 0)
+    {
+        pass_statement(passes, line, assembly_file_output, assembly_file_error);
+        return;
+    }
+
+    if (pending_statement[0] != '\0' && pending_hold == HOLD_JUMP && defines_label(line, pending_target))
+    {
+        pending_statement[0] = '\0'; /* Jump to the next statement */
+    }
+    else if (pending_statement[0] != '\0' && pending_hold == HOLD_CLEAR && overwrites_flags(line))
+    {
+        strcpy(pending_statement, pending_clear); /* Flags of the clr are never read */
+    }
+    flush_pending_statement(passes, assembly_file_output, assembly_file_error);
+
+    statement = optimize_statement(line, &hold);
+    if (hold != HOLD_NONE)
+    {
+        strcpy(pending_statement, line);
+        if (hold == HOLD_CLEAR)
+        {
+            strcpy(pending_clear, statement);
+        }
+        pending_hold = hold;
+        pending_line_number = current_line_number;
+        return;
+    }
+    if (statement != NULL)
+    {
+        pass_statement(passes, statement, assembly_file_output, assembly_file_error);
+    }
+}
+
+static void expand_macro_call(
+    struct passes *passes, 
+    struct MacrosList *macros,   
+    struct Macro *macroPtr,      
+    const char *line,            
+    int total_words,            
+    struct ExpansionBuffer *expansion, 
+    FILE *assembly_file_output,  
+    FILE *assembly_file_error    
+)
+{
+    char **args;
+    char *body_line;
+    int flattened;
+
+    args = collect_macro_args(macroPtr, line, total_words, assembly_file_error);
+    if (args == NULL)
+    {
+        return;
+    }
+
+    STATS_PHASE_BEGIN(STATS_PHASE_MACROS);
+    TRACE_BEGIN(TRACE_MACROS);
+    expansion->length = 0;
+    flattened = flatten_macro(
+        macros,
+        macroPtr,
+        args,
+        expansion,
+        get_word_column(line, 0),
+        assembly_file_error);
+    free_macro_args(args, macroPtr->param_count);
+    TRACE_END(TRACE_MACROS);
+    STATS_PHASE_END(STATS_PHASE_MACROS);
+
+    if (!flattened)
+    {
+        return;
+    }
+
+    /* Replay each expanded line, lines are separated by NUL characters */
+    for (body_line = expansion->data;
+         body_line < expansion->data + expansion->length && !error_limit_reached();
+         body_line += strlen(body_line) + 1)
+    {
+        emit_statement(passes, body_line, assembly_file_output, assembly_file_error);
+    }
+}
+
+int assembler_first_pass(
+    struct passes *passes, 
+    FILE *assembly_fileas,   
+    FILE *assembly_file_output,  
+    FILE *assembly_file_error    
+)
+{
+    char *word;
+    int total_words;
+    struct Macro *currently_in_macro_block;      
+    struct Macro *macroPtr;           
+    struct MacrosList macros; 
+    struct ExpansionBuffer expansion; 
+
+    current_line_number = 0;
+    total_code_lines = 0;
+    total_data_lines = 0;
+    total_errors_found = 0;
+    currently_in_macro_block = NULL;
+
+    MacrosList_init(&macros); /* Initialize macro list */
+    expansion.data = NULL; /* No expansion yet */
+    expansion.length = 0;
+    expansion.limit = 0;
+    base_address = passes->base_address;
+    total_functions = base_address; 
+    max_errors = passes->max_errors;
+    optimize = passes->optimize;
+    pending_statement[0] = '\0'; /* No statement held back yet */
+    strip_unused = passes->strip_unused;
+    held_text.length = 0;
+    held_text.limit = 0;
+    total_held = 0;
+    held_limit = 0;
+    Diagnostics_init(&diagnostics, assembly_file_error); /* Errors are printed in batches */
+
+    if (passes->state_path[0] != '\0')
+    {
+        LineCache_init(&line_cache); /* Results of the previous run, if any */
+        LineCache_load(&line_cache, passes->state_path);
+        incremental = TRUE;
+    }
+
+    while (!error_limit_reached() && fgets(line_buffer, TOTAL_LEN, assembly_fileas) != NULL)
+    {
+        current_line_number++; /* Increment line number */
+
+        /* Without macros or rewriting an unchanged statement needs no tokens at all */
+        if (incremental && !optimize && !strip_unused && macros.macro_count == 0 && currently_in_macro_block == NULL)
+        {
+            struct LineRecord *record;
+            record = LineCache_find(&line_cache, line_buffer);
+            if (record != NULL && !record->failed && replay_statement(passes, record))
+            {
+                fputs(line_buffer, assembly_file_output);
+                continue;
+            }
+        }
+
+        total_words = total_words_in_row(line_buffer); /* Count words in line */
+        word = get_word_number(line_buffer, 0);
+
+        if (currently_in_macro_block != NULL)
+        {
+            if (total_words == 1 && strcmp(word, MACRO_TERMINATION) == 0)
+            {
+                Macro_compile(currently_in_macro_block); /* Body is complete */
+                currently_in_macro_block = NULL; /* End macro block */
+                continue;
+            }
+            Macro_append(currently_in_macro_block, line_buffer); 
+            continue;
+        }
+
+        if (total_words == 1 && strcmp(word, MACRO_TERMINATION) == 0)
+        {
+            /* Error: endmacro outside macro */
+            report_error(DIAG_ENDMACR_OUTSIDE, NULL, get_word_column(line_buffer, 0));
+            continue;
+        }
+
+        if (total_words >= 2 && strcmp(word, MACRO_DEFINITION) == 0)
+        {
+            currently_in_macro_block = define_macro(
+                &macros,
+                line_buffer,
+                total_words,
+                assembly_file_error); 
+            continue;
+        }
+
+        if (total_words == 2 && strcmp(word, DIRECTIVE_INCLUDE) == 0)
+        {
+            include_macro_library(&macros, line_buffer, assembly_file_error);
+            continue;
+        }
+
+        macroPtr = find_macro_call(&macros, line_buffer, total_words);
+
+        if (macroPtr != NULL)
+        {
+            expand_macro_call(
+                passes,
+                &macros,
+                macroPtr,
+                line_buffer,
+                total_words,
+                &expansion,
+                assembly_file_output,
+                assembly_file_error);
+            continue;
+        }
+
+        word = get_word_number(line_buffer, 0);
+
+        if (total_words == 1 && !is_reserved_word(word))
+        {
+            /* Error: undefined macro usage */
+            report_error(DIAG_UNDEFINED_MACRO, word, get_word_column(line_buffer, 0));
+            continue;
+        }
+
+        emit_statement(passes, line_buffer, assembly_file_output, assembly_file_error);
+    }
+    STATS_ADD(lines, current_line_number); /* Counted once, not per line */
+    flush_pending_statement(passes, assembly_file_output, assembly_file_error);
+    if (strip_unused)
+    {
+        strip_unused_statements(passes, assembly_file_output, assembly_file_error);
+    }
+
+    /* A moved program must still be addressable, the default base keeps its old behaviour */
+    if (base_address != LOAD_BASE_ADDRESS && base_address + total_code_lines + total_data_lines > ISA_VALUE_MASK + 1)
+    {
+        sprintf(line_buffer, "%d", base_address);
+        report_error(DIAG_BASE_OUT_OF_RANGE, line_buffer, DIAG_NO_COLUMN);
+    }
+
+    MacrosList_free(&macros); /* Free macro list */
+    free(expansion.data); /* Free expansion buffer */
+
+    /* Every label is known once the whole file was read */
+    check_undefined_symbols(TRUE);
+
+    Diagnostics_flush(&diagnostics); /* Print errors of the whole pass */
+    Diagnostics_free(&diagnostics);
+    if (error_limit_reached())
+    {
+        fprintf(assembly_file_error, "Stopped after %d errors\n", total_errors_found);
+    }
+
+    return total_errors_found; 
+}
+
+int assembler_precompile(
+    struct passes *passes, 
+    FILE *library_file,          
+    const char *library_path,    
+    FILE *assembly_file_error    
+)
+{
+    int parsed;
+    struct MacrosList macros;
+
+    current_line_number = 0;
+    total_errors_found = 0;
+    max_errors = passes->max_errors;
+    Diagnostics_init(&diagnostics, assembly_file_error); /* Errors are printed in batches */
+    MacrosList_init(&macros); /* Initialize macro list */
+
+    parsed = parse_macro_library(&macros, library_file, assembly_file_error);
+    Diagnostics_flush(&diagnostics); /* Print errors of the library */
+    Diagnostics_free(&diagnostics);
+
+    if (parsed && !MacroLibrary_save(&macros, library_path))
+    {
+        fprintf(assembly_file_error, "Cannot write file \"%s\"\n", library_path);
+        total_errors_found++;
+    }
+
+    MacrosList_free(&macros); /* Free macro list */
+    return total_errors_found; 
+}
+
+static void generate_objects_output(
+    struct passes *passes, 
+    FILE *output_file_pointer,   
+    int counter,                 
+    int value                    
+)
+{
+    /* Print formatted output to file */
+    fprintf(
+        output_file_pointer,
+        "%d %05o\n", 
+        counter,
+        value & ISA_WORD_MASK 
+    );
+
+    if (encoding_record != NULL)
+    {
+        LineRecord_add_word(encoding_record, value, encoding_symbol); /* Replayed on later runs */
+    }
+    encoding_symbol = NULL;
+}
+
+static int parse_register_value(const char *operand)
+{
+    int register_val;
+    register_val = (-1); 
+
+    /* Check if operand starts with 'r' */
+    if (operand[0] == 'r')
+    {
+        sscanf(&operand[1], "%d", &register_val);
+    }
+
+    /* Check if operand starts with '*' */
+    if (operand[0] == '*')
+    {
+        sscanf(&operand[2], "%d", &register_val);
+    }
+
+    return register_val; 
+}
+
+static void add_external_reference(
+    const char *name, 
+    int counter
+)
+{
+    int id;
+    struct ExternalGroup *group;
+
+    id = HashTable_find(&external_index, name);
+    if (id < 0)
+    {
+        if (total_groups == groups_limit)
+        {
+            groups_limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+            STATS_COUNT(allocations);
+            external_groups = realloc(external_groups, sizeof(*external_groups) * groups_limit);
+        }
+
+        id = total_groups;
+        group = &external_groups[id];
+        strcpy(group->name, name); /* Copy external name */
+        group->addresses = NULL;
+        group->count = 0;
+        group->limit = 0;
+        HashTable_insert(&external_index, name, id);
+        total_groups++;
+    }
+
+    group = &external_groups[id];
+    if (group->count == group->limit)
+    {
+        group->limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        group->addresses = realloc(group->addresses, sizeof(*group->addresses) * group->limit);
+    }
+
+    /* Words are encoded in address order, so the list stays sorted */
+    group->addresses[group->count] = counter;
+    group->count++;
+}
+
+static void generate_externals_output(FILE *fileext)
+{
+    int id;
+    int item;
+    struct ExternalGroup *group;
+
+    for (id = 0; id < total_groups; id++)
+    {
+        group = &external_groups[id];
+        fprintf(fileext, "%s", group->name);
+        for (item = 0; item < group->count; item++)
+        {
+            fprintf(fileext, " %04d", group->addresses[item]);
+        }
+        fprintf(fileext, "\n");
+    }
+}
+
+static void encode_label_reference(
+    struct passes *passes, 
+    FILE *fileext,       
+    FILE *output_file_pointer,   
+    int counter,                 
+    const char *operand          
+)
+{
+    char name[TOTAL_LEN];
+    int id;
+    int value;
+    int offset;
+    struct LabelStruct *LabelStruct;
+
+    LabelStruct = NULL;
+    id = -1;
+    if (split_label_offset(operand, name, &offset))
+    {
+        id = HashTable_find(&label_index, name);
+    }
+    if (id < 0)
+    {
+        offset = 0;
+        id = HashTable_find(&label_index, operand);
+    }
+    if (id >= 0)
+    {
+        LabelStruct = &labels[id]; /* Find label */
+    }
+
+    encoding_symbol = operand; /* Word is resolved again when replayed */
+    if (LabelStruct == NULL)
+    {                    
+        value = EXTERNAL_FLAG; 
+        generate_objects_output(
+            passes,
+            output_file_pointer,
+            counter,
+            value);
+        if (grouped_externals)
+        {
+            add_external_reference(operand, counter); /* Written at the end of the pass */
+        }
+        else
+        {
+            fprintf(
+                fileext,
+                "%s %04d\n",
+                operand,
+                counter); /* Write external label */
+        }
+    }
+    else
+    {                                               
+        value = ((LabelStruct->address + offset) << ISA_VALUE_SHIFT) | RELOCATABLE_FLAG; 
+        generate_objects_output(
+            passes,
+            output_file_pointer,
+            counter,
+            value);
+        if (relocation_file != NULL)
+        {
+            fprintf(relocation_file, "%04d\n", counter); /* Word moves with the base */
+        }
+    }
+    total_functions++; /* Increment function count */
+}
+
+static void out_object_operand_file(
+    struct passes *passes, 
+    FILE *fileext,       
+    FILE *output_file_pointer,   
+    int counter,                 
+    const char *operand,         
+    int order                    
+)
+{
+    int group;
+    int imd_value;
+    int uses_constants;
+    int register_val;
+    int value;
+
+    group = allocate_op_group(operand); /* Determine operand group */
+
+    switch (group)
+    {
+    case IMMEDIATE_GROUP_OPERAND:
+    { 
+        imd_value = 0;
+        expression_evaluate(&operand[1], &constants, &imd_value, &uses_constants); /* Fold immediate value */
+        value = (imd_value << ISA_VALUE_SHIFT) | ABSOLUTE_FLAG; /* Prepare value */
+        generate_objects_output(
+            passes,
+            output_file_pointer,
+            counter,
+            value);
+        total_functions++; /* Increment function count */
+        break;
+    }
+    case INDIR_GROUP_OPERAND: 
+    case REGISTER_GROUP_OPERAND:
     { 
         register_val = parse_register_value(operand); /* Parse register value */
         value = ABSOLUTE_FLAG;
@@ -824,12 +2397,12 @@ static void out_object_operand_file(
         {
         case FIRST_OPERAND:
         {                                                  
-            value = value | (register_val << 6); /* Set value for first operand */
+            value = value | (register_val << ISA_SOURCE_REGISTER_SHIFT); /* Set value for first operand */
             break;
         }
         case SECOND_OPERAND:
         {                                                  
-            value = value | (register_val << 3); /* Set value for second operand */
+            value = value | (register_val << ISA_TARGET_REGISTER_SHIFT); /* Set value for second operand */
             break;
         }
         }
@@ -843,41 +2416,12 @@ static void out_object_operand_file(
     }
     case DIR_GROUP_OPERAND:
     { 
-        struct LabelStruct *LabelStruct;
-        LabelStruct = NULL;
-        for (id = 0; id < total_labels; id++)
-        {
-            if (strcmp(labels[id].name, operand) == 0)
-            {
-                LabelStruct = &labels[id]; /* Find label */
-                break;
-            }
-        }
-        if (LabelStruct == NULL)
-        {                    
-            value = EXTERNAL_FLAG; 
-            generate_objects_output(
-                passes,
-                output_file_pointer,
-                counter,
-                value);
-            fprintf(
-                fileext,
-                "%s %04d\n",
-                operand,
-                counter); /* Write external label */
-            total_functions++; /* Increment function count */
-        }
-        else
-        {                                               
-            value = (LabelStruct->address << 3) | RELOCATABLE_FLAG; 
-            generate_objects_output(
-                passes,
-                output_file_pointer,
-                counter,
-                value);
-            total_functions++; /* Increment function count */
-        }
+        encode_label_reference(
+            passes,
+            fileext,
+            output_file_pointer,
+            counter,
+            operand);
         break;
     }
     }
@@ -895,6 +2439,7 @@ static void generate_guides_output(
     int id;   
     int limit;   
     int value;   
+    int uses_constants;
 
     word = get_word_number(line, index_base); /* Get directive */
 
@@ -905,7 +2450,7 @@ static void generate_guides_output(
             word = get_word_number(line, index_base + 1); /* Get data word */
 
             value = 0;                   
-            sscanf(word, "%d", &value); /* Convert word to integer */
+            expression_evaluate(word, &constants, &value, &uses_constants); /* Fold value */
 
             generate_objects_output(
                 passes,
@@ -948,6 +2493,31 @@ static void generate_guides_output(
 
         total_functions++; /* Increment function count */
     }
+
+    if (strcmp(word, DIRECTIVE_SPACE_RESERVE) == 0 ||
+        strcmp(word, DIRECTIVE_FILL_BLOCK) == 0)
+    {
+        value = 0; /* Reserved blocks are zeroed */
+        if (strcmp(word, DIRECTIVE_FILL_BLOCK) == 0)
+        {
+            word = get_word_number(line, index_base + 3); /* Get fill value */
+            sscanf(word, "%d", &value);
+        }
+
+        word = get_word_number(line, index_base + 1); /* Get block size */
+        limit = parse_block_count(word);
+
+        for (id = 0; id < limit; id++)
+        {
+            generate_objects_output(
+                passes,
+                output_file_pointer,
+                total_functions,
+                value);
+
+            total_functions++; /* Increment function count */
+        }
+    }
 }
 
 static void generate_commands_output(
@@ -984,7 +2554,7 @@ static void generate_commands_output(
         { 
         case NO_OPERANDS_GROUP:
         {                                                        
-            value = (instruction->command_opcode << 11) | ABSOLUTE_FLAG; 
+            value = (instruction->command_opcode << ISA_OPCODE_SHIFT) | ABSOLUTE_FLAG; 
             generate_objects_output(                                 
                                 passes,
                                 output_file_pointer,
@@ -996,11 +2566,11 @@ static void generate_commands_output(
 
         case ONE_OPERAND_GROUP:
         {                                                          
-            value = (instruction->command_opcode << 11) | ABSOLUTE_FLAG;   
+            value = (instruction->command_opcode << ISA_OPCODE_SHIFT) | ABSOLUTE_FLAG;   
             word = get_word_number(line, index_base + 1); /* Get operand */
             category_operand = allocate_op_group(word);  
 
-            value = value | (category_operand << 3); 
+            value = value | (category_operand << ISA_TARGET_MODE_SHIFT); 
 
             generate_objects_output(
                                 passes,
@@ -1037,9 +2607,9 @@ static void generate_commands_output(
             word = get_word_number(line, index_base + 3); /* Get second operand */
             group2 = allocate_op_group(word);        
 
-            value = (instruction->command_opcode << 11) | ABSOLUTE_FLAG; 
-            value = value | (group1 << 7);                   
-            value = value | (group2 << 3);                   
+            value = (instruction->command_opcode << ISA_OPCODE_SHIFT) | ABSOLUTE_FLAG; 
+            value = value | (group1 << ISA_SOURCE_MODE_SHIFT);                   
+            value = value | (group2 << ISA_TARGET_MODE_SHIFT);                   
 
             generate_objects_output(
                                 passes,
@@ -1068,8 +2638,8 @@ static void generate_commands_output(
                 number_register_2 = parse_register_value(word);    
 
                 value = ABSOLUTE_FLAG;                          
-                value = value | (number_register_1 << 6); 
-                value = value | (number_register_2 << 3); 
+                value = value | (number_register_1 << ISA_SOURCE_REGISTER_SHIFT); 
+                value = value | (number_register_2 << ISA_TARGET_REGISTER_SHIFT); 
 
                 generate_objects_output(
                                     passes,
@@ -1178,6 +2748,287 @@ static void second_phase_process_line(
     }
 }
 
+static void second_pass_line(
+    struct passes *passes, 
+    const char *line,            
+    FILE *fileext,       
+    FILE *output_file_pointer    
+)
+{
+    struct LineRecord *record;
+    const char *key;
+    int item;
+
+    record = find_statement_record(line, &key);
+
+    if (record == NULL)
+    {
+        second_phase_process_line(passes, line, fileext, output_file_pointer);
+        return;
+    }
+
+    if (!record->encoded)
+    {
+        encoding_record = record; /* Keep the words for later runs */
+        second_phase_process_line(passes, line, fileext, output_file_pointer);
+        encoding_record = NULL;
+        record->encoded = TRUE;
+        return;
+    }
+
+    /* Only words referring to labels are encoded again, addresses may move */
+    for (item = 0; item < record->word_count; item++)
+    {
+        if (record->symbols[item] != NULL)
+        {
+            encode_label_reference(
+                passes,
+                fileext,
+                output_file_pointer,
+                total_functions,
+                record->symbols[item]);
+            continue;
+        }
+
+        generate_objects_output(
+            passes,
+            output_file_pointer,
+            total_functions,
+            record->words[item]);
+        total_functions++; /* Increment function count */
+    }
+}
+
+#define PIPELINE_BATCH_LINES (256) /* Lines handed between stages at once */
+#define PIPELINE_QUEUE_SLOTS (8) /* Batches in flight between two stages */
+
+struct LineBatch
+{
+    char lines[PIPELINE_BATCH_LINES][TOTAL_LEN]; /* Source lines */
+    int total_lines; /* Number of lines in the batch */
+    char *object_text; /* Encoded object lines */
+    size_t object_length; /* Length of encoded object lines */
+    char *external_text; /* Encoded external references */
+    size_t external_length; /* Length of encoded external references */
+};
+
+struct PipelineStage
+{
+    struct Ring *queue; /* Queue between this stage and its neighbour */
+    FILE *file; /* Source file for the reader, object file for the writer */
+    FILE *fileext; /* External file for the writer */
+};
+
+static void *pipeline_reader(void *argument)
+{
+    struct PipelineStage *stage = argument;
+    struct LineBatch *batch;
+
+    trace_name_thread(TRACE_READER);
+    TRACE_BEGIN(TRACE_READER);
+    batch = NULL;
+    while (TRUE)
+    {
+        if (batch == NULL)
+        {
+            batch = malloc(sizeof(*batch)); /* Start a new batch */
+            batch->total_lines = 0;
+        }
+
+        if (fgets(batch->lines[batch->total_lines], TOTAL_LEN, stage->file) == NULL)
+        {
+            break;
+        }
+
+        batch->total_lines++;
+        if (batch->total_lines == PIPELINE_BATCH_LINES)
+        {
+            Ring_push(stage->queue, batch); /* Hand a full batch to the encoder */
+            batch = NULL;
+        }
+    }
+
+    if (batch->total_lines > 0)
+    {
+        Ring_push(stage->queue, batch); /* Hand the last partial batch */
+    }
+    else
+    {
+        free(batch);
+    }
+
+    Ring_push(stage->queue, NULL); /* Mark end of input */
+    TRACE_END(TRACE_READER);
+    return NULL;
+}
+
+static void pipeline_write_batch(
+    struct PipelineStage *stage,
+    struct LineBatch *batch
+)
+{
+    fwrite(batch->object_text, 1, batch->object_length, stage->file); /* Write object lines */
+    fwrite(batch->external_text, 1, batch->external_length, stage->fileext); /* Write externals */
+    free(batch->object_text);
+    free(batch->external_text);
+    free(batch);
+}
+
+static void *pipeline_writer(void *argument)
+{
+    struct PipelineStage *stage = argument;
+    struct LineBatch *batch;
+
+    trace_name_thread(TRACE_WRITER);
+    TRACE_BEGIN(TRACE_WRITER);
+    while ((batch = Ring_pop(stage->queue)) != NULL)
+    {
+        pipeline_write_batch(stage, batch);
+    }
+
+    TRACE_END(TRACE_WRITER);
+    return NULL;
+}
+
+/* Second pass over reader, encoder and writer threads, FALSE if no thread could be started */
+static int pipeline_second_pass(
+    struct passes *passes, 
+    FILE *assembly_fileas,   
+    FILE *fileext,       
+    FILE *output_file_pointer    
+)
+{
+    int id;
+    int writing;
+    FILE *object_stream;
+    FILE *external_stream;
+    pthread_t reader_thread;
+    pthread_t writer_thread;
+    struct LineBatch *batch;
+    struct Ring read_queue;
+    struct Ring write_queue;
+    struct PipelineStage reader;
+    struct PipelineStage writer;
+
+    Ring_init(&read_queue, PIPELINE_QUEUE_SLOTS);
+    Ring_init(&write_queue, PIPELINE_QUEUE_SLOTS);
+
+    reader.queue = &read_queue;
+    reader.file = assembly_fileas;
+    reader.fileext = NULL;
+    writer.queue = &write_queue;
+    writer.file = output_file_pointer;
+    writer.fileext = fileext;
+
+    fflush(output_file_pointer); /* Header goes out before the writer starts */
+    if (pthread_create(&reader_thread, NULL, pipeline_reader, &reader) != 0)
+    {
+        Ring_free(&read_queue);
+        Ring_free(&write_queue);
+        return FALSE; /* Nothing read yet, the caller runs the serial loop */
+    }
+    writing = pthread_create(&writer_thread, NULL, pipeline_writer, &writer) == 0;
+
+    /* Encode batches in order, between the reader and the writer */
+    while ((batch = Ring_pop(&read_queue)) != NULL)
+    {
+        object_stream = open_memstream(&batch->object_text, &batch->object_length);
+        external_stream = open_memstream(&batch->external_text, &batch->external_length);
+
+        for (id = 0; id < batch->total_lines; id++)
+        {
+            second_pass_line(
+                                         passes,
+                                         batch->lines[id],
+                                         external_stream,
+                                         object_stream); /* Process each line */
+        }
+
+        fclose(object_stream); /* Finish the encoded text */
+        fclose(external_stream);
+        if (writing)
+        {
+            Ring_push(&write_queue, batch);
+        }
+        else
+        {
+            pipeline_write_batch(&writer, batch); /* No writer thread, batches are still in order */
+        }
+    }
+
+    if (writing)
+    {
+        Ring_push(&write_queue, NULL); /* Mark end of output */
+        pthread_join(writer_thread, NULL);
+    }
+    pthread_join(reader_thread, NULL);
+
+    Ring_free(&read_queue);
+    Ring_free(&write_queue);
+    return TRUE;
+}
+
+static void sort_entries_by_address(
+    struct LabelStruct *entries, 
+    int count
+)
+{
+    int width;
+    int start;
+    int middle;
+    int end;
+    int left;
+    int right;
+    int target;
+    struct LabelStruct *buffer;
+    struct LabelStruct *source;
+    struct LabelStruct *merged;
+    struct LabelStruct *swap;
+
+    if (count < 2)
+    {
+        return; /* Already sorted */
+    }
+
+    STATS_COUNT(allocations);
+    buffer = malloc(sizeof(*buffer) * count); /* Allocate merge buffer */
+    source = entries;
+    merged = buffer;
+
+    /* Bottom-up merge sort, equal addresses keep their .entry order */
+    for (width = 1; width < count; width *= 2)
+    {
+        for (start = 0; start < count; start += 2 * width)
+        {
+            middle = start + width < count ? start + width : count;
+            end = start + 2 * width < count ? start + 2 * width : count;
+            left = start;
+            right = middle;
+            for (target = start; target < end; target++)
+            {
+                if (left < middle && (right >= end || source[left].address <= source[right].address))
+                {
+                    merged[target] = source[left++];
+                }
+                else
+                {
+                    merged[target] = source[right++];
+                }
+            }
+        }
+        swap = source; /* Merged runs are the input of the next width */
+        source = merged;
+        merged = swap;
+    }
+
+    if (source != entries)
+    {
+        memcpy(entries, source, sizeof(*entries) * count); /* Result ended in the buffer */
+    }
+
+    free(buffer); /* Free merge buffer */
+}
+
 void assembler_second_pass(
     struct passes *passes, 
     FILE *assembly_fileas,   
@@ -1187,13 +3038,13 @@ void assembler_second_pass(
 )
 {
     int id;   
-    int index_a; 
-    int index_b; 
+    int label_id; 
 
     struct LabelStruct *entry; 
-    struct LabelStruct *LabelStruct; 
 
-    total_functions = 100; /* Initialize function count */
+    total_functions = base_address; /* Initialize function count */
+    relocation_file = passes->filerel;
+    grouped_externals = passes->grouped_externals;
 
     fprintf(
             output_file_pointer,
@@ -1201,52 +3052,45 @@ void assembler_second_pass(
             total_code_lines,
             total_data_lines); /* Write totals to output file */
 
-    while (fgets(line_buffer, TOTAL_LEN, assembly_fileas) != NULL)
-    {                                
-        second_phase_process_line(
-                                     passes,
-                                     line_buffer,
-                                     fileext,
-                                     output_file_pointer); /* Process each line */
+    if (relocation_file != NULL)
+    {
+        fprintf(relocation_file, "base %d\n", base_address); /* Rebasing starts from here */
     }
 
-    for (index_a = 0; index_a < total_input; index_a++)
-    {                              
-        entry = &val_arr[index_a]; 
-        for (index_b = 0; index_b < total_labels; index_b++)
-        {                              
-            LabelStruct = &labels[index_b]; 
-            if (strcmp(entry->name, LabelStruct->name) == 0)
-            {                                          
-                entry->address = LabelStruct->address; /* Update entry address */
-                break;                                 
-            }
+    /* Overlap reading, encoding and writing, serially when no thread can be started */
+    if (!passes->pipelined ||
+        !pipeline_second_pass(passes, assembly_fileas, fileext, output_file_pointer))
+    {
+        while (fgets(line_buffer, TOTAL_LEN, assembly_fileas) != NULL)
+        {                                
+            second_pass_line(
+                                         passes,
+                                         line_buffer,
+                                         fileext,
+                                         output_file_pointer); /* Process each line */
         }
     }
 
-    while (TRUE)
-    {              
-        int swaps; 
-        swaps = 0; 
-        for (id = 1; id < total_input; id++)
-        {                                        
-            struct LabelStruct temp_storage_a;         
-            struct LabelStruct temp_storage_b;         
-            temp_storage_a = val_arr[id - 1]; 
-            temp_storage_b = val_arr[id - 0]; 
-            if (temp_storage_a.address > temp_storage_b.address)
-            {                                        
-                val_arr[id - 1] = temp_storage_b; 
-                val_arr[id - 0] = temp_storage_a; 
-                swaps++; /* Count swaps for sorting */
-            }
-        }
-        if (swaps == 0)
-        { 
-            break; /* Exit if no swaps needed */
+    if (grouped_externals)
+    {
+        generate_externals_output(fileext); /* One line per external symbol */
+    }
+
+    TRACE_BEGIN(TRACE_ENTRIES);
+    for (id = 0; id < total_input; id++)
+    {                              
+        entry = &val_arr[id]; 
+        label_id = HashTable_find(&label_index, entry->name);
+        if (label_id >= 0)
+        {                                          
+            entry->address = labels[label_id].address; /* Update entry address */
         }
     }
 
+    sort_entries_by_address(val_arr, total_input); /* Entries in address order */
+
+    TRACE_END(TRACE_ENTRIES);
+
     for (id = 0; id < total_input; id++)
     {                            
         entry = &val_arr[id]; 
@@ -1256,5 +3100,10 @@ void assembler_second_pass(
                 entry->name,
                 entry->address); /* Write sorted labels to file */
     }
+
+    if (incremental)
+    {
+        LineCache_save(&line_cache, passes->state_path); /* Reused by the next run */
+    }
 }
 
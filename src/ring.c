@@ -0,0 +1,67 @@
+#define _POSIX_C_SOURCE 200809L
+#include <sched.h>
+#include <stdlib.h>
+#include "ring.h"
+#include "stats.h"
+
+/* Initialize a Ring structure */
+void Ring_init(
+    struct Ring *ring, 
+    int capacity
+)
+{
+    unsigned long size;
+
+    size = 1;
+    while (size < (unsigned long)capacity)
+    {
+        size <<= 1; /* Round capacity up to a power of two */
+    }
+
+    STATS_COUNT(allocations);
+    ring->slots = malloc(sizeof(*ring->slots) * size); /* Allocate slots */
+    ring->mask = size - 1;
+    ring->head = 0; /* Nothing written yet */
+    ring->tail = 0; /* Nothing read yet */
+}
+
+/* Free memory used by a Ring */
+void Ring_free(struct Ring *ring)
+{
+    free(ring->slots); /* Free the slots */
+}
+
+/* Add an item to a Ring */
+void Ring_push(
+    struct Ring *ring, 
+    void *item
+)
+{
+    unsigned long head;
+
+    head = ring->head; /* Only the producer writes head */
+    while (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) > ring->mask)
+    {
+        sched_yield(); /* Ring is full, let the consumer run */
+    }
+
+    ring->slots[head & ring->mask] = item;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE); /* Publish the item */
+}
+
+/* Remove the oldest item from a Ring */
+void *Ring_pop(struct Ring *ring)
+{
+    unsigned long tail;
+    void *item;
+
+    tail = ring->tail; /* Only the consumer writes tail */
+    while (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail)
+    {
+        sched_yield(); /* Ring is empty, let the producer run */
+    }
+
+    item = ring->slots[tail & ring->mask];
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE); /* Release the slot */
+    return item;
+}
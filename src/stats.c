@@ -0,0 +1,227 @@
+#define _POSIX_C_SOURCE 199309L
+#include <string.h>
+#include <time.h>
+#include "definitions.h"
+#include "stats.h"
+
+struct stats assembler_stats; /* Statistics of the current run */
+
+static const char *phase_names[] = {
+    "macro_expansion",
+    "first_pass",
+    "second_pass",
+    "output",
+    "total"};
+
+static const char *file_names[] = {
+    "am",
+    "ob",
+    "ent",
+    "ext",
+    "rel"};
+
+static double wall_clock(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now); /* Read monotonic clock */
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static double cpu_clock(void)
+{
+    return (double)clock() / CLOCKS_PER_SEC; /* Processor time used */
+}
+
+void stats_enable(void)
+{
+    memset(&assembler_stats, 0, sizeof(assembler_stats)); /* Reset all counters */
+    assembler_stats.enabled = TRUE;
+}
+
+void stats_phase_begin(int phase)
+{
+    if (!assembler_stats.enabled)
+    {
+        return;
+    }
+
+    assembler_stats.wall_start[phase] = wall_clock(); /* Remember start times */
+    assembler_stats.cpu_start[phase] = cpu_clock();
+}
+
+void stats_phase_end(int phase)
+{
+    if (!assembler_stats.enabled)
+    {
+        return;
+    }
+
+    assembler_stats.wall_time[phase] += wall_clock() - assembler_stats.wall_start[phase];
+    assembler_stats.cpu_time[phase] += cpu_clock() - assembler_stats.cpu_start[phase];
+}
+
+/* Time spent in a phase alone, macro expansion runs inside the first pass */
+static double phase_time(
+    const double *times,
+    int phase
+)
+{
+    if (phase == STATS_PHASE_FIRST_PASS)
+    {
+        return times[phase] - times[STATS_PHASE_MACROS];
+    }
+    return times[phase];
+}
+
+static double lines_per_second(void)
+{
+    double wall;
+
+    wall = assembler_stats.wall_time[STATS_PHASE_TOTAL];
+    if (wall <= 0)
+    {
+        return 0;
+    }
+
+    return assembler_stats.lines / wall;
+}
+
+static void report_counter_text(
+    FILE *output,
+    const char *label,
+    long value
+)
+{
+#ifdef ASSEMBLER_STATS
+    fprintf(output, "  %-16s %ld\n", label, value);
+#else
+    (void)value;
+    fprintf(output, "  %-16s n/a, build with STATS=1\n", label);
+#endif
+}
+
+static void report_counter_json(
+    FILE *output,
+    const char *key,
+    long value
+)
+{
+#ifdef ASSEMBLER_STATS
+    fprintf(output, ", \"%s\": %ld", key, value);
+#else
+    (void)value;
+    fprintf(output, ", \"%s\": null", key); /* Counters were compiled out */
+#endif
+}
+
+static void report_text(
+    FILE *output, 
+    const char *name
+)
+{
+    int id;
+
+    fprintf(output, "statistics for %s\n", name);
+    for (id = 0; id < STATS_TOTAL_PHASES; id++)
+    {
+        fprintf(
+            output,
+            "  %-16s wall %10.3f ms  cpu %10.3f ms\n",
+            phase_names[id],
+            phase_time(assembler_stats.wall_time, id) * 1e3,
+            phase_time(assembler_stats.cpu_time, id) * 1e3);
+    }
+    fprintf(output, "  %-16s %ld\n", "lines", assembler_stats.lines);
+    fprintf(output, "  %-16s %.0f\n", "lines/second", lines_per_second());
+    report_counter_text(output, "tokenizer calls", assembler_stats.tokenizer_calls);
+    report_counter_text(output, "symbol probes", assembler_stats.symbol_probes);
+    report_counter_text(output, "memo hits", assembler_stats.memo_hits);
+    report_counter_text(output, "allocations", assembler_stats.allocations);
+    for (id = 0; id < STATS_TOTAL_FILES; id++)
+    {
+        fprintf(
+            output,
+            "  bytes .%-8s %ld\n",
+            file_names[id],
+            assembler_stats.bytes_written[id]);
+    }
+}
+
+static void write_json_string(
+    FILE *output,
+    const char *text
+)
+{
+    /* Unit names may hold quotes, backslashes or control characters */
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' || *text == '\\')
+        {
+            fprintf(output, "\\%c", *text);
+        }
+        else if ((unsigned char)*text < 0x20)
+        {
+            fprintf(output, "\\u%04x", (unsigned char)*text);
+        }
+        else
+        {
+            fputc(*text, output);
+        }
+    }
+}
+
+static void report_json(
+    FILE *output, 
+    const char *name
+)
+{
+    int id;
+
+    fprintf(output, "{\"file\": \"");
+    write_json_string(output, name);
+    fprintf(output, "\", \"phases\": {");
+    for (id = 0; id < STATS_TOTAL_PHASES; id++)
+    {
+        fprintf(
+            output,
+            "%s\"%s\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f}",
+            id == 0 ? "" : ", ",
+            phase_names[id],
+            phase_time(assembler_stats.wall_time, id) * 1e3,
+            phase_time(assembler_stats.cpu_time, id) * 1e3);
+    }
+    fprintf(output, "}, \"lines\": %ld", assembler_stats.lines);
+    fprintf(output, ", \"lines_per_second\": %.0f", lines_per_second());
+    report_counter_json(output, "tokenizer_calls", assembler_stats.tokenizer_calls);
+    report_counter_json(output, "symbol_probes", assembler_stats.symbol_probes);
+    report_counter_json(output, "memo_hits", assembler_stats.memo_hits);
+    report_counter_json(output, "allocations", assembler_stats.allocations);
+    fprintf(output, ", \"bytes_written\": {");
+    for (id = 0; id < STATS_TOTAL_FILES; id++)
+    {
+        fprintf(
+            output,
+            "%s\"%s\": %ld",
+            id == 0 ? "" : ", ",
+            file_names[id],
+            assembler_stats.bytes_written[id]);
+    }
+    fprintf(output, "}}\n");
+}
+
+void stats_report(
+    FILE *output, 
+    const char *name, 
+    int format
+)
+{
+    if (format == STATS_FORMAT_JSON)
+    {
+        report_json(output, name);
+    }
+    else
+    {
+        report_text(output, name);
+    }
+}
@@ -1,5 +1,6 @@
 #include <ctype.h>
 #include "definitions.h"
+#include "stats.h"
 #include "tokens.h"
 
 char token_buffer[TOTAL_LEN];
@@ -26,12 +27,17 @@ int total_words_in_row(const char *line)
     return count; /* Return total number of words */
 }
 
-char *get_word_number(const char *line, int search_index)
+/* Find where a word starts and ends, both are at the end of the line for a missing word */
+static void find_word(
+    const char *line,
+    int search_index,
+    int *start,
+    int *end
+)
 {
     char current_char;
     int start_index;
     int end_index;
-    int copy_index;
     int token_index;
     int is_whitespace;
     int is_comma;
@@ -39,18 +45,13 @@ char *get_word_number(const char *line, int search_index)
     int is_end;
     int is_delimiter;
 
-    token_buffer[0] = '\0'; /* Initialize buffer */
-
     start_index = 0;
     end_index = 0;
     token_index = 0;
 
     while (TRUE)
     {
-        if (search_index < token_index) /* Check if index is past current token */
-        {
-            break;
-        }
+        start_index = end_index; /* Continue after the previous token */
 
         while (TRUE)
         {
@@ -98,31 +99,46 @@ char *get_word_number(const char *line, int search_index)
             end_index++;
         }
 
-        if (search_index == token_index)
+        if (search_index == token_index || start_index == end_index)
         {
-            copy_index = 0;
-            while (start_index < end_index)
-            {
-                current_char = line[start_index];
+            break; /* Found the word or reached the end of the line */
+        }
 
-                if (current_char == ';')
-                {
-                    current_char = '\0'; /* End of comment */
-                }
+        token_index++;
+    }
 
-                token_buffer[copy_index] = current_char;
-                copy_index++;
+    *start = start_index;
+    *end = end_index;
+}
 
-                start_index++;
-            }
+char *get_word_number(const char *line, int search_index)
+{
+    int start_index;
+    int end_index;
+    int copy_index;
 
-            token_buffer[copy_index] = '\0'; /* Null-terminate buffer */
-        }
+    STATS_COUNT(tokenizer_calls);
+    find_word(line, search_index, &start_index, &end_index);
 
-        start_index = end_index;
+    copy_index = 0;
+    while (start_index < end_index)
+    {
+        token_buffer[copy_index] = line[start_index];
+        copy_index++;
 
-        token_index++;
+        start_index++;
     }
 
+    token_buffer[copy_index] = '\0'; /* Null-terminate buffer */
     return token_buffer; /* Return the extracted token */
 }
+
+int get_word_column(const char *line, int search_index)
+{
+    int start_index;
+    int end_index;
+
+    STATS_COUNT(tokenizer_calls);
+    find_word(line, search_index, &start_index, &end_index);
+    return start_index + 1; /* Columns count from one */
+}
@@ -0,0 +1,232 @@
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "definitions.h"
+#include "stats.h"
+#include "trace.h"
+
+/* Structure for one recorded event */
+struct TraceEvent
+{
+    const char *name; /* Static event name */
+    char phase; /* 'B' for begin, 'E' for end */
+    int unit; /* Index of the unit name */
+    int thread; /* Index of the thread */
+    double timestamp; /* Microseconds since the recorder started */
+};
+
+/* Structure for a thread seen by the recorder */
+struct TraceThread
+{
+    char name[TOTAL_LEN]; /* Name shown in the trace */
+};
+
+int trace_enabled; /* TRUE when events are recorded */
+
+static struct TraceEvent *events; /* Ring of events */
+static unsigned long total_events; /* Events recorded, including overwritten ones */
+static double start_time; /* Recorder start in microseconds */
+static char (*units)[TOTAL_LEN]; /* Unit names */
+static int total_units; /* Number of unit names */
+static int units_limit; /* Allocated unit names */
+static int current_unit; /* Unit of the following events */
+static struct TraceThread threads[TRACE_MAX_THREADS]; /* Threads seen so far */
+static int total_threads; /* Number of threads seen */
+static pthread_mutex_t threads_lock = PTHREAD_MUTEX_INITIALIZER; /* Guards thread registration */
+static __thread int thread_row; /* Row of the calling thread plus one, 0 until registered */
+
+static double microseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now); /* Read monotonic clock */
+    return now.tv_sec * 1e6 + now.tv_nsec / 1e3;
+}
+
+static int thread_index(void)
+{
+    int id;
+
+    if (thread_row > 0)
+    {
+        return thread_row - 1; /* Known thread */
+    }
+
+    /* First event of this thread, threads beyond the table share the last row */
+    pthread_mutex_lock(&threads_lock);
+    id = total_threads;
+    if (id < TRACE_MAX_THREADS)
+    {
+        sprintf(threads[id].name, id == 0 ? "main" : "thread %d", id);
+        total_threads = id + 1;
+    }
+    else
+    {
+        if (id == TRACE_MAX_THREADS)
+        {
+            fprintf(stderr, "Trace has more than %d threads, later ones share the last row\n", TRACE_MAX_THREADS);
+            total_threads = id + 1; /* Warn only once */
+        }
+        id = TRACE_MAX_THREADS - 1;
+    }
+    pthread_mutex_unlock(&threads_lock);
+
+    thread_row = id + 1;
+    return id;
+}
+
+static void write_json_string(
+    FILE *output, 
+    const char *text
+)
+{
+    /* Unit paths and thread names may hold quotes, backslashes or control characters */
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' || *text == '\\')
+        {
+            fprintf(output, "\\%c", *text);
+        }
+        else if ((unsigned char)*text < 0x20)
+        {
+            fprintf(output, "\\u%04x", (unsigned char)*text);
+        }
+        else
+        {
+            fputc(*text, output);
+        }
+    }
+}
+
+/* Start recording events */
+void trace_enable(void)
+{
+    STATS_COUNT(allocations);
+    events = malloc(sizeof(*events) * TRACE_RING_EVENTS); /* Allocate the ring once */
+    total_events = 0;
+    start_time = microseconds();
+    trace_enabled = TRUE;
+    trace_set_unit("run");
+    thread_index(); /* Calling thread is the main one */
+}
+
+/* Tag the following events with a unit name */
+void trace_set_unit(const char *name)
+{
+    if (!trace_enabled)
+    {
+        return;
+    }
+
+    if (total_units == units_limit)
+    {
+        units_limit += MEMORY_BLOCK_SIZE; /* Increase limit */
+        STATS_COUNT(allocations);
+        units = realloc(units, sizeof(*units) * units_limit);
+    }
+
+    strncpy(units[total_units], name, TOTAL_LEN - 1);
+    units[total_units][TOTAL_LEN - 1] = '\0';
+    current_unit = total_units;
+    total_units++;
+}
+
+/* Give the calling thread its own named row in the trace */
+void trace_name_thread(const char *name)
+{
+    int id;
+
+    if (!trace_enabled)
+    {
+        return;
+    }
+
+    id = thread_index(); /* Registered once, renamed by later calls */
+    strncpy(threads[id].name, name, TOTAL_LEN - 1);
+    threads[id].name[TOTAL_LEN - 1] = '\0';
+}
+
+/* Record an event on the calling thread */
+void trace_record(
+    const char *name, 
+    char phase
+)
+{
+    struct TraceEvent *event;
+    unsigned long slot;
+
+    /* Each thread claims its own slot, the oldest events are overwritten */
+    slot = __atomic_fetch_add(&total_events, 1, __ATOMIC_RELAXED);
+    event = &events[slot & (TRACE_RING_EVENTS - 1)];
+    event->name = name;
+    event->phase = phase;
+    event->unit = current_unit;
+    event->thread = thread_index();
+    event->timestamp = microseconds() - start_time;
+}
+
+/* Write recorded events in Chrome trace-event JSON format */
+int trace_write(const char *path)
+{
+    FILE *output;
+    unsigned long first;
+    unsigned long id;
+    int thread;
+    const struct TraceEvent *event;
+
+    output = fopen(path, "w");
+    if (output == NULL)
+    {
+        return FALSE;
+    }
+
+    first = 0;
+    if (total_events > TRACE_RING_EVENTS)
+    {
+        first = total_events - TRACE_RING_EVENTS; /* Older events were overwritten */
+    }
+
+    fprintf(output, "{\"traceEvents\":[\n");
+    for (thread = 0; thread < total_threads && thread < TRACE_MAX_THREADS; thread++)
+    {
+        fprintf(output, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"", thread);
+        write_json_string(output, threads[thread].name);
+        fprintf(output, "\"}},\n");
+    }
+    for (id = first; id < total_events; id++)
+    {
+        event = &events[id & (TRACE_RING_EVENTS - 1)];
+        fprintf(
+            output,
+            "{\"name\":\"%s\",\"cat\":\"assembler\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d,"
+            "\"args\":{\"unit\":\"",
+            event->name,
+            event->phase,
+            event->timestamp,
+            event->thread);
+        write_json_string(output, units[event->unit]);
+        fprintf(output, "\"}},\n");
+    }
+    fprintf(
+        output,
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"assembler\"}}\n"
+        "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":%lu}}\n",
+        first);
+
+    return fclose(output) == 0;
+}
+
+/* Free memory used by the recorder */
+void trace_release(void)
+{
+    free(events); /* Free the ring */
+    free(units); /* Free unit names */
+    events = NULL;
+    units = NULL;
+    total_units = 0;
+    units_limit = 0;
+    trace_enabled = FALSE;
+}
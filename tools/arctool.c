@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "archive.h"
+
+/* Lists, searches and extracts archives written by assembler --archive */
+
+static void list_members(const struct Archive *archive)
+{
+    int id;
+
+    for (id = 0; id < archive->header->member_count; id++)
+    {
+        printf(
+            "%8d %s\n",
+            archive->members[id].length,
+            Archive_name(archive, archive->members[id].name_offset));
+    }
+}
+
+static void list_symbols(const struct Archive *archive)
+{
+    int id;
+    const struct ArchiveSymbol *symbol;
+
+    for (id = 0; id < archive->header->symbol_count; id++)
+    {
+        symbol = &archive->symbols[id];
+        printf(
+            "%s %d %s\n",
+            Archive_name(archive, symbol->name_offset),
+            symbol->address,
+            Archive_name(archive, archive->members[symbol->member].name_offset));
+    }
+}
+
+static int find_symbols(
+    const struct Archive *archive,
+    char **names,
+    int count
+)
+{
+    int id;
+    int symbol;
+    int found;
+
+    found = TRUE;
+    for (id = 0; id < count; id++)
+    {
+        symbol = Archive_find_symbol(archive, names[id]);
+        if (symbol < 0)
+        {
+            fprintf(stderr, "Symbol \"%s\" is not in the archive\n", names[id]);
+            found = FALSE;
+            continue;
+        }
+
+        /* Equal names are next to each other in the index */
+        for (; symbol < archive->header->symbol_count &&
+               strcmp(Archive_name(archive, archive->symbols[symbol].name_offset), names[id]) == 0;
+             symbol++)
+        {
+            printf(
+                "%s %d %s\n",
+                names[id],
+                archive->symbols[symbol].address,
+                Archive_name(archive, archive->members[archive->symbols[symbol].member].name_offset));
+        }
+    }
+    return found;
+}
+
+static int extract_member(
+    const struct Archive *archive,
+    int member
+)
+{
+    FILE *output;
+    const char *path;
+    int written;
+
+    path = Archive_name(archive, archive->members[member].name_offset);
+    output = fopen(path, "wb");
+    if (output == NULL)
+    {
+        fprintf(stderr, "Cannot write file \"%s\"\n", path);
+        return FALSE;
+    }
+
+    fwrite(archive->map + archive->members[member].data_offset, 1, archive->members[member].length, output);
+    written = fclose(output) == 0;
+    if (!written)
+    {
+        fprintf(stderr, "Cannot write file \"%s\"\n", path);
+    }
+    return written;
+}
+
+static int extract_members(
+    const struct Archive *archive,
+    char **paths,
+    int count
+)
+{
+    int id;
+    int member;
+    int extracted;
+
+    extracted = TRUE;
+    if (count == 0)
+    {
+        for (member = 0; member < archive->header->member_count; member++)
+        {
+            extracted = extract_member(archive, member) && extracted;
+        }
+        return extracted;
+    }
+
+    for (id = 0; id < count; id++)
+    {
+        member = Archive_find_member(archive, paths[id]);
+        if (member < 0)
+        {
+            fprintf(stderr, "File \"%s\" is not in the archive\n", paths[id]);
+            extracted = FALSE;
+            continue;
+        }
+        extracted = extract_member(archive, member) && extracted;
+    }
+    return extracted;
+}
+
+int main(int argc, char *argv[])
+{
+    struct Archive archive;
+    int done;
+
+    if (argc < 3 ||
+        (strcmp(argv[1], "list") != 0 && strcmp(argv[1], "symbols") != 0 &&
+         strcmp(argv[1], "find") != 0 && strcmp(argv[1], "extract") != 0))
+    {
+        fprintf(
+            stderr,
+            "Usage: %s list <archive>\n"
+            "       %s symbols <archive>\n"
+            "       %s find <archive> <symbol>...\n"
+            "       %s extract <archive> [<file>...]\n",
+            argv[0],
+            argv[0],
+            argv[0],
+            argv[0]);
+        return (-1);
+    }
+
+    if (!Archive_open(&archive, argv[2]))
+    {
+        fprintf(stderr, "Cannot read archive \"%s\"\n", argv[2]);
+        Archive_close(&archive);
+        return (-1);
+    }
+
+    done = TRUE;
+    if (strcmp(argv[1], "list") == 0)
+    {
+        list_members(&archive);
+    }
+    else if (strcmp(argv[1], "symbols") == 0)
+    {
+        list_symbols(&archive);
+    }
+    else if (strcmp(argv[1], "find") == 0)
+    {
+        done = find_symbols(&archive, &argv[3], argc - 3);
+    }
+    else
+    {
+        done = extract_members(&archive, &argv[3], argc - 3);
+    }
+
+    Archive_close(&archive);
+    return done ? 0 : (-1);
+}
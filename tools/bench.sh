@@ -0,0 +1,62 @@
+#!/bin/sh
+# End-to-end benchmark: times the assembler on generated programs of
+# several shapes and sizes and records throughput in bench_output.txt.
+#
+# Usage: tools/bench.sh [assembler] [generator]
+
+ASSEMBLER=${1:-./assembler}
+GENERATOR=${2:-./genprog}
+WORK_DIR=bench_work
+OUTPUT=bench_output.txt
+RUNS=3
+
+ASSEMBLER=$(cd "$(dirname "$ASSEMBLER")" && pwd)/$(basename "$ASSEMBLER")
+GENERATOR=$(cd "$(dirname "$GENERATOR")" && pwd)/$(basename "$GENERATOR")
+
+# shape name and generator options
+SHAPES="
+mixed:
+labels:--label-density=80 --forward-ratio=50
+forward:--label-density=40 --forward-ratio=100
+macros:--macros=400 --macro-body=8 --macro-calls=30
+data:--data-ratio=70 --data-width=16
+externs:--externs=200 --extern-ratio=60
+"
+SIZES="2000 8000 32000"
+
+mkdir -p "$WORK_DIR"
+printf "%-10s %8s %10s %14s\n" shape lines seconds lines/second > "$OUTPUT"
+
+echo "$SHAPES" | while IFS=: read -r shape options
+do
+    [ -z "$shape" ] && continue
+    for lines in $SIZES
+    do
+        # shellcheck disable=SC2086
+        "$GENERATOR" --lines="$lines" $options > "$WORK_DIR/$shape.as" || exit 1
+        total=$(wc -l < "$WORK_DIR/$shape.as")
+
+        best=""
+        run=0
+        while [ $run -lt $RUNS ]
+        do
+            start=$(date +%s%N)
+            (cd "$WORK_DIR" && "$ASSEMBLER" "$shape" > /dev/null 2>&1)
+            end=$(date +%s%N)
+            elapsed=$((end - start))
+            if [ -z "$best" ] || [ $elapsed -lt "$best" ]
+            then
+                best=$elapsed
+            fi
+            run=$((run + 1))
+        done
+
+        awk -v shape="$shape" -v lines="$total" -v ns="$best" 'BEGIN {
+            seconds = ns / 1e9
+            printf "%-10s %8d %10.4f %14.0f\n", shape, lines, seconds, (seconds > 0 ? lines / seconds : 0)
+        }' >> "$OUTPUT"
+    done
+done
+
+cat "$OUTPUT"
+rm -rf "$WORK_DIR"
@@ -0,0 +1,233 @@
+#!/bin/sh
+# Differential checker: assembles the checked-in corpus with an assembler
+# in every mode it offers and compares the .am, .ob, .ent and .ext outputs
+# and the error messages byte for byte with the golden outputs.
+# .rel tables are compared too.
+#
+# Usage: tools/diffcheck.sh <assembler>
+#        tools/diffcheck.sh --update <assembler> [generator]
+#
+# The corpus in tools/diffcheck/corpus is the sample sources, units for each
+# directive and output option, and generated stress programs of several
+# shapes. A unit.options file holds options the unit is always assembled
+# with, and lib_*.as sources are macro libraries precompiled before every
+# run for units that include them. --update copies the samples from the
+# current directory, regenerates the stress programs when a generator is
+# given, and rewrites tools/diffcheck/golden from a serial run. Review the
+# golden diff before committing it.
+
+if [ $# -lt 1 ] || { [ "$1" = "--update" ] && [ $# -lt 2 ]; }
+then
+    echo "Usage: $0 <assembler>" >&2
+    echo "       $0 --update <assembler> [generator]" >&2
+    exit 2
+fi
+
+absolute() {
+    echo "$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+}
+
+CHECK_DIR=$(absolute "$(dirname "$0")/diffcheck")
+CORPUS_DIR="$CHECK_DIR/corpus"
+GOLDEN_DIR="$CHECK_DIR/golden"
+WORK_DIR=diffcheck_work
+EXTENSIONS="am ob ent ext rel err"
+
+UPDATE=0
+if [ "$1" = "--update" ]
+then
+    UPDATE=1
+    shift
+fi
+ASSEMBLER=$(absolute "$1")
+GENERATOR=""
+[ -n "$2" ] && GENERATOR=$(absolute "$2")
+
+# mode name, how units are assembled and options:
+#   each   one run per unit
+#   twice  one run per unit, repeated in the same directory so the second
+#          run reuses the state or cache entries of the first
+#   all    one run over every unit without options, so the statement memo
+#          is shared by units and --batch reads and writes them together,
+#          units with options run on their own
+# The statement memo is on in every mode but the incremental ones.
+MODES="
+serial:each:
+pipeline:each:--pipeline
+memo:all:
+batch:all:--batch
+batch-stdio:all:--batch --no-uring
+incremental:twice:--incremental
+incremental-pipeline:twice:--incremental --pipeline
+cache:twice:--cache=cache
+cache-batch:twice:--batch --cache=cache
+"
+
+# generated shape name and generator options, macro calls are left unlabeled
+# and repeat is mostly label-free statements that hit the statement memo
+SHAPES="
+mixed:--lines=1000 --seed=11
+labels:--lines=1000 --label-density=80 --seed=12
+macros:--lines=1000 --macros=20 --macro-body=6 --macro-calls=30 --label-density=0 --seed=13
+data:--lines=1000 --data-ratio=70 --data-width=16 --seed=14
+externs:--lines=1000 --externs=40 --extern-ratio=60 --entry-ratio=30 --seed=15
+repeat:--lines=1000 --label-density=0 --seed=16
+"
+
+# units: corpus units in the order they are assembled
+units() {
+    for source in "$CORPUS_DIR"/*.as
+    do
+        unit=$(basename "$source" .as)
+        case "$unit" in
+        lib_*) ;;
+        *) echo "$unit" ;;
+        esac
+    done
+}
+
+# shared_units: units assembled together by an all run
+shared_units() {
+    for unit in $(units)
+    do
+        [ -f "$CORPUS_DIR/$unit.options" ] || echo "$unit"
+    done
+}
+
+# unit_options <unit>: options the unit is always assembled with
+unit_options() {
+    [ -f "$CORPUS_DIR/$1.options" ] && cat "$CORPUS_DIR/$1.options"
+}
+
+# run <directory> <how> <options...>: assemble the corpus into a directory,
+# leaving one .err per unit, empty ones are removed
+run() {
+    directory=$1
+    how=$2
+    shift 2
+    mkdir -p "$directory"
+    cp "$CORPUS_DIR"/*.as "$directory/"
+    for source in "$CORPUS_DIR"/lib_*.as
+    do
+        [ -f "$source" ] && (cd "$directory" && "$ASSEMBLER" --precompile "$(basename "$source" .as)" > /dev/null)
+    done
+
+    if [ "$how" = "all" ]
+    then
+        # shellcheck disable=SC2046
+        (cd "$directory" && "$ASSEMBLER" "$@" $(shared_units) > /dev/null 2> all.err)
+    fi
+    for unit in $(units)
+    do
+        [ "$how" = "all" ] && [ ! -f "$CORPUS_DIR/$unit.options" ] && continue
+        # shellcheck disable=SC2046
+        (cd "$directory" && "$ASSEMBLER" "$@" $(unit_options "$unit") "$unit" > /dev/null 2> "$unit.err")
+        if [ "$how" = "twice" ]
+        then
+            # shellcheck disable=SC2046
+            (cd "$directory" && "$ASSEMBLER" "$@" $(unit_options "$unit") "$unit" > /dev/null 2> "$unit.err")
+        fi
+    done
+
+    rm "$directory"/*.as
+    rm -f "$directory"/*.mlib
+    for unit in $(units) all
+    do
+        [ -s "$directory/$unit.err" ] || rm -f "$directory/$unit.err"
+    done
+}
+
+# compare <mode> <expected> <actual>: count a difference between two files
+compare() {
+    if [ -f "$2" ] && [ ! -f "$3" ]
+    then
+        echo "FAIL $1 $(basename "$2"): missing"
+        failures=$((failures + 1))
+    elif [ ! -f "$2" ] && [ -f "$3" ]
+    then
+        echo "FAIL $1 $(basename "$3"): unexpected"
+        failures=$((failures + 1))
+    elif [ -f "$2" ] && ! cmp -s "$2" "$3"
+    then
+        echo "FAIL $1 $(basename "$2"): differs"
+        failures=$((failures + 1))
+    fi
+}
+
+rm -rf "$WORK_DIR"
+mkdir -p "$WORK_DIR"
+
+if [ $UPDATE -eq 1 ]
+then
+    mkdir -p "$CORPUS_DIR"
+    for source in *.as
+    do
+        [ -f "$source" ] && cp "$source" "$CORPUS_DIR/"
+    done
+
+    if [ -n "$GENERATOR" ]
+    then
+        echo "$SHAPES" | while IFS=: read -r shape options
+        do
+            [ -z "$shape" ] && continue
+            # shellcheck disable=SC2086
+            "$GENERATOR" $options > "$CORPUS_DIR/gen_$shape.as"
+        done
+    fi
+
+    run "$WORK_DIR/serial" each
+    rm -rf "$GOLDEN_DIR"
+    mkdir -p "$GOLDEN_DIR"
+    for unit in $(units)
+    do
+        for extension in $EXTENSIONS
+        do
+            [ -f "$WORK_DIR/serial/$unit.$extension" ] && cp "$WORK_DIR/serial/$unit.$extension" "$GOLDEN_DIR/"
+        done
+    done
+    rm -rf "$WORK_DIR"
+    echo "golden outputs written to $GOLDEN_DIR"
+    exit 0
+fi
+
+# Errors of a run over every unit are the unit errors in corpus order
+for unit in $(shared_units)
+do
+    [ -f "$GOLDEN_DIR/$unit.err" ] && cat "$GOLDEN_DIR/$unit.err"
+done > "$WORK_DIR/all.err"
+[ -s "$WORK_DIR/all.err" ] || rm -f "$WORK_DIR/all.err"
+
+failures=0
+modes_file="$WORK_DIR/modes"
+echo "$MODES" > "$modes_file"
+while IFS=: read -r mode how options
+do
+    [ -z "$mode" ] && continue
+    # shellcheck disable=SC2086
+    run "$WORK_DIR/$mode" "$how" $options
+
+    for unit in $(units)
+    do
+        for extension in $EXTENSIONS
+        do
+            if [ "$how" != "all" ] || [ "$extension" != "err" ] || [ -f "$CORPUS_DIR/$unit.options" ]
+            then
+                compare "$mode" "$GOLDEN_DIR/$unit.$extension" "$WORK_DIR/$mode/$unit.$extension"
+            fi
+        done
+    done
+    if [ "$how" = "all" ]
+    then
+        compare "$mode" "$WORK_DIR/all.err" "$WORK_DIR/$mode/all.err"
+    fi
+    echo "checked mode $mode"
+done < "$modes_file"
+
+if [ $failures -ne 0 ]
+then
+    echo "$failures differences, outputs kept in $WORK_DIR"
+    exit 1
+fi
+
+echo "all outputs match"
+rm -rf "$WORK_DIR"
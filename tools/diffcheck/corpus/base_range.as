@@ -0,0 +1,6 @@
+; A base this high leaves no room for the program
+MAIN:   lea DATA, r1
+        prn #-3
+        jmp END
+END:    stop
+DATA:   .data 5, 6, 7
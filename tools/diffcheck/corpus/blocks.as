@@ -0,0 +1,10 @@
+MAIN:   mov BUF, r1
+        lea TABLE, r2
+        prn #5
+        stop
+BUF:    .space 4
+TABLE:  .fill 3, -7
+        .data 1, 2
+GAP:    .space 1
+        .fill 2, 0
+.entry TABLE
@@ -0,0 +1,15 @@
+.define SIZE 4
+.define WIDE SIZE*2+1
+.define MASK 1<<3|2
+MAIN:   mov #SIZE, r1
+        add #WIDE-3, r1
+        cmp #-2*MASK, r1
+        cmp #0-MASK, r1
+        lea LIST+2, r3
+        mov LIST+SIZE, r4
+        jmp MAIN+1
+        prn #SIZE*SIZE
+        stop
+LIST:   .data SIZE, WIDE, MASK, -SIZE, 7*3
+        .data SIZE<<2
+.entry LIST
@@ -0,0 +1,28 @@
+.define SIZE 4
+.define SIZE 5
+.define mov 3
+BUF:    .space -1
+        .space
+        .fill 2
+        .fill x, 1
+        .data SIZE/2
+        prn #UNKNOWN+1
+        mov MISSING+2, r1
+macr pair a, a
+endmacr
+macr two a, b
+        mov a, b
+endmacr
+        two r1
+        two r1, r2, r3
+macr loop_a
+        loop_b
+endmacr
+macr loop_b
+        loop_a
+endmacr
+        loop_a
+.include lib_common
+.include "no_such.mlib"
+        stop
+TWICE:  TWICE: stop
@@ -0,0 +1,1009 @@
+; generated program, seed 14
+.entry L19
+.entry L26
+.entry L33
+.entry L58
+.entry L75
+.entry L123
+.entry L124
+.entry L166
+        mov *r1, r0
+        .string "vlcicgtpvixdyfa"
+        .data -769, 489, -580, 784, -858, 307, -253, 142, 884, -792, 755, 813, 386, -221, -187, 856
+L0:        sub #77, L0
+L1:        add #-44, r5
+L2:        .string "kwlmwsfm"
+        prn *r0
+        .data -259, -618, -592, 204, -421, -409, -374, -351, -326, -234, 613, -885, 826, -760, 931, 15
+        add *r6, r1
+L3:        .string "dvrpvvwgnw"
+        .data 502, -124, 366, -233, 75, 587, -432, -475, -595, 21, -508, 839, -261, 145, 899, -989
+        .data 736, 830, -653, -810, -969, 635, -652, -665, 41, 597, 615, 576, 724, -854, -436, 659
+        .data -313, 354, -243, -407, -614, -839, 900, 86, 80, -646, -720, 926, 681, 412, 691, -772
+        dec L12
+        .data 20, 179, -309, 986, -502, -710, 305, -887, -829, -804, 622, 680, 605, -374, -953, 882
+        .data 495, 441, -128, 960, -968, 382, -168, 927, 72, -865, 585, 207, 685, 531, 714, -486
+        .data 825, -383, -4, -107, 710, -288, 733, 73, -785, -48, 470, 52, 762, 127, 409, 732
+        .data 310, 10, 956, -350, 674, -302, -338, -63, -25, 512, -991, -193, 286, 742, 800, -192
+        .data 569, 152, 192, 644, 615, 68, 505, -654, 95, -597, 999, -384, -596, -509, 967, -758
+        .data 973, -165, -857, -563, -575, 470, 594, 184, -934, 611, 263, 654, 684, 538, 211, -119
+        .string "ygdbwgkovdjbk"
+        .data -706, 326, 409, 42, -506, 298, 311, 514, 700, 106, 791, -806, 773, -194, -238, -676
+        .data 704, -610, -510, -555, -562, -720, 456, -465, 896, 584, -247, 179, 748, -755, 797, 296
+        jmp L46
+        .data -479, -341, -416, 20, 229, 11, 302, 816, -461, -293, 878, -133, 815, -689, -339, -97
+L4:        .string "vutikysryon"
+L5:        bne L128
+        cmp L2, L164
+        .data 652, -329, 63, -421, -728, 426, 816, 574, -309, 80, 52, 320, 655, 619, 672, -422
+        .string "mkuyukcbxmjtm"
+        .data -686, -460, 635, -495, 875, 315, 126, -944, 667, -499, 478, 541, -904, -186, 427, -251
+        .data 418, 193, 908, -695, 43, -496, -409, 92, -877, -350, -158, 304, -345, -406, 36, -120
+        .data -75, 82, -79, 314, -817, -785, -344, -39, 329, 498, -311, 978, 301, -693, -610, -461
+L6:        mov *r4, *r6
+        .data 217, 161, 417, -698, 419, -16, 378, -882, -495, 525, -584, 611, 125, 67, 725, -873
+        .data -599, 773, -838, 424, -710, -292, -738, 626, -445, 284, -802, -537, -432, 732, -595, -352
+L7:        .data -277, 710, -298, 656, -334, 971, 691, -259, -753, -217, 488, -549, -559, -44, 659, 514
+        .string "tcmzhpokdkkxt"
+        .data 779, -930, 7, -470, -627, -984, 719, -456, 172, 193, 924, -468, -977, -457, -154, 110
+        .string "dpawcsmtpzoyyhmt"
+L8:        .data 668, 365, 993, 870, -177, -988, -79, -277, -987, 831, -718, 710, -997, 48, 289, -179
+        .string "icotuyoxmvjemot"
+        .data 471, -110, -990, -426, -452, -206, 290, -896, 696, -812, 297, -353, -746, -912, 686, 785
+        .string "lrwcqoykzehsjehc"
+        jsr L101
+        add L7, r3
+        .data -899, -929, -870, -412, 804, -454, -469, -137, 469, -76, -233, 617, -508, -731, -457, -909
+        .data 814, 558, 166, 293, 69, 478, -161, 803, -99, -765, -57, -54, 996, -35, -664, 793
+        .string "lxzrvbsujxhyaa"
+        .data 691, 514, 239, 1, -463, 122, 415, 793, 855, 640, -549, 250, -713, -86, -359, 803
+        cmp #25, *r5
+        .string "ttvtmihbhzx"
+        .data -20, -575, -596, 685, -765, 159, 774, 684, 772, 747, 458, 310, -882, -628, -162, 255
+        .data -283, -374, -447, -22, 281, -958, 484, 296, -53, -918, 713, 816, 891, 501, -716, -300
+        .data -705, 492, -223, -364, 302, -33, 409, -508, -41, -243, 393, 343, 45, 754, -360, -275
+        mov *r7, L6
+        .data 356, 83, 766, 348, -888, -718, 872, -2, 106, 233, 289, 165, -103, -506, 595, -256
+        sub L64, *r4
+L9:        .data 95, 546, 384, 652, 776, -524, 476, 441, -285, -223, 830, 782, 87, -709, -840, -525
+        .data 240, -412, -21, 558, -609, -320, -643, -390, -295, 835, -523, 260, -358, 788, 484, 982
+        .string "iqfvdnrvfcvk"
+        .data -777, 77, -136, -986, -369, 486, 785, 378, -230, -947, -558, 319, 913, 551, 26, -285
+        .data -904, -56, 806, 431, 86, 899, 983, -824, -522, 178, 723, 191, -67, 976, -212, 723
+        .data -182, 229, -636, -928, 310, -590, -642, -869, 281, -777, -500, 224, -542, -141, 602, 312
+        add *r0, *r1
+        .data 527, 365, 781, 730, 894, 201, 76, 901, -509, 901, -299, 714, -302, -346, -199, 671
+L10:        .string "mlmkynmnupwcxork"
+        .data 998, 441, -722, 604, 605, -341, -453, 74, 122, 43, -775, -276, 750, 227, -941, -654
+L11:        bne L1
+        .data 66, 751, 844, 709, 793, 215, -216, -45, -601, -687, -22, -625, -862, -898, 799, -82
+        .data -577, -112, 169, 286, 715, 702, 27, -516, -455, -8, -101, -516, -17, -640, -270, -2
+        .data 992, -8, -166, -701, 832, -18, 11, -651, -548, 49, -313, 877, -256, 967, 282, 217
+        .data 157, 834, 649, 992, -581, -251, -584, 36, -47, -670, 732, 683, 855, -986, -67, 325
+        .string "tnvmtrcjlczic"
+        .data 518, -730, 572, -838, -734, -226, 317, -565, 12, 559, -404, -800, 648, -270, -669, 283
+        .data -634, 626, 277, -172, 879, 673, -80, 802, -342, -895, -678, 988, 240, -537, 851, 399
+        add #4, r5
+L12:        .data -417, 986, -592, 803, 414, -546, 922, 166, 894, -523, 715, 157, 109, 834, -47, -766
+        jsr L185
+        cmp r2, *r7
+        .data -333, -903, -148, -883, -221, 406, 732, -579, 80, -816, -34, -523, -227, 908, -295, 19
+        .data 865, -770, 921, -700, 24, -991, 162, -106, -717, -362, -549, 10, 446, 628, 642, 360
+L13:        add r3, r0
+        .data -884, -220, 626, -916, -375, -666, -817, 649, -829, -301, 52, 617, -831, -261, 463, 872
+        prn L13
+        .data 37, 317, -876, 932, -979, 57, 144, -643, -943, -248, 778, 863, -562, -934, -59, -836
+        bne L166
+L14:        add #-21, r2
+        .data 898, -661, 155, -653, -50, 782, -852, -933, 214, -645, 190, -913, -567, 618, 552, 391
+        .data 76, 741, 775, -188, -337, -362, -487, 139, 820, -630, 400, -911, 221, 371, -676, -494
+        .data 219, 83, -660, 566, -746, 974, 329, -781, -598, 212, -160, -926, -634, 417, 48, 269
+        .data 283, -986, -166, -199, 260, -44, -283, 932, -647, 991, 537, -671, 512, -806, -478, 376
+        .data -761, 158, -132, -950, 482, -394, 847, 804, -285, -92, 313, -736, -45, -874, -212, -508
+        .string "jnwswscocoklgjoook"
+        .data 145, -22, -407, -320, 505, 778, -145, 253, 644, -91, 118, 925, 657, -179, 959, 569
+        .data 531, -743, 206, 264, 504, 191, 568, 38, -395, -720, 788, -326, 197, -10, 980, 868
+L15:        .data -620, 378, 703, -542, -22, -803, 507, 15, -262, -83, 295, -205, -836, 17, -124, -474
+        .string "wpzkrodvjrbnd"
+        .data -199, 381, 533, 128, -838, 116, 656, 332, -301, 540, -28, 106, 23, -107, 636, -277
+        .data 152, -486, -759, 563, -264, -72, -492, 284, -713, -572, 879, -782, 152, -563, -949, 801
+        .data -492, -530, -278, 592, -437, -387, -125, -943, -543, 355, -935, -654, 313, -977, 599, -714
+        inc L78
+L16:        cmp r6, *r3
+        add #61, r4
+L17:        add #83, r7
+        .string "kodykpiopqowroquv"
+L18:        .string "pptubixyhfbxgxdz"
+        .data 906, 866, -682, 462, -339, 207, 393, 994, 475, -7, -212, -94, 47, 557, 673, -25
+L19:        bne L112
+        .data 232, 816, 579, -336, -145, -10, 994, -322, -1000, -799, -621, 360, 444, 771, -926, -806
+        bne L11
+L20:        .data 614, 453, -453, 112, -252, 863, -344, -104, -987, 243, 9, 690, 265, 224, -191, -464
+        .data -1000, 547, 858, -558, 483, -511, 508, -332, 562, -299, 901, 769, -756, 585, -989, 752
+        .data -842, -474, 967, -717, -326, -841, -93, -776, 900, 434, -295, 806, -962, 827, -90, -872
+        .data -26, 885, 601, -613, 974, 516, -207, 209, 811, 943, -816, 879, -434, 585, 235, -968
+        .data 869, 878, -681, -753, -936, 510, -474, -613, 276, 746, -588, -932, 346, -172, -908, 326
+        .string "ezkmobhbwnqqhtc"
+        clr L11
+        .string "hdhptpzlpgtqcr"
+L21:        mov #98, L10
+        .data -470, 737, -4, 179, -934, 858, 824, -718, 112, 471, -340, 922, 269, 807, -51, -169
+L22:        cmp L5, r5
+        .data -369, -686, -608, 66, 556, -922, 46, 66, -313, 121, -653, 651, -88, 946, -569, 839
+L23:        jmp L13
+L24:        .data 933, 239, -186, -84, 803, -445, -14, 540, -475, -691, -535, 221, -939, -149, 687, 704
+L25:        .data -168, 221, 206, -924, -918, 514, -561, -946, 550, -930, -788, 496, -922, -612, 746, 213
+        .data 299, -242, -751, 19, -122, 814, -382, -722, 212, 360, 40, -72, 987, 217, 438, -720
+        .data -448, -375, 408, -382, -123, -55, 701, 934, 444, 96, -770, -127, -432, 216, 89, 522
+        dec r5
+L26:        mov L26, *r4
+        .data -590, -819, 869, -566, 462, -726, -309, -290, -290, 872, 110, -392, 731, -272, 430, 933
+        mov #40, *r0
+        .data -115, 491, -259, 34, -846, -639, -849, -748, 793, 620, 27, 137, -19, -916, -170, 754
+        .data 801, 122, -997, 569, 710, 933, 370, -522, 998, 904, 601, -638, -459, -935, 985, -587
+        inc r0
+        .data -776, -74, -916, -746, 597, -354, -9, 142, 553, 464, -505, 810, -527, -796, -13, -498
+L27:        mov L9, r6
+        .data 66, 814, 152, 730, 87, -194, 544, 384, 687, -708, 413, -851, -632, -615, -986, -755
+L28:        .data -706, -408, 354, -204, -771, 921, -668, -395, -824, -559, -272, 44, -299, -213, -848, -812
+        dec L88
+        .string "oapclmgtkf"
+        .data -150, 3, -918, 108, -993, 597, -249, -716, 948, -550, -126, -839, 212, 534, -205, 847
+        .data -673, -94, -926, -429, 206, 495, 792, 394, -101, 113, -957, -627, -770, 98, 696, 326
+L29:        .data 318, -382, -173, -490, 420, 815, 327, -246, -714, -134, -276, -317, 398, -634, -189, -365
+        .data 900, -355, -896, -892, -699, -44, -428, -233, -321, -683, 918, 450, 768, 644, -469, -405
+        dec L19
+        bne L37
+        .string "vnjdfkkdq"
+L30:        .data 983, 96, 720, -397, 407, -193, -463, 803, -377, -441, -844, 671, 769, 59, 75, 982
+        .string "ouffhpasfdg"
+        .data 794, 769, 483, -674, 32, 662, 981, -184, -827, 331, 441, 272, 922, 287, 463, 976
+L31:        inc L26
+        dec *r5
+        .data 496, 845, -998, 638, 500, -836, -811, -387, -394, -68, 784, -701, -96, 411, 155, 100
+L32:        .string "bwbgnwaagp"
+        .data 158, 908, -953, -723, 491, -144, -432, 498, -109, 749, -174, -200, -731, 204, 515, -139
+        jmp L53
+        .string "oxnfpewkanj"
+        sub L174, *r6
+        .string "eskpdbqdlaavztp"
+        .string "cecidqofeqddgrjvzt"
+        .string "zgafxtvhvixy"
+        cmp #-33, r1
+        sub #-66, *r5
+L33:        .string "snjitweenkdyaer"
+        .data -337, -20, 640, -123, -955, -965, -576, -547, -254, -282, -82, 12, 250, -957, -603, 716
+        bne L16
+L34:        .string "laijavdpkxtnlnnvvm"
+        .data 33, -248, 649, -795, -550, -960, -56, 700, -659, -744, -276, 462, -664, -596, 995, -693
+        .data -287, -877, 827, -594, -513, 180, 158, 149, 740, 336, -170, 413, 143, -975, -346, -820
+        .string "dqfjhzfzqhg"
+        cmp r6, r1
+L35:        jsr L6
+        sub r1, L68
+        .string "replfpgu"
+        .data -47, -751, 967, -77, 430, 198, -649, -393, 355, -781, 887, 284, 586, 936, -339, 94
+        .data 117, -13, -771, -464, 469, 744, -525, 989, 322, -449, 908, 592, 869, -598, 449, 317
+        mov *r0, *r6
+        .data 522, -99, 230, 563, 530, -58, -120, -546, -586, 936, 976, -711, -367, -668, -494, 12
+        .data -982, -776, 397, -851, 329, 911, 40, -102, -716, 547, 632, 843, -21, 416, 292, -380
+L36:        prn *r1
+L37:        .string "emfitounogjpjt"
+L38:        dec L22
+        cmp *r5, *r2
+        .data 794, 643, 902, -123, 308, -848, -389, 509, 795, -19, -447, -677, -46, 641, -281, 432
+        mov r5, L169
+        .string "dcmvehvrmzmsz"
+        bne L105
+        .data 521, 15, -526, 669, 920, 655, 204, 425, -486, 393, 989, -714, 372, -904, 200, -367
+L39:        .data -200, 155, 129, -365, -757, -244, 984, -988, -50, 167, -434, 919, -985, -782, 761, 768
+        prn *r7
+        add L106, *r4
+        mov *r1, *r3
+        .string "vrdmyqybpsvckfdazb"
+        .data 435, 252, 646, 830, 369, 216, 11, -29, 936, -955, -593, 248, -708, 235, 69, -763
+L40:        .string "lwgvmcgaregsdriykz"
+        .data -315, 59, 995, -38, -645, 820, 737, -861, -508, -846, 428, -707, 24, 803, 221, -96
+        .string "sxurrqnwvvr"
+        .data -532, -298, 348, -794, 533, 985, 617, -620, -442, 741, 324, 54, -379, 796, 983, -469
+        .data 188, 694, -612, 631, 931, -986, -199, 23, -999, -824, -701, 657, 995, -260, -541, 984
+L41:        .data 447, 270, 997, 109, -620, 2, 86, -52, 721, -388, 998, -359, 169, -630, -34, -357
+        add L130, r6
+        .string "bcjcvvkababdmlzesb"
+        .data -291, 717, -681, 573, -645, -930, -639, -73, -491, 572, 958, -207, -379, 432, -383, -526
+        prn L182
+        .string "sapxygduqfi"
+        add *r2, L24
+        jsr L20
+        .data 950, 214, -215, 306, -707, -613, -772, -82, -562, 733, 978, 937, -74, -412, 353, -412
+        .data -706, -716, -629, -629, -820, -884, -769, 550, 245, 712, 513, 918, -102, 9, -987, 742
+        .string "nnzpcqflyny"
+L42:        bne L2
+        .string "zohktzjnpfntqmrlv"
+        .string "zhyvxnqfq"
+        .string "iopstcnlkpepp"
+L43:        .data -540, -603, -791, -713, -430, 545, -165, 750, 595, -426, -187, -351, -285, -134, 210, -796
+        not *r0
+        .string "uzeadrcshuvy"
+        bne L84
+        .string "elizbqjafotru"
+        .data 508, 849, 669, 698, -532, 684, 342, -310, -527, -779, -76, 960, -226, -703, -123, 389
+        .string "nelfqxyrau"
+        .data -838, 883, 402, 433, -713, -463, -216, 573, 154, -541, 2, -177, 676, -483, -687, 651
+        .data -109, 552, -373, 106, 713, 332, -823, -264, -215, -422, 87, -882, 761, -294, 46, 61
+        cmp #28, *r7
+        .data -763, 150, 922, -664, -58, -122, 117, -96, 356, 956, 45, -952, -587, 745, -895, 538
+        clr r4
+L44:        .data 788, 679, 943, -746, 892, 28, -848, -638, 314, -775, 967, 526, -134, -307, -820, -696
+L45:        cmp L110, *r5
+        .string "tncmqqgoeahoufppv"
+        .data 793, 492, 957, -164, -320, -332, 166, 759, -157, 161, 938, -890, -867, 413, 803, 990
+        .data 384, 463, 840, -646, 528, 506, -428, 436, -227, -237, 441, 230, 504, 906, 877, -121
+        dec r2
+        .data -636, -184, -364, 823, 766, 49, -757, -410, -351, -244, -795, -95, -708, -668, -406, -545
+        sub r2, L17
+        .data -546, 272, -226, -499, 654, -651, -410, 707, -654, -327, -837, 701, -823, -366, 507, 516
+        cmp #31, *r7
+        .string "utwxiaqcqerqowy"
+        .data 142, 948, 324, 454, 930, 360, -91, 422, 618, 511, -9, -615, -710, 820, -230, 899
+        .data -643, 230, -383, 471, -779, -851, 278, -669, 686, 952, -71, 78, -607, -550, -163, 741
+        .string "lbfsjguotwbkqhk"
+        .data -851, 448, 866, 490, -739, 815, 879, -914, 301, -208, 11, -313, -965, -758, 276, 781
+        jsr L183
+        sub #-8, *r2
+        inc r0
+        .string "lmcijaiubbmxu"
+L46:        .string "cknxwfhobnt"
+        .data 243, -526, 112, -720, -453, -927, 26, 349, -90, 98, 436, 410, 256, 27, -224, 394
+        red r5
+        clr L154
+        clr L16
+        .data -202, -321, -773, 668, -217, 501, -134, -607, -19, -780, -480, 352, 853, 513, 436, 446
+        .string "chvpvfemwzhdeb"
+        cmp L176, *r7
+L47:        .data -212, -455, -932, 68, 2, -795, 233, 979, -742, -411, 541, 187, -290, -585, -311, -562
+        not r4
+        .data -636, -524, 759, -853, -558, 444, 220, 655, 373, -129, 52, 852, 351, 184, 738, -738
+        .data -26, 492, -234, 489, -933, -172, -451, 823, 305, 334, -630, -575, -743, -621, -306, 699
+        .data -99, 864, -522, 842, 428, 450, -957, 432, -180, -943, 74, -430, 484, 525, -502, 213
+        .string "kfpprpyvxhs"
+        not L47
+        .data 353, 425, 208, 624, -269, 519, -764, -939, -464, 575, 895, 896, -345, -660, -929, 15
+        .string "ulgzjrsqyqub"
+        .string "axvafurvjpuqcz"
+        prn #-4
+        .string "atpauwsbdnuwihp"
+        .data 39, -538, 75, -565, -292, 977, 23, -120, -260, -473, 114, -633, 10, 185, -399, -683
+        sub r3, r3
+        .data -977, -631, -4, 264, 322, -818, 622, 286, 951, 151, 845, -202, -286, 923, 285, -256
+        .data -80, 500, 635, -460, -44, 532, 760, 547, 873, -480, -942, -22, -701, -853, 571, -137
+        .string "wlgclnstoacpccb"
+        .data -308, 924, -380, 370, 896, 494, 421, -680, -338, -199, -587, 446, -638, 524, 775, 94
+        add r2, *r1
+        .data -23, 708, -486, -807, -897, -397, 666, 303, -569, -411, -180, 765, -275, 795, -737, -101
+        .string "pbvxatwdifx"
+L48:        sub *r4, L116
+        .data -47, 561, -703, 1, 11, 509, -159, 876, -782, -254, 177, -425, 158, 541, -583, -996
+        jmp L173
+L49:        .data -495, -289, -318, -744, -647, -375, -774, 346, -299, -574, -449, 164, -598, 756, -45, -235
+        .data -178, 540, 755, 313, 873, -581, 513, 693, -659, 186, -667, -842, -806, -518, -804, 660
+L50:        .data 493, 424, 251, -898, -551, -583, -961, -207, -317, -538, -222, -212, -896, -702, 474, -457
+        bne L23
+        mov #-86, L86
+        .data -620, 43, 723, -960, 905, 886, -338, -934, -144, -491, -471, -797, 545, -200, 333, 942
+L51:        jmp L39
+L52:        add *r6, *r1
+L53:        cmp *r4, #-99
+        .data 4, -22, -984, 312, -778, 85, 877, 778, -529, 387, 51, 605, -117, -604, 733, -719
+L54:        .data -211, 371, 588, -339, -355, 582, 638, -315, -673, -961, 789, -262, -299, -940, 651, 611
+        .data 239, -797, 808, 320, 861, 782, 976, -297, -49, -612, -872, -82, -106, -785, -753, 359
+        sub #-72, L77
+        .data -796, 275, 579, 483, 218, 470, 312, -870, -882, 763, -582, 197, 910, -287, -975, -925
+L55:        .data 171, 219, 335, 257, 60, 544, 629, 945, -154, 345, -56, 521, 518, 189, 279, 57
+        .data 78, 715, 137, 66, 788, -814, -50, -319, -444, -382, 328, -831, 603, -480, -346, -847
+        .string "quvaenhgdu"
+L56:        .data 468, 590, 750, 852, -28, -675, -935, 220, 869, -900, 296, -877, 111, 329, 670, 499
+        bne L47
+L57:        .data -681, -37, -525, 469, -923, -489, 459, 372, -615, -355, 42, 258, 221, 956, 185, -516
+        .data 742, -668, 282, -409, -964, 517, -645, -121, -717, -410, 148, 738, -659, 272, 107, -843
+        .data -704, 452, -77, -821, 313, -379, 851, -762, -675, -578, -798, -208, 866, -320, 651, 965
+        .string "rlttxxbmxgmj"
+        .string "psrtolvrhmi"
+        .data 496, 714, 355, -157, 268, -736, -399, -271, -581, 55, 208, 691, 532, -70, 207, -481
+        .data -47, 184, 982, 143, -442, 879, -634, 90, -615, 472, -233, 796, -583, 861, 612, 539
+        .string "xxqunvytqwkupfm"
+        mov #-34, r5
+        .string "vgbqjdajzsry"
+        .data 494, -989, -608, 511, -338, 583, 929, 170, 56, 321, -337, 468, 66, 663, -651, -457
+        clr r7
+        .data -706, 690, 865, 762, -24, 844, 553, 842, 766, 953, 553, -55, -732, -381, 62, 537
+L58:        .data -702, -418, -735, 803, -791, 729, 684, 62, 775, 626, 996, -75, -333, 567, -191, 57
+        .string "ekpgkvgdjbcfk"
+        .data 847, -331, -635, -936, -655, 990, -492, -581, -865, 743, -951, 110, 702, -660, -31, 181
+        inc *r1
+        .data -283, 159, 304, -403, 194, 263, 346, 782, -449, -99, -444, 777, -206, 124, -76, -300
+        add r4, L16
+        .data -47, -161, -147, 734, -90, 570, -102, -285, -144, 973, -669, -437, -864, -312, -117, 170
+        .data -347, 945, 118, -921, -638, 923, 966, 525, 95, 205, -10, -565, 730, 682, 170, -373
+        jmp L162
+        not r4
+        .data 287, 975, -412, 119, -570, -183, -418, -717, -981, -262, -993, 375, -985, -771, -356, -604
+        .string "oppipowsrh"
+        .string "otsmsanqerqbmwbt"
+        .string "uccuwhhctbx"
+L59:        .data 784, 610, -266, -227, -55, 850, 213, -944, -94, 974, -608, 379, 553, 897, -5, -794
+        .data -314, 236, 541, 920, -853, -690, -433, 903, 327, -508, 289, -133, 169, -424, 291, 61
+        .string "umhcwxspueu"
+        .data -141, -928, 670, 400, 245, -365, -511, 618, -513, 232, 626, 505, -645, 92, -427, 886
+        sub L24, L32
+        mov *r1, L111
+        .string "mzqzvfxhot"
+        .data -272, -26, 123, 556, -439, -421, 366, -918, -45, 331, 13, 585, -433, -574, -899, 816
+        add r2, r7
+        .data -810, -946, 762, 871, -35, 631, -852, -690, -164, 79, 908, -576, -98, 209, -146, 896
+        .data 391, 220, -978, -859, 179, -739, -120, -718, -990, -429, -879, -559, 519, 318, 325, -948
+        prn L63
+        .data -569, -536, 256, 97, -158, -348, -240, -584, -88, -713, 144, 698, 284, -906, -914, 618
+        .data 189, 454, -246, 515, -820, -924, -192, 811, -505, -434, -620, 894, -513, -323, 167, -7
+        mov *r3, *r2
+        sub L73, *r0
+L60:        .string "fhfgowfmyyr"
+        .data -403, -215, -115, 938, 643, 832, -890, -516, 852, 696, 45, 302, 160, -999, 103, 709
+        .data -699, -105, -909, -636, -987, 357, -57, -737, -200, 329, -938, -210, 712, 735, 598, -365
+L61:        sub #-96, *r1
+        .data 528, 269, -409, -790, -180, 264, -398, 99, -522, 495, -195, -522, 317, -313, 993, 875
+        .data -269, 593, 403, 995, -558, -785, 551, -926, -958, 830, -70, -134, 171, 616, 747, -984
+L62:        .string "ptmrmhcwynvkw"
+        .data -951, -804, 77, -630, -476, 57, -116, -143, -147, -621, -424, -313, -268, -628, -31, 687
+        mov #-70, r3
+        .data -698, -379, 912, 621, -373, -930, -772, 809, -894, 349, 370, 247, -238, 952, 765, 61
+        add L34, *r0
+        .string "ptvahglbmp"
+        .string "fjteognlvez"
+        mov L113, L119
+        .data -62, 565, 305, -351, 566, 667, -342, -940, 717, -922, -705, -443, -11, 16, 648, -813
+        .data 826, 433, 45, -622, -1000, 182, -695, -376, 392, -437, 185, 514, 247, 898, 566, 332
+L63:        .data 820, -593, -403, 263, 34, 158, 756, -925, -974, 706, -416, 995, 168, -730, 635, -134
+L64:        .data 606, -227, -879, -713, 647, 339, 347, 351, -586, -724, -448, -766, -646, -447, 524, 489
+        red L112
+        .string "wjchoawavyav"
+L65:        .data -835, 465, -370, 564, -693, -333, 352, 17, -753, 882, 22, -560, 48, 945, 515, 774
+        .data 247, 891, -942, 411, -879, -694, -578, -899, -700, 124, 784, -712, -565, -753, -219, -951
+        red *r5
+        .data -505, 506, 467, 207, -787, 274, -927, 526, -465, -92, 681, -167, 657, -20, -870, -142
+L66:        .string "lsvljppcwsl"
+        .string "krrarjthrhsa"
+        .string "bmevmqsfswqfka"
+        jmp L172
+        bne L57
+        .string "gjvodhygxrnj"
+        .string "ujudcyrjsm"
+        .data 962, -457, -922, 529, 578, -481, 262, -395, -453, -193, -90, 130, 94, 325, 242, 407
+        cmp #80, *r7
+L67:        cmp *r6, #46
+        cmp #8, #-76
+        .string "fplvshfhhnokdhxcy"
+        .data 290, 451, -940, -410, 343, -527, 317, -939, 742, -100, -583, -612, 199, -248, -966, 380
+        .data -666, 274, -935, 25, 94, 936, 5, -517, 559, -562, 547, -191, -966, 37, -419, -868
+L68:        clr r6
+        .string "vszvrppnvidckrtgk"
+        .data -836, -248, 366, 435, 675, 644, -590, 581, -918, 344, 321, -223, 233, 272, -984, 197
+        .string "otlvcjxwuleoigt"
+        .data 275, -494, 594, -313, -928, 598, 452, -902, 151, -467, 263, 107, -203, 609, -700, -698
+        .data 288, 942, -743, -400, -274, 29, 716, -918, -683, 728, 106, -874, 576, 420, -38, 976
+        add r2, *r6
+        cmp r1, #48
+        .string "atzsrsjbrhcrn"
+        add r7, r7
+        mov r4, L90
+        .data 388, 435, -173, 434, 852, -309, -966, -560, -402, 183, -515, 153, -438, -623, -468, -912
+        .data 869, 653, -311, -879, -187, -797, 105, 246, -334, -655, -584, 850, 644, -85, 821, -960
+        .data 154, -378, 498, 438, 765, 238, 389, 24, 620, 382, 420, -658, 566, 732, 725, -338
+        .string "tompaucquqku"
+        .data -430, -799, -990, -800, 751, -369, -727, 584, 729, 561, -312, 245, 16, -389, -146, 287
+L69:        .data -467, 510, -709, -112, 997, 420, 663, -293, -706, -165, 305, -299, -872, 413, -693, 63
+        jsr L168
+        .string "bxktwhwvznxzu"
+        .data -343, -82, -739, -108, -540, -365, -630, -142, 371, -793, -515, -306, -14, 461, -60, -681
+        .data 448, 501, 202, 877, 512, 662, 515, 356, 337, 662, -364, 942, 423, -799, -647, 876
+        .data -155, 70, 385, -316, -142, 743, -273, -34, -484, -552, 624, 138, 811, 110, 418, 343
+        .data -572, 343, -769, -12, -689, -1, -729, 47, 134, -707, -461, 731, -929, -499, -313, 53
+        jmp L33
+L70:        .data -74, -399, -185, 464, -137, 536, -859, -772, -847, 10, -328, 448, 296, 319, 922, 132
+        .string "sfoapznhihp"
+        .string "qftejsgpocs"
+        .data 754, 65, -999, -29, -712, 801, -405, 974, -676, 581, 922, 450, -451, 154, 697, -176
+        .data -814, 213, -401, 548, -570, -254, 627, 131, -636, 572, 17, -127, 59, -669, -476, -125
+        .data -783, -336, -835, 636, 619, -533, 63, 722, -119, -195, -833, -988, -791, -748, -932, -932
+        .data 125, -84, -39, -461, 712, -29, 857, -587, -400, 849, -988, 681, -269, -336, 770, -701
+        cmp #-92, *r4
+        clr L188
+        .string "gruhaypwbltye"
+        .data 898, 880, -933, -313, 295, 727, -340, -635, 740, -594, -301, 237, 474, 417, -915, -959
+L71:        .string "ffeaiqxwawudxyvnipsir"
+        bne L57
+        .data -158, -11, 319, 990, 206, 824, -24, 489, 269, 762, 588, -167, 755, -996, 142, -102
+        bne L149
+L72:        .data 202, -601, -932, 120, 797, -635, -80, 881, -992, -618, -912, 803, 675, 61, -732, -586
+        .data 352, 889, -341, 48, -700, 338, -60, -860, -571, 813, 687, -872, 954, 673, 667, 666
+        add L52, r6
+        cmp r7, #-76
+L73:        .data 723, -432, -150, 474, 608, 336, 95, -917, 910, -438, 108, 258, 876, -211, -477, 899
+        .string "aikuezkymvws"
+L74:        .string "wsbpyfbhqmktu"
+        mov r7, r7
+L75:        .data -865, -785, -551, 629, -344, 271, -126, 3, 277, 3, 686, 314, -636, -314, -710, -845
+        .data 365, 396, -426, 721, 388, 488, -872, 425, -337, -170, -697, 547, 88, 50, -708, 877
+        .data 608, 24, 488, 670, 280, 135, 263, 822, 706, 217, 528, -876, 175, -233, -1000, -884
+L76:        .data 827, -648, -116, -551, 53, 348, -723, 692, 223, -869, -504, -413, -177, 587, -90, -259
+        .data 281, -150, -281, 204, 445, -353, -955, 426, -256, -693, 186, 301, -672, -143, 206, 275
+        .data -786, -23, -277, 596, -768, 309, -163, 75, 520, -283, -749, 790, -436, 363, -208, -765
+        .data 365, -305, 752, 878, 229, 893, -616, -729, -794, 309, -186, -125, -904, 227, -478, 228
+        .string "fyyrjyvlolng"
+L77:        .string "pcufejogjlseaetugxud"
+        add L16, *r4
+        .data -342, -996, 9, 413, -403, -752, 916, -185, -215, -813, 248, 230, -207, -111, 501, 671
+L78:        .data 509, 815, 557, -602, -983, -499, 814, 916, 58, 994, -568, -557, 161, 900, -307, 341
+        .data 770, -394, -983, 260, 571, 104, 737, -507, 887, 668, 312, 965, -128, 0, -534, 169
+        .string "gcymrbgmufg"
+L79:        sub r5, L69
+        jmp L152
+        .string "xcviymdauf"
+        .data -228, -887, -893, -914, 336, -285, -741, -770, 211, 856, 914, 759, 400, 422, 332, -12
+        red L25
+        .string "ddzltmdsbfxo"
+        .data 576, 363, -546, 910, 755, -414, -218, 793, 84, -256, -314, 233, -888, 373, 97, 111
+        .string "krfyrjnnkmkmf"
+L80:        inc r5
+        .data 13, -454, 958, -511, -1000, 516, -118, -993, 579, -72, 211, 880, -627, -460, 721, -118
+        add L155, *r3
+        .data 520, -17, 696, -182, 559, -945, 504, 497, 310, 890, -942, -742, 48, -801, 86, 435
+        .string "zwcsjnmlb"
+        .data -592, 597, 698, -933, 676, -837, 441, -946, -341, 888, -126, -113, 638, 64, 791, -468
+L81:        .data 728, 647, 199, -102, -603, 812, 188, 880, 564, -139, 884, -656, 194, -688, -402, -655
+        mov #-71, L135
+L82:        add r5, *r1
+        .data 184, 681, 430, -764, 392, -602, 443, 821, 362, 24, -218, -99, -995, 852, 627, 928
+        .data -480, -948, -909, -971, 541, 297, -57, -948, 827, -972, -460, -4, -778, -101, -203, 890
+        .string "fsoxeqysysqng"
+        .string "nnqvmtminvsnsqy"
+        .data -562, 132, 936, 606, -259, -771, 594, -241, -669, 954, 533, -603, 878, -370, -504, 595
+        jmp L143
+        .data -383, -142, 642, 664, 787, -648, -184, 656, 630, -907, -917, 45, 46, -440, 818, -707
+        .string "xyalrpkenqwla"
+L83:        .data 129, 593, -170, 175, -190, 942, -593, 324, -5, 592, -717, -355, -626, 101, -825, -511
+L84:        .data 882, 809, -221, 594, 326, -254, 808, 228, 750, 564, -986, 500, 151, 896, 534, -263
+        add L179, L178
+        dec L142
+        add r3, *r1
+        .data 224, -794, 474, 122, -22, -567, -923, 278, 357, -299, -767, 374, 297, -794, 828, -471
+        .data 549, -522, 315, 200, -574, -419, 974, 561, 272, -49, 60, -246, 703, -531, -5, -522
+        bne L55
+        .data 2, 209, -150, 171, -682, -312, -315, 969, 15, -682, 351, 367, 964, -320, -66, -276
+L85:        red *r7
+L86:        cmp r2, #44
+L87:        .data -467, -96, -308, 770, -899, 922, -411, -213, 204, -118, -23, 437, 206, 591, -652, -188
+        .data 922, 367, -292, -919, -978, -573, -623, -388, 1, 6, 149, 707, -534, 123, 744, 100
+L88:        .data -344, 304, 732, -403, 485, -495, -850, 587, -917, -862, 354, 709, -23, -766, 99, -302
+        add L42, r4
+        .data 472, 256, 55, -586, -749, 852, 578, 260, 609, -825, 330, -508, -140, 159, 733, -958
+        .data 804, 633, 756, -32, 567, 478, 639, 516, 975, -128, 948, 588, -64, -928, 38, 550
+        .string "yzhuqkhrlww"
+L89:        .data -665, 776, -325, 398, 502, 4, -183, -325, 808, -377, 548, 330, 433, -974, 993, 72
+        sub #45, L0
+        .data 171, -227, 596, -551, -264, 48, 637, 769, 653, -809, 679, 753, -424, -838, 611, 640
+        .data 993, -377, -773, -923, -669, -218, -167, 670, 832, -328, 32, -24, -137, -664, 352, 261
+L90:        .data 562, -685, 228, 885, 176, 970, 481, 787, -9, 996, 286, 378, 957, 495, -183, 614
+        .data -111, -865, -263, -42, 332, 21, -141, 9, -601, 74, 703, -88, -223, -995, -540, -556
+        .string "fctrbhgwxu"
+        .string "ddjzznapw"
+        .data -73, 394, 600, -670, -788, 981, 933, -94, -22, -635, -595, 145, -308, 159, -996, -260
+        .data 474, 632, 455, 903, 570, 678, -724, 861, 354, 772, -157, 801, -323, -717, -411, 672
+        .string "uuudfjguikckavo"
+        .data 393, 179, -14, 940, -526, 741, 888, 384, -765, 101, 149, 295, 648, -40, 430, 228
+        .string "norfdzvxodhf"
+L91:        .data -74, -349, -178, -360, 87, 226, 183, 3, -454, 683, 726, 236, 307, 48, -388, 351
+        bne L7
+L92:        .data 399, 686, -403, -836, 68, 940, 697, -114, -857, -385, 250, -720, 938, -925, 197, 958
+        .string "anbhsweijajc"
+        .data 553, -659, 884, 847, 871, -295, 93, -844, -542, 415, 700, -82, 697, -524, -317, -689
+        .data -828, 622, 618, -592, -241, 913, -336, -728, 633, 207, 880, -819, 76, -845, -191, -495
+        .string "ofmflxjtexay"
+        add L83, L155
+L93:        .data -481, 584, 335, 534, -281, 723, 36, 305, -799, -398, 874, 124, 567, 163, -725, -820
+        .data 536, -289, -341, -505, 328, -624, 132, 768, -240, 429, -571, -660, 737, 307, 680, 796
+        .data 212, 458, 599, -126, 569, 999, 757, 216, 336, 630, 599, 10, -224, 713, 797, -739
+        .data 378, 945, -944, 666, 226, 618, -330, -654, 916, -37, -519, -500, -121, -601, -369, 264
+L94:        .data 999, -196, 428, -164, 902, -268, -658, -157, 770, 519, -806, 217, 624, -424, -173, 35
+L95:        sub #67, *r4
+        clr r3
+L96:        .data 137, -869, 418, 395, 501, -992, 544, 214, 630, -49, -833, -957, 969, -197, -127, 283
+L97:        jsr L14
+        mov #22, L160
+        .data -61, 567, 132, -558, -166, -183, -756, 646, 292, 680, -377, 655, -90, -815, 475, 926
+        clr r5
+        bne L73
+        .data 906, -85, 577, -409, -14, 602, 105, 256, -910, -992, 633, 625, -570, 733, 945, -581
+        bne L167
+        .data 813, -446, 30, 807, 124, -475, 489, -139, 215, -956, -767, 372, 940, 966, -280, -860
+L98:        bne L91
+        .data -601, 650, 848, 490, 229, -970, 397, 618, -203, -736, 300, -462, -216, 694, 481, 489
+        .data 368, -148, -400, 968, -889, -789, 460, 212, -565, 231, -350, -956, 20, -933, -272, -971
+        .data 64, -447, 935, 643, -43, 397, 907, 582, -74, -479, 685, -600, -563, -790, -136, 180
+        .string "rmiinesgbrgx"
+        .data -817, -702, -495, 792, -686, 644, 620, 148, 942, 296, 841, 477, -183, 209, -575, 44
+        clr r0
+        mov L74, L31
+        .string "fndnvmrlmnmncleki"
+        .data -57, -228, 960, 493, -185, -520, -616, 688, 412, -881, -620, 435, -74, -736, -472, -504
+L99:        .string "biaurrcajtsfjx"
+        .string "jxjvejgnfuz"
+        .data 122, -58, 454, -657, -750, 155, 44, 426, -557, -3, -684, -349, -262, 797, 77, 945
+        .string "lwkrlvxzw"
+L100:        dec *r4
+        .string "bndxtqdn"
+        jsr L156
+L101:        .string "vusyplymvsvhg"
+        .data -655, 4, 676, -402, -560, 73, 413, -9, -915, -728, 588, 592, 736, -575, 866, -358
+        .data 937, 894, -372, -774, 220, 82, -274, 948, 681, 637, -66, 952, -312, -342, -250, 582
+L102:        .data -548, 171, -130, -854, 688, -83, 285, 976, -616, -639, 660, -283, 667, -706, 842, -5
+        .data -470, -405, 322, 581, 190, -476, -133, 881, 653, 358, 255, -786, -411, 941, 611, 368
+        .data 20, -497, -908, -268, -825, -694, 603, 360, 658, 874, -112, 866, 599, 264, -36, -895
+        .data -234, 699, 140, -466, -523, -378, -621, 773, -446, -782, 284, 29, -209, 13, 482, 470
+        mov L169, *r2
+        .data 174, -429, 729, 333, -20, 553, 681, -373, 938, -761, -298, -864, 42, 387, -295, 309
+        .string "abzdzscdv"
+L103:        .string "fhtmltzrcjl"
+        .data -360, 524, -456, 131, -53, -273, 0, -238, -374, -388, 71, 279, -588, -412, 401, -58
+        add *r3, r0
+        inc *r3
+        sub #-2, r2
+        .string "sxqkoohnnlayph"
+        .data 256, 584, 291, 426, 460, -913, 735, -102, 859, 238, -643, 272, -43, 380, 162, -860
+        .data 468, -636, -312, -803, 261, -97, -830, 257, -435, 512, -845, -437, -296, -84, -342, -755
+        .string "biqqspjbnyal"
+        .data 94, -422, -445, 354, 626, -448, 114, 527, -598, -752, 404, 876, -398, -738, 637, -406
+        .data -744, -628, -853, -602, -399, 253, -112, 184, -605, -909, -809, -827, 484, -265, 798, 936
+L104:        .data 747, -940, -532, 358, 3, 175, 801, 49, -664, 187, 473, 883, -666, 483, 484, -486
+        jmp L109
+        .data 526, -31, -913, -994, 756, 867, -118, -62, 332, -676, -315, -701, -889, -89, 274, 4
+        dec r3
+        .data 541, -433, 723, -442, 932, -372, 670, -84, -896, 285, -522, -208, 996, -939, -411, -85
+        .string "jyawnhtvsjbmuw"
+        .data 818, 694, 348, -670, 70, -272, 866, 735, -234, -351, -210, -683, 555, 243, 407, -267
+        .data 696, 5, 20, 793, -114, 296, 123, 830, 166, 123, 771, 113, 676, 885, -515, 175
+        .data 789, 198, 448, 135, 959, 880, -107, -137, 67, 992, -106, -572, -153, 509, -131, 553
+        .string "mzdttrxb"
+        .data -403, 677, 603, -366, -483, -602, -288, -920, 676, -565, -891, 979, 465, -370, 634, -35
+L105:        .data 185, 401, 417, -206, 850, 621, -494, 157, -374, 584, -501, -291, -814, -348, -335, 472
+        cmp r0, r7
+        .data 724, -865, 556, -945, 253, -706, -578, -420, 926, -594, 78, -274, 769, 924, -736, 430
+L106:        .data -148, -362, 991, 610, 38, 807, -918, -501, -725, 781, -129, 510, -48, -764, 378, -11
+        sub r6, *r6
+        jsr L125
+        not L53
+        sub r2, L150
+        .data -88, 55, 751, 906, 529, 666, 356, 548, 588, 772, 171, 581, 181, 663, -246, 345
+L107:        .data -92, -774, -826, -655, -79, 592, 112, -533, 705, -610, -42, 541, -399, 72, 23, 130
+        sub #-33, L60
+        .data -559, -11, -769, -949, -874, -254, -266, -678, 512, 681, 824, 333, -979, -865, -671, -263
+        .data 220, -836, 407, -932, -799, 465, -270, -529, 31, 611, 452, -302, 856, 562, 930, 819
+        .data -933, -891, 194, -698, 13, 631, -89, 647, -588, -619, -184, 102, -522, -64, -561, -828
+        mov r6, r0
+        sub *r0, L142
+        .data -772, -832, -651, 390, -444, 104, 744, 958, -236, 192, 635, 305, -587, 352, -856, 329
+L108:        .data 469, 898, -256, 302, -630, 613, 423, 213, 115, -139, -734, 48, -76, -37, 750, -440
+L109:        inc r6
+L110:        .string "owkyoedgrntjnc"
+        .string "uegicraswmk"
+        dec L122
+        prn *r6
+        .data -706, -738, 445, 999, 963, 164, -635, 89, 760, -195, -715, 835, 866, 50, 812, 658
+L111:        sub *r4, r1
+        .data 995, -648, -483, 980, -627, 462, -919, -362, 379, 801, 178, -140, 808, 884, -710, 416
+        .data 933, 630, 798, 900, -724, 377, -508, 882, -15, -2, 92, -920, 661, 650, -80, 592
+L112:        .string "twkanlwkvkafyrvjomhw"
+        .data 544, 624, 788, -317, 783, -710, 243, -384, 752, -472, -702, 998, 435, 618, -232, 68
+        .data -807, 22, 657, -14, 116, 274, -777, -660, 728, 868, 52, -489, -166, -309, -519, 17
+        .data -763, -566, 267, 314, -196, -989, -754, -941, 760, 872, 560, 440, -771, 44, -228, 195
+        .data 307, 904, 465, -747, 782, -319, 659, 835, 85, 874, -117, 590, 30, 844, -273, 678
+        inc L37
+        .data -588, 736, -954, -611, 60, -902, -867, -24, 579, -465, -952, -780, -552, -250, 922, -204
+L113:        .data -239, -704, -417, -450, -184, 502, 913, 87, -240, -672, -617, 187, 28, -39, -885, -733
+        .data -798, 308, 485, 151, -899, 848, -173, -333, -435, 11, -976, -172, -455, -450, -191, -704
+L114:        .data 70, -799, 544, -855, -314, -380, -268, 70, -821, 844, -259, 489, -659, -230, -873, 617
+L115:        dec *r3
+L116:        .data -775, -481, 777, -462, 787, 644, -28, 926, 197, -494, -303, -931, -87, 150, -102, 97
+        .data 194, 322, -517, 170, -923, -414, 512, -301, -396, 843, -498, -72, 125, -50, -617, -51
+L117:        .string "irccubjhyf"
+        clr L175
+        .data -110, -794, 665, -308, 754, 587, -410, 53, 787, 396, 701, -847, -609, 591, 76, -176
+        .data 711, -974, -479, 879, -902, 533, -712, -63, -930, -623, -528, -909, 574, 981, -824, -835
+        prn L69
+L118:        .string "wivqcixqbx"
+        cmp *r3, #98
+        .data -149, 343, 561, 415, 794, -736, 360, 957, -656, -853, -872, -570, 802, 381, 555, 292
+        sub #30, *r0
+        .string "blzaohalxrxzgu"
+        .data -170, 711, -403, 952, 943, -476, 17, -588, 602, -558, -261, -285, 985, 828, 804, -340
+        .string "gbexsnws"
+        .data -661, -107, 984, -667, -723, 900, -863, -491, -665, 402, 506, -532, -418, 33, -102, 163
+        .data -140, 189, 449, -537, 856, -219, 16, -818, -856, -202, -37, 666, -470, -419, -601, -461
+        .string "lkrgypqmnfkyugaa"
+        cmp *r0, r1
+L119:        add #60, r4
+L120:        .data -205, -969, 134, -65, 498, 612, -379, -185, 804, 634, -970, 685, 943, -550, 747, -585
+        add *r7, *r1
+        add #-23, L123
+        .data -743, -871, 897, -358, -770, -56, 957, -52, 457, -810, 807, 236, -809, -466, 834, -230
+        .data -961, 94, 111, -764, -723, 687, 389, 198, 995, 338, -659, 396, -343, 276, 669, -374
+        .string "ubvtswsjgbatls"
+L121:        .data -386, 85, 700, -203, -999, 126, -681, -717, -804, -547, -380, -404, -716, -537, -244, -691
+        dec L83
+        .data -69, 303, -258, 381, 745, 8, -256, -399, 795, 305, -930, -123, -145, 275, -872, 116
+        jmp L156
+        jmp L99
+        .string "nuevigzionzjbgrs"
+L122:        .data -44, -836, -68, 135, -399, -173, 249, -886, -141, -703, -206, 681, 568, -449, -612, 161
+L123:        jsr L0
+        .data -23, -549, 60, -751, -858, 960, -327, 432, 829, 719, -70, 522, -10, -362, -326, -228
+        .string "znwcfpwpy"
+L124:        .data -20, 716, -270, -378, -622, 166, 756, 882, -480, -874, -751, 231, -507, -429, 915, -788
+L125:        dec r2
+L126:        jmp L129
+L127:        .data 875, -690, 239, 291, 580, -455, -233, 824, 253, -336, -847, -316, 973, 527, 971, 545
+        bne L38
+        add #75, *r7
+        red *r6
+        .data 37, -577, -98, 4, -759, -446, 988, -105, 838, -980, 933, 107, -273, -902, -261, -634
+        mov r2, *r4
+        .string "ihsutfssnldjz"
+        jsr L172
+        .data -599, 216, -774, -644, -884, 474, 640, 555, -886, 580, -916, -935, 922, -802, 815, -506
+        .data -400, -541, 464, -404, -422, 957, 144, -87, -620, 513, -561, -781, 656, 718, 568, 129
+        .data 452, -402, 918, 227, 50, 543, 897, 890, 999, -764, -110, -686, -858, -63, -32, 290
+        .string "adkgzqrwyg"
+        .string "xgkyvfqzlulwwf"
+L128:        .data -735, -740, 37, -792, 749, 618, -559, -465, 20, 372, -214, -352, -72, 181, -816, 134
+L129:        prn L78
+        dec r4
+        not *r7
+        .data 436, 690, 735, -631, -750, -627, -36, 111, -983, 673, 933, 787, -890, 414, 752, 208
+        mov r2, L174
+        .data -420, 217, -229, -961, -20, 408, 285, -960, -896, 708, -700, -965, 305, -966, -433, 620
+        .data 731, -420, -358, 657, 303, -711, -266, 122, -119, 901, 769, 247, -570, -287, -31, -581
+        .string "acqxwmpzecgudwjtzcv"
+L130:        .string "fqfjlzacg"
+L131:        add r2, L32
+L132:        clr *r6
+        .data 559, -904, -704, 191, -169, -241, 177, -880, -885, 88, 66, -536, 864, 698, 444, 239
+        sub *r7, *r7
+        .data -919, 27, -641, 319, -108, -451, -190, -267, -890, 600, -675, -805, 489, -634, 272, -808
+L133:        .data -304, -411, -197, 244, -460, 780, 191, -15, -385, -289, 932, 64, -96, 872, -563, -837
+        .data 775, 988, 741, 526, -920, 347, -494, -611, -329, 424, -258, 429, -611, -328, -275, -242
+        .string "xgxahteeaaj"
+        cmp r3, #47
+        .data -393, 457, 779, -767, 387, -668, -763, -843, -827, -166, 553, -617, 828, -829, -480, 15
+        .string "vewoimagmxdmojp"
+        .data -47, 438, -123, -632, -306, 553, -831, -261, 194, -705, 736, -491, -732, -215, 641, -997
+        red L140
+        jsr L54
+        prn *r2
+        sub *r5, L137
+        mov r5, L165
+        .data 225, 619, -643, 527, -844, -912, 465, 109, 821, 218, 745, 421, 539, 373, -934, -94
+        not *r2
+        .data 425, 923, -299, 144, 24, 180, -418, -965, 73, -573, 983, 29, 768, 518, 101, 162
+        .data -967, -709, 173, -452, 348, -366, 101, -536, -884, -694, -532, -444, -428, 958, -503, 931
+        clr r6
+        .string "luvwgvlhragxf"
+        .string "fbwxrdipcef"
+        .data -521, 998, 348, 672, -19, 704, 666, 343, 40, 131, 132, 908, 371, -453, -295, 782
+L134:        .string "ielyzayndhbcmnzxb"
+        .data 749, 807, 259, 498, -264, -284, 205, -383, 664, 481, -348, -683, -948, 96, -951, 776
+        .data -949, 592, -268, -859, 817, 56, -705, -273, 570, -417, 613, 232, -12, 66, 965, 74
+L135:        .string "rguowjma"
+        bne L113
+L136:        bne L170
+L137:        .data 343, 352, 528, -290, 648, -642, -813, -508, -757, -732, 460, -657, 544, 945, -272, -731
+L138:        inc L159
+L139:        .string "bpzjnhmyfofd"
+        .string "ihwphiuucxbiqgi"
+        .data -88, -560, -707, -251, 577, 769, -721, -380, -185, 115, 823, -424, -788, 189, 261, -259
+        .data -848, -724, -851, 710, 194, -533, -856, 577, 547, 601, -554, -302, 662, 615, -708, -409
+        .string "squmsgrrotik"
+L140:        .data -261, -231, -200, 516, -263, 883, 679, 13, -313, -966, -257, -214, 312, 553, 194, 229
+L141:        .string "ezgdqyklctgo"
+        .data -869, 563, -27, 799, 544, -285, -436, -514, 847, 239, -406, -120, 284, 281, 554, -506
+        .string "unhpcfjcbyqr"
+L142:        .string "jkoepqiqko"
+        .data 439, 891, 457, -247, 205, -634, 220, 859, 63, 903, 30, -259, 455, 838, -897, -135
+        .string "fzunlbmpkp"
+L143:        .string "tujzzyow"
+        .data -22, -794, -624, 72, 930, -839, 905, -609, 11, -689, -755, 421, 591, 259, -708, -679
+        .string "omoyceccbwdydooopxe"
+        jsr L151
+        .data -802, 702, 455, 589, 611, -404, 13, -142, 474, -726, -308, 263, -501, 316, 101, -840
+        .string "ktgjchabnsr"
+        .data 835, -290, 834, 927, 209, -181, 639, 483, 897, -958, 910, 666, -240, -696, -928, 862
+L144:        .string "qirioodauxmvfq"
+L145:        .data -970, 362, -264, -836, 882, 770, -744, -551, -258, -706, -510, -989, 114, -661, 71, -664
+        .data -8, 654, 285, -654, -800, 655, -11, -706, 304, -156, -289, 328, -370, 339, -802, -418
+        red *r2
+        .string "vquathnq"
+L146:        mov r1, L148
+L147:        .data -924, -430, -223, 13, -454, 176, -460, 123, 11, 298, -812, -11, 778, 845, 412, 495
+        .data 708, 813, 668, -605, -343, 309, -586, 81, -660, 297, 676, 35, -691, 848, 112, -784
+        .data -976, 857, -282, 399, 588, 597, 484, 523, -195, -36, -560, -595, 458, 245, -584, 456
+        .data -832, 752, -632, 579, -529, 276, -111, -923, 745, 363, -177, 764, 319, -351, 859, 935
+        .string "ltgdrvwhv"
+        .string "eojtasugqv"
+        .string "wahfphump"
+        .data -146, -455, 247, -87, 638, 500, -292, 214, 358, 144, -168, 57, 703, 274, 154, 566
+L148:        .data -38, 309, -857, 462, 811, 168, 792, -112, 128, -389, -461, 21, 46, 801, 602, 920
+        .string "jcjbwhqpbdgjpu"
+        .string "djcrdkevsu"
+        .string "szsslgzsjbpexdep"
+        clr L30
+        jsr L90
+        cmp #-18, *r2
+L149:        sub *r0, L89
+L150:        .string "ufzlcxnanuyjmkypgnno"
+        .string "pifeargmquvimm"
+        .data 956, -115, 90, -471, 111, -390, -953, 791, 121, -560, -414, 135, -165, -175, -648, -583
+        .data -820, 273, -897, 99, -775, 433, 911, 271, 775, -653, 42, 400, 256, 281, -811, -168
+L151:        .string "asqxkzxvns"
+        .string "gvtnjhjwwcsimdfx"
+        red L153
+        mov *r6, r4
+        .data 137, -302, -733, 588, 53, 988, -186, -369, 459, -627, -129, -868, 101, -141, 524, 475
+L152:        .data 271, 730, 261, -252, 900, -811, 81, -675, -512, 679, -711, -512, -136, 643, -910, -429
+        inc L39
+L153:        .string "hfzbjdddslwz"
+        bne L169
+        clr r1
+        .data -192, 429, -908, -957, -383, 787, -554, -980, -275, -94, 636, -536, -852, -287, 165, -244
+        .data -669, -85, 894, 677, 350, 436, -885, 39, 571, 334, -14, 716, -566, -476, -706, 147
+L154:        jsr L163
+        .data 860, -286, -34, 847, -568, -330, -114, -12, 869, -798, 508, 855, -426, -557, -667, 259
+L155:        dec *r6
+        prn L184
+        .string "bjoamonvdtksoouv"
+        .data 809, 33, 36, 353, -153, -243, 265, -917, -156, 358, -318, 550, -16, -491, 647, -56
+        prn r4
+        .string "gpyzrajb"
+L156:        .data -921, -149, 923, 113, -662, -107, -795, -333, -423, -225, 713, -616, -137, -806, -337, -897
+        .data 835, 843, -377, -381, -364, 747, 398, -564, -113, -421, -412, 135, -136, 717, 596, 293
+        sub *r3, L60
+        .data -431, -470, 152, 824, 292, -821, -281, -44, 864, -444, -361, -438, 216, -593, -430, 221
+        .data -835, 788, 415, 347, -736, 441, -168, -483, -264, -697, -277, 778, 703, 33, 872, -81
+        .data -52, 656, 183, 408, -494, 928, -211, 720, 956, 208, -400, 608, 95, -137, -45, 839
+        .string "jclrsojbpulzb"
+L157:        .data -369, 627, -308, 664, 432, 142, -222, -246, 70, -926, -306, 574, -831, 264, -23, -957
+        cmp *r5, r2
+        jmp L182
+        .data 700, -285, 675, 683, -26, -852, -45, -130, 595, 286, -411, 920, 379, 203, -655, -237
+L158:        .data -460, 85, 832, -941, -452, -332, 312, -715, -199, -453, -57, -295, 308, -965, 857, -467
+        .string "finmhtznf"
+L159:        .data 409, -950, 98, -783, -607, 910, -748, -906, -360, -382, 896, 840, 526, -513, -288, -741
+        .data 421, 516, -903, -517, -925, 431, -202, 886, 79, 284, 699, -921, 746, -467, 392, 201
+        .data 892, -526, -435, -595, 477, 93, -35, 447, -628, 777, 226, 338, 934, 388, 970, -720
+        .string "rckcltqxlew"
+        .data 160, -777, -402, 132, -602, -512, -356, -205, 693, -63, -118, -779, -311, -523, 720, -617
+        .data -28, -531, -925, -313, 374, 335, -618, -700, 896, 692, -927, 440, 156, -145, 285, -832
+        sub *r1, *r4
+        .data -28, -145, 553, -46, 729, -587, 107, 927, 168, 277, -391, 247, 984, -1000, -683, -119
+        .data 951, -619, 459, -879, 313, 26, 888, -63, 113, 564, 307, 607, -846, 274, -826, -970
+L160:        .string "adbowgbij"
+        sub r4, *r1
+        .data 468, 821, -826, -679, -854, -862, -279, 873, 504, -188, -436, -322, 737, -783, -868, -384
+        sub L161, r2
+        red L184
+        .data 820, 980, 639, 510, 153, 457, -843, -807, -18, 961, 140, -300, 914, -570, 546, 591
+        .data -345, 126, -719, 362, -145, 273, -149, -875, -133, -74, 568, 338, -72, -466, -897, -405
+        sub r4, *r4
+        cmp L134, #-98
+        .string "clfnvsbkahooft"
+L161:        bne L142
+        .string "szdxgpxeqknbwepqrhgoa"
+        .data 602, -634, 23, 521, -802, 115, 937, 28, -764, -854, -105, 153, -364, 532, -356, 619
+        mov #-92, L151
+        .data -276, 125, 297, -822, 919, -920, -197, 134, 357, 218, -304, -10, 974, 250, 60, 245
+        .data 582, 881, -849, -159, 653, 199, 248, 936, 284, -653, -744, 917, 495, 105, 958, -342
+L162:        .data 434, 363, 110, -200, -467, 713, -573, 608, 405, -398, 85, 298, 570, 314, -602, -54
+        sub r3, *r5
+        .data -717, 228, 564, 662, -855, -137, -493, -293, -326, 523, 118, 457, 191, 943, -247, -921
+        .data 849, 82, 489, 861, 696, -739, 661, -603, -152, -258, -390, -222, -535, -710, -833, -915
+        cmp #15, #56
+        add r5, L174
+        .string "orpodscbzwn"
+        dec *r4
+        .data -451, 33, -235, -833, -80, 239, -675, -392, 661, -250, -766, 503, -819, 969, -219, -305
+        cmp #-85, *r6
+        sub L95, L51
+        .data 833, 292, 140, -343, 1, 189, -314, 960, -117, 538, -383, -984, -723, -429, -287, -798
+        .data -585, -282, -873, 843, 771, 620, 828, -374, -470, 87, -393, -797, 181, 277, -241, 86
+L163:        .data 863, -471, 316, 497, -780, -401, -422, -799, 619, -587, -422, 639, 8, 850, -437, 600
+        .string "keqxjraipnwhqkdhw"
+        .data 148, 734, -471, -259, -769, -418, 977, 874, -319, -318, 761, -772, -344, -541, -591, 988
+        cmp #99, L186
+        .data 666, 621, 430, -242, 133, 79, 895, 969, -418, -491, -547, 912, 873, -127, 507, 824
+        .data 191, 586, -81, -796, 905, -469, 14, -708, -941, -246, 947, 214, -131, 955, -730, 457
+        .data 273, 739, -887, 879, 438, 820, -163, -701, -465, 48, 586, -313, -936, 947, -35, -191
+        .data 411, -941, 919, 5, 213, -949, 943, 277, 815, 283, 310, -904, 240, 537, -693, -201
+        .string "gaypxsxpflqwqcn"
+        .string "kbvyabharco"
+        red *r4
+        .data 366, 549, 723, 771, -779, 890, 550, 337, -74, 488, 386, -767, -336, -65, -154, -979
+        .data 551, -425, 846, 649, -315, -154, -778, 237, -193, -78, -553, 242, 795, 718, 109, -509
+        .data 494, -846, -160, -368, 103, -13, 856, 619, 52, -455, -329, -200, 802, 36, 735, -755
+        cmp *r0, r5
+        cmp #-30, #-97
+        add L108, L28
+L164:        .string "xitprkreebetqpil"
+        mov *r4, L135
+        .data 681, 981, -505, -383, -484, -131, 151, 778, -743, -633, -95, 540, -878, -299, 153, 361
+        .string "owdtvllhdsb"
+        .data -123, -175, 0, -513, 457, -578, -152, 940, 589, -81, 79, 348, -296, -8, -884, -696
+        .string "cafvwovzemeasy"
+        .data -376, -498, -934, 450, -869, 758, 649, 900, 975, -347, 915, -474, 787, 90, 854, -101
+        .data 352, -585, 556, -464, 634, 689, -895, -526, 436, 861, -398, -574, -60, -522, -601, -359
+        .string "jkkgxdjaecw"
+        .data -47, -984, 633, 796, -379, -978, 610, -623, -580, -250, -461, -658, -746, -296, 592, 95
+        .data 789, 554, -775, 925, -443, -709, 152, 287, 770, 193, -400, -784, -901, -939, -129, -432
+        .string "eawimirwwwjm"
+        add L178, L59
+        .data -512, -468, 384, -246, -110, 225, 371, -349, -501, 802, -587, -249, 665, 150, -924, -931
+        .data 687, 302, 728, -272, -798, 898, -590, 972, -97, -485, -691, -498, 944, 814, -4, -67
+L165:        .data -766, 106, -943, 533, -293, -983, -698, -160, 541, -355, 898, 890, 765, 692, 985, 396
+        .string "dontbfbrqcqww"
+        .string "vtpmrigerjzbpi"
+        .data -998, 670, 785, 732, 792, 215, 598, -405, 292, -341, 283, -208, -265, -869, -667, -658
+        jsr L22
+        prn L180
+        prn #-70
+        .string "uarlwtbwnmiz"
+        mov r6, L34
+        .data -756, 315, -106, -682, 598, -19, -973, -581, -41, 998, 298, 929, 160, -10, -927, -577
+        .string "bgmxkysvfrsepc"
+L166:        .data 601, -384, 656, 491, -125, 175, -171, 852, -130, -90, -159, -20, -125, -574, -486, 331
+        .data -291, -778, -830, 482, -98, -970, -490, 30, -447, -109, -532, -807, 356, -888, 894, 999
+        .string "iohqyhdxohi"
+        .string "gwdsrkudaoxmpitm"
+        prn #77
+        .data 609, -229, -417, 202, -829, 802, -816, 68, -538, -682, -41, -151, -77, -665, -496, -505
+        .data 432, 220, -233, -621, -86, -55, -353, -937, -480, 565, -854, 174, -513, 112, -219, -661
+L167:        .data -354, -997, -640, 31, 455, -433, -265, -976, -458, -662, 665, -252, 3, -648, 535, 801
+        sub L153, r0
+        cmp #-76, L175
+        mov *r4, r6
+        inc *r3
+        .data 386, -743, -185, -949, -153, 458, 744, -206, -628, -940, -138, -651, -695, 482, -214, 798
+        .data 286, 652, -505, -875, -449, 678, -348, -912, 256, -513, -789, 626, 901, -289, -150, -803
+        cmp *r6, *r6
+        .data 502, -827, 907, 907, -221, 456, -426, 243, -301, -419, -319, 838, 949, 432, -600, 775
+L168:        .string "kavuvycqlsv"
+        .string "uamkplzzrslp"
+        cmp L186, #80
+        .string "bzfmotqpvu"
+        .data -900, 268, -348, 115, 478, -366, -822, -480, -326, -829, 564, 169, -527, 916, -948, 253
+        .data 600, -420, 481, -912, -392, -541, -395, 245, -821, -891, 273, 11, -780, -818, 9, 733
+        .data 178, 8, 213, -25, -672, -398, -230, 736, 640, 215, 489, 901, -508, 374, 709, -867
+        .string "jestdoxfdygmpg"
+        .data 631, -778, -403, -629, 948, 334, 628, -24, 423, 19, -140, 492, 951, 92, -700, -343
+        .data -203, -977, -967, 4, -762, -810, 245, 172, -650, 125, 494, -893, -745, -554, 941, -414
+        prn r5
+L169:        red r2
+L170:        .data 765, 428, 26, -812, 140, -808, -655, -10, 85, 477, -318, -558, 79, 857, -145, -394
+        .data -935, -120, -993, 331, -117, 193, 632, 756, -810, 524, 620, 609, 128, 910, -739, -754
+L171:        .data 892, 679, -521, 877, -927, 18, 919, 395, -169, -535, -444, -790, 110, -936, 132, -706
+L172:        red L123
+        .data 829, -688, 303, 768, 109, 23, 967, 111, 799, 181, -814, -401, -878, 684, -643, 159
+        .string "iatbibqdyiwxv"
+        dec L58
+L173:        .data 760, 166, -962, 78, -79, 912, 265, 894, -446, -789, -929, 470, -609, -930, -226, 266
+L174:        .data 478, 331, 236, 250, 200, 948, 545, -917, -57, 51, -733, -583, -958, 600, -135, 557
+        .data 584, 203, -329, -563, -657, 652, -413, -788, -257, -259, 74, -761, -399, -199, -208, -524
+        .data -418, 133, -21, -526, -404, 781, -684, -899, -514, 402, 710, -781, 577, 822, -414, -897
+        .data 229, 353, 167, -417, 80, -325, -316, -973, -232, -1, 400, -448, 77, -823, -944, -197
+        cmp #-42, r4
+        .string "cuzetjebqfgic"
+        mov #45, *r0
+        jsr L32
+        sub *r3, L112
+        .data 694, 302, -472, 62, 920, 790, 523, 94, 523, 971, -524, 430, -739, 594, -528, -931
+        add L22, r5
+        add *r6, *r2
+        bne L178
+L175:        cmp *r4, *r7
+        add L171, *r0
+        .data -29, 908, 757, 24, -284, -728, -830, 903, -131, 559, 354, 943, 756, -372, 842, -560
+        mov #76, r6
+        .string "uisxqbvxgura"
+        jmp L56
+        .string "shhbdlqvqbrx"
+L176:        .string "zgwgigofkattjty"
+        .string "dtsafxura"
+        .string "eyxgkgnvaamt"
+        .data -877, 264, 793, 631, -480, 287, -886, 994, -765, 340, 612, -238, -90, -785, 908, -9
+L177:        .data 256, -477, 600, -635, 554, -507, 262, 143, 580, 179, -375, -297, 107, -312, -176, -437
+L178:        .data -278, -88, 483, 603, -141, 823, -842, 372, 885, 39, -383, -13, -870, -8, -159, 64
+        .data -98, -896, 586, 478, 321, 976, 199, 416, 307, -927, -218, 390, -999, -42, 467, -684
+        .data 410, -520, 331, -509, -576, 759, -200, 159, -127, 664, -252, -16, 744, 82, 115, 546
+        .string "fdynxokmf"
+        .data 387, -364, -796, -334, -869, -142, 943, -830, 66, 226, -351, 801, 174, 664, -872, 518
+        cmp *r3, #47
+        clr *r2
+        .data -815, -431, 279, -948, -285, 705, 218, -202, -21, 881, -904, 454, 373, -282, 975, 426
+        mov *r5, *r4
+        .data -968, 327, 404, 508, 595, -561, -588, 715, -62, 899, 880, -642, 42, -156, -514, 365
+        .data 644, 635, 850, -63, 750, 2, -906, -994, -48, 687, 769, -580, -367, -290, 618, -413
+        prn #-55
+        clr *r5
+        .string "deuncutp"
+        .string "zekqmbvkni"
+        add L187, L186
+L179:        sub r4, *r2
+L180:        add L186, L6
+        .data -338, 940, -234, 278, 607, 97, 289, -167, -668, -695, -229, 678, 120, -286, -431, 301
+        jmp L186
+        .data -30, 759, -419, -945, 545, -982, 689, -376, -349, -757, -444, -382, -670, -122, -149, -913
+        .string "ljcitnukkrgeoemuy"
+        .string "aoqskimzubco"
+        dec L31
+        .data -756, 51, 444, 608, -757, -530, -312, -378, 793, 895, 633, -830, -689, 96, 743, 87
+        .data -198, -415, -506, -46, -576, -682, 302, -698, -608, 91, -220, -217, 609, 662, -752, -794
+        .data 155, 158, -552, 934, 833, 685, 81, 394, 647, -653, 459, 670, -388, -372, -293, 197
+        jsr L137
+        .data 338, -641, 336, -716, 722, -855, 740, 621, 428, 256, 139, -11, 670, 796, -965, -499
+        .data 602, -998, 517, -291, -568, -545, 417, 173, 802, -648, 429, -686, -872, 54, -423, 279
+        .data -503, -385, -140, 847, 615, -271, 558, -281, 775, 466, 850, -971, -546, -762, -517, -243
+        inc r0
+        .string "hbqryqhfbwwc"
+        bne L134
+        prn L116
+L181:        .data 66, 393, 663, -282, 866, -309, -657, 93, -202, -734, 444, -805, -273, -105, 44, -79
+        .string "gbqgojxjhxzwgmmlh"
+        .data -282, 859, 994, 649, -509, -658, 367, 503, -302, -860, -635, 687, -578, -487, -422, -184
+        .data 59, 455, 738, -584, -995, 980, -317, 939, -111, -871, -743, -186, 793, 159, 363, 783
+        jmp L182
+        .data -550, 722, 838, -990, 904, 125, 603, 346, -625, -336, -275, 871, 445, -236, -430, 861
+        add #-24, *r2
+        bne L188
+L182:        .data -285, -35, 238, 830, -156, -223, 275, -702, 251, -114, 47, -87, 136, 892, 796, -173
+        .data 545, 687, -12, 108, -660, 329, 623, -501, 941, 198, -323, -360, 232, 912, 481, 242
+L183:        .data -382, -445, 532, -175, 931, -79, 787, 832, -256, -438, 591, 275, 637, 765, 507, 271
+        .data 996, -538, -218, -539, -408, 820, 81, 67, -999, 792, -848, -426, 848, -61, 263, 639
+L184:        .string "jwgvaiaufwlzot"
+        sub r7, r5
+        .string "tlowznyqcq"
+        .data -601, 52, -868, 399, -597, 216, 500, 986, -856, 809, 35, -634, 512, 869, -175, 547
+        cmp #26, L45
+        .data -773, 287, -990, 988, 86, 708, -173, 856, -924, 336, 116, 348, -801, -856, -104, 391
+        .data -456, -602, -898, -53, -342, -882, 314, -212, -961, 853, 57, 576, 879, -13, 725, -337
+        jmp L187
+        .data 991, -77, 972, 432, -916, -231, 688, -132, -587, -580, -446, -330, 935, 247, 226, -994
+        .data -297, -978, 299, 522, 999, 307, 504, 432, 673, 107, 729, -204, -320, -861, 261, 767
+        .data -147, 163, -659, -844, 199, 404, -993, 1, -402, -333, 328, 472, -890, 878, -390, -501
+        add r2, r4
+        .data 792, 915, -102, 409, 722, 479, 49, -93, 894, 196, -635, 342, -809, -489, 743, -8
+        add L186, L186
+L185:        .string "ztfywhoknsrq"
+        sub L188, r6
+        .data -935, 877, -991, -464, -899, -899, 87, -718, -281, 369, -890, 515, -976, -23, 449, -988
+        cmp #-23, #-30
+        .data 967, 851, -85, -109, -479, 777, -45, -228, -963, 181, 826, 491, 445, 139, -538, 937
+        .data 283, 873, -19, 136, -183, 332, -963, 758, -56, 368, -922, 417, -955, -467, -767, 998
+        .data 492, 466, -578, -481, 885, 404, -767, 378, -213, 356, 150, 273, 180, 624, 558, -853
+        .string "njosgkehwsxuk"
+        .string "estyvqfvnaj"
+        .data -14, -57, -344, 0, 572, -355, -347, 695, 3, 450, -779, 454, 896, -718, 987, -625
+L186:        .string "feggtjvde"
+        .data -415, -423, 119, -190, -565, 595, -525, -408, 555, 814, -145, -738, 866, 794, -883, 521
+        .data 612, -233, -144, -770, 875, 590, -851, -109, 785, 123, -300, 427, -644, -649, 195, -581
+L187:        .data -982, 425, 811, 350, 326, -726, -822, -823, 858, -676, 430, -54, 337, -174, -188, -657
+        .data 776, -562, -688, 33, 830, -530, -290, -38, 85, 185, 342, 289, -323, 306, -67, 474
+        .string "qpdgwchfmflbqdvf"
+L188:        .data -395, 814, 51, -313, -223, 637, -90, 523, -61, -776, 523, -295, 44, -941, -31, 290
+        .data 818, -815, 293, 188, -388, 625, 425, -68, -32, 620, -522, -503, -916, -729, 279, 154
+        stop
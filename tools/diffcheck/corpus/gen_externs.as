@@ -0,0 +1,1117 @@
+; generated program, seed 15
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.extern X25
+.extern X26
+.extern X27
+.extern X28
+.extern X29
+.extern X30
+.extern X31
+.extern X32
+.extern X33
+.extern X34
+.extern X35
+.extern X36
+.extern X37
+.extern X38
+.extern X39
+.entry L3
+.entry L4
+.entry L6
+.entry L7
+.entry L10
+.entry L11
+.entry L16
+.entry L22
+.entry L23
+.entry L27
+.entry L28
+.entry L32
+.entry L37
+.entry L38
+.entry L40
+.entry L41
+.entry L42
+.entry L47
+.entry L48
+.entry L50
+.entry L53
+.entry L57
+.entry L61
+.entry L64
+.entry L67
+.entry L72
+.entry L76
+.entry L77
+.entry L79
+.entry L87
+.entry L88
+.entry L89
+.entry L93
+.entry L94
+.entry L95
+.entry L100
+.entry L101
+.entry L103
+.entry L104
+.entry L106
+.entry L107
+.entry L112
+.entry L115
+.entry L121
+.entry L123
+.entry L125
+.entry L127
+.entry L128
+.entry L129
+.entry L130
+.entry L134
+.entry L140
+.entry L142
+.entry L148
+.entry L152
+.entry L153
+.entry L154
+.entry L160
+.entry L161
+.entry L164
+.entry L166
+.entry L168
+.entry L169
+.entry L174
+.entry L179
+.entry L180
+.entry L182
+.entry L183
+.entry L186
+.entry L189
+.entry L191
+.entry L192
+.entry L199
+.entry L206
+.entry L209
+.entry L211
+        .data -437, -932, -568, -373
+L0:        sub L145, X17
+        dec *r4
+        not *r7
+        clr *r4
+        mov #92, r4
+L1:        .data -568, 103, -767, -583
+        cmp r0, #-58
+L2:        not *r0
+L3:        jsr X17
+        bne X30
+L4:        sub L4, *r5
+        prn #66
+        bne X5
+        .string "ajcyftvauh"
+        .string "vewrylwxjltbrsholfhnv"
+        mov r6, r4
+L5:        mov *r2, L65
+L6:        cmp #-85, r5
+        not *r1
+        bne L4
+        bne L5
+L7:        sub #29, *r5
+        sub r4, r2
+        sub *r0, *r2
+L8:        .data -578, 78, 263, -951
+        mov r1, *r2
+        add X0, r4
+L9:        not r5
+        cmp X10, X28
+        add r5, L9
+        mov #-77, *r2
+L10:        cmp #-32, r0
+L11:        not X11
+L12:        add #-82, *r3
+        not *r2
+        dec r1
+        cmp L10, r0
+L13:        jsr X1
+L14:        inc L76
+L15:        clr *r7
+L16:        add X25, X5
+        sub #88, *r3
+        sub r1, X8
+        .data -872, -558, 700, 500
+        mov X35, r5
+        cmp X21, *r3
+L17:        mov r7, X8
+L18:        clr r7
+        bne L143
+        jmp X16
+        prn L13
+        .string "sisjpkjcax"
+        red L61
+        cmp #-100, X30
+L19:        sub r1, r3
+        add r0, r2
+        add X5, r7
+        clr r5
+        add X19, X20
+        cmp X3, r7
+        add #25, r0
+        add L6, X24
+L20:        bne L158
+L21:        bne X24
+L22:        inc *r0
+        red X0
+        jmp L151
+        inc L14
+        prn X3
+        jsr X31
+        jmp X7
+        jsr X11
+        cmp r6, *r1
+        sub r5, *r3
+L23:        cmp r3, *r2
+        jmp L131
+        mov L131, r4
+        red L193
+        bne L121
+        not *r3
+        dec L20
+        clr X26
+        not *r2
+        bne X16
+        jsr X21
+L24:        cmp r1, r2
+        inc r7
+        jsr X0
+        add r4, r5
+L25:        cmp #-87, r5
+        add *r5, *r3
+L26:        add L23, X30
+L27:        mov L210, *r4
+        inc r7
+        clr *r1
+        bne X36
+L28:        cmp #77, #-81
+        cmp *r3, *r0
+        mov r2, *r3
+        mov r6, X5
+        jsr X38
+        bne X27
+        add L49, X5
+        bne L98
+        sub *r7, r0
+        .data -112, 118, -956, -780
+L29:        dec X37
+        not *r6
+        sub *r4, *r5
+        clr *r7
+L30:        sub #-10, X9
+        not *r4
+        bne L9
+        inc L82
+L31:        .string "gycvlpcpbiol"
+        sub #67, r2
+        prn *r5
+        clr *r7
+        inc r5
+        jmp X12
+        dec L35
+        mov X3, r0
+L32:        jsr L25
+        sub *r7, r7
+        dec L167
+        jsr X22
+L33:        jsr X37
+        mov X33, r1
+        add r4, r1
+        .data -500, -344, -722, -745
+        cmp #44, *r2
+        add r0, *r2
+        mov L0, L3
+        mov #87, L121
+        sub r6, r6
+        add X21, *r4
+        jsr X18
+        cmp r6, L159
+        add L74, *r2
+L34:        clr r1
+        jsr L114
+        clr X19
+        bne X10
+        .data 361, 791, 9, -286
+        red L15
+        mov *r3, L2
+        .string "oxrvlnsljnozd"
+        cmp L193, L101
+        red *r5
+L35:        inc r6
+L36:        add *r7, L35
+        not r4
+L37:        dec *r7
+        sub r1, *r4
+        prn *r6
+        clr X37
+        cmp r0, *r4
+L38:        bne X24
+        not L90
+        mov r6, X2
+        mov r3, r6
+        jsr X34
+        cmp *r2, #24
+        bne X8
+        add *r1, X5
+        clr r1
+        prn #43
+        cmp #62, X14
+        inc *r3
+        add #-16, r7
+        sub *r3, *r0
+L39:        clr *r6
+        cmp #89, *r7
+        jsr L12
+        sub L12, X34
+        jmp L0
+        .data -776, 93, 276, -514
+        mov L22, *r1
+        cmp L18, *r7
+        mov *r6, *r2
+        jmp L105
+L40:        cmp *r2, #59
+        .string "hdiftpxarijg"
+        jmp X29
+L41:        sub *r6, X8
+        sub #-18, X4
+L42:        bne X30
+        mov r7, *r0
+        cmp X26, r2
+        bne L36
+L43:        add r1, r1
+        sub *r6, X38
+        cmp #87, X22
+        jmp X4
+L44:        red r1
+        dec X2
+        not *r5
+        prn L150
+        .data -447, 650, -932, -260
+        mov r7, X7
+        sub L4, X16
+L45:        prn *r3
+L46:        jmp X6
+        bne L2
+        mov L21, r1
+L47:        sub *r7, *r5
+L48:        .string "cdxtamfvhjudcdnqs"
+        jsr X9
+L49:        cmp X32, r5
+        clr *r4
+L50:        red *r2
+        prn #-48
+L51:        not *r6
+        jsr X35
+        dec *r7
+        sub *r7, *r5
+        sub #-20, X17
+L52:        dec *r0
+        clr X15
+        add #-41, r7
+        clr L33
+        cmp X21, *r7
+L53:        .data -569, -794, -435, 105
+        red *r1
+        red *r7
+L54:        dec *r7
+L55:        .data -154, 645, -993, 354
+        cmp #19, r0
+        jsr X2
+L56:        jmp X31
+        add r3, *r4
+        jmp L166
+        mov L100, *r5
+L57:        jsr X4
+        dec *r5
+        add *r3, r4
+        sub X6, r5
+        not *r5
+        clr X29
+L58:        sub #17, r6
+        mov X37, L190
+        cmp *r6, *r5
+        clr r3
+        mov r6, X1
+        sub X20, L120
+        mov r3, r6
+        clr X4
+        cmp *r2, *r7
+L59:        mov *r0, r4
+        bne L112
+        inc *r6
+        cmp L47, L107
+        cmp *r3, X14
+        not *r6
+L60:        red L37
+        inc *r7
+        bne L24
+        sub #45, X14
+L61:        prn r6
+L62:        add X14, r3
+        jmp X7
+        not r7
+        dec *r5
+        red r4
+        jmp X0
+L63:        .data -744, 431, 324, 890
+        bne L195
+        red *r0
+        add r4, X36
+        red L39
+        not r3
+        jmp X35
+        sub r5, X3
+        mov *r7, *r3
+        jsr X2
+        red r0
+        sub L71, X22
+        sub r7, X10
+        sub #88, r2
+L64:        mov #63, L70
+        jsr X22
+        sub X32, r1
+        dec X30
+L65:        bne X30
+        mov *r6, *r1
+        jmp L148
+        .data -523, -365, -788, 622
+        prn #-55
+        add #-14, *r3
+L66:        sub X19, *r1
+        sub X10, r0
+L67:        prn X17
+L68:        cmp #-99, X2
+L69:        cmp r6, *r7
+        inc r3
+        bne L127
+        add #16, r3
+        .data 555, 424, 483, 51
+        cmp *r4, r2
+        .data 776, 58, -394, -878
+        bne X23
+        add #93, X31
+        mov X36, r2
+        jmp X23
+        prn X27
+L70:        jmp X13
+        bne X35
+        inc *r2
+        .data 557, 861, -944, -823
+        cmp r5, X16
+        bne X8
+L71:        sub r2, *r0
+L72:        prn #-71
+L73:        sub #98, r3
+        prn X5
+        sub r2, X30
+        dec r2
+        sub X26, *r1
+L74:        cmp #-84, X23
+        sub *r7, *r3
+L75:        bne X18
+L76:        clr X33
+        add #60, *r1
+        prn X9
+        add *r3, r2
+        mov *r6, X20
+L77:        mov #50, L28
+L78:        jsr L16
+        add *r6, r4
+        jmp L57
+        cmp #-32, X2
+        cmp r1, #66
+        dec r4
+        jmp X30
+        sub #-51, *r2
+        cmp #-82, *r0
+L79:        not *r5
+        .data -334, -413, -979, -389
+        add *r6, *r7
+        sub X9, *r7
+        sub r7, r0
+        prn L180
+        cmp r7, #-40
+        jsr L73
+        cmp L125, X21
+        add #58, X38
+        sub #52, r5
+        cmp *r7, *r1
+        sub L150, X10
+        not L8
+L80:        prn r0
+        not X14
+        prn r0
+L81:        sub *r2, r5
+        mov *r0, *r4
+        .data 723, -1000, -703, 407
+        inc L43
+L82:        not *r5
+L83:        red r3
+L84:        cmp #-58, X4
+L85:        cmp L16, r2
+        clr *r5
+        cmp #-66, *r1
+L86:        inc *r7
+L87:        mov #-69, *r1
+        sub X37, r4
+        cmp r7, r0
+        add *r2, r1
+        add *r2, *r6
+L88:        bne X18
+        sub r1, X8
+        dec r7
+        jsr X8
+        cmp *r1, *r4
+        bne X29
+L89:        clr *r6
+        jsr L11
+        mov r7, r2
+        .data -313, -602, -455, -350
+L90:        jsr X3
+        mov *r3, *r2
+        prn L60
+        add #98, *r5
+        mov L73, r7
+        mov #-76, L154
+        not r0
+        clr r5
+        bne X3
+        jsr L210
+        cmp #75, r2
+        mov r3, X25
+        cmp #-25, #5
+        .data 517, -658, -658, 27
+        sub *r1, L208
+        red *r1
+        bne L203
+        cmp X12, #-10
+L91:        mov *r2, r2
+        .data 919, 265, 606, -251
+        sub X24, X30
+        bne X5
+        prn r1
+        sub X20, X0
+        mov r2, r5
+L92:        bne L72
+        bne X7
+        jsr X39
+L93:        .string "ehknugrbw"
+L94:        jsr L107
+        .string "lkmclupryxdjxahup"
+        clr X28
+        dec X1
+        mov *r4, L38
+        prn X2
+        .data 78, -531, -172, -366
+        .data -857, -601, 570, 747
+L95:        add X2, r6
+        cmp X24, #-17
+        sub X16, X26
+        sub #-43, L44
+L96:        add r4, r4
+        prn r5
+        sub L198, L91
+        mov *r0, X33
+L97:        add r7, X32
+        clr X15
+L98:        not X27
+        .data 531, 583, 421, 226
+        sub r3, *r0
+        cmp *r6, *r7
+        sub *r1, r6
+L99:        cmp #95, *r2
+        sub #-14, r1
+        jmp L60
+        add X7, r1
+        not *r6
+        add #-42, X4
+        .data 914, 886, 228, -256
+        mov r7, r6
+        sub X5, *r5
+        cmp r5, #96
+        prn X19
+        jsr L109
+L100:        mov *r2, *r0
+L101:        sub *r1, L166
+        cmp X35, #61
+        prn *r7
+L102:        sub L109, r0
+        add *r6, *r2
+        dec L123
+        clr r4
+        sub #56, L42
+        dec r0
+L103:        sub #-69, X23
+        add #58, X27
+        inc X27
+        jsr L30
+        mov *r6, *r4
+        mov L169, X3
+        mov #-26, *r5
+        .data -31, 150, -351, 295
+        add *r6, L88
+        not X1
+        inc *r7
+        add #-54, *r4
+        .string "wemomvimwfjpfe"
+L104:        cmp #-68, r2
+        prn r6
+        inc L108
+        add #-84, r0
+        add r1, *r2
+        mov *r2, *r0
+        .string "fmnmoprnshvx"
+        jmp X11
+        mov #73, *r5
+        inc *r6
+        cmp *r2, *r3
+        jsr X22
+        add #-64, *r1
+L105:        .data -446, 178, -374, 764
+        inc r6
+L106:        clr X5
+L107:        add r6, X5
+        sub r6, X18
+        bne X30
+        jsr X38
+L108:        jmp X33
+        not *r0
+        dec *r3
+L109:        .data -879, 7, 247, 320
+        .data 272, -208, -799, 501
+        mov r6, *r4
+L110:        add *r4, X19
+L111:        red r4
+        .string "vukvpsmrduybxxpazn"
+        bne X14
+        sub #12, *r2
+L112:        cmp *r0, r1
+L113:        add *r3, r2
+        cmp r6, #-7
+        jmp L85
+        add *r3, r5
+        dec L127
+        inc r0
+        .string "byrpsgufdxkgg"
+        sub #-92, *r5
+        mov X34, *r5
+        prn r2
+        prn r2
+        sub #-56, r7
+        add #91, r2
+        sub #-85, L133
+L114:        add r2, *r1
+        dec r0
+        prn *r4
+        inc X31
+L115:        sub X33, *r4
+        jmp L86
+        mov *r6, r3
+        prn *r6
+L116:        dec *r7
+        .string "orvhqilg"
+        sub *r3, *r6
+L117:        .data 893, 551, 569, 549
+        mov r0, L181
+        bne X3
+        sub #-50, *r0
+        bne X9
+        jsr X15
+        dec X34
+        dec X8
+        cmp X16, *r2
+L118:        bne L163
+        jmp L197
+        sub #98, r6
+        mov *r3, *r0
+        sub X1, r7
+        jsr X2
+        mov X10, *r2
+        .data 445, -555, -391, -921
+        cmp *r3, L53
+        .data -293, 123, 459, -167
+        add X12, r6
+L119:        .data 766, -347, 131, 693
+        .data 945, 853, 785, -116
+        dec *r7
+        clr r6
+        mov #-35, X4
+        jsr X18
+        .data -552, -328, 239, 670
+        add #-67, r4
+L120:        dec r6
+        prn r1
+        dec L145
+        sub r5, X32
+L121:        jsr L8
+L122:        add r1, L175
+        sub X24, L14
+        mov r5, X3
+        mov #-44, r7
+L123:        jmp L166
+        red r2
+L124:        jsr X33
+        add *r6, r7
+        add *r5, r2
+        mov *r1, *r7
+        sub *r0, *r3
+        mov r2, r5
+        red r5
+        sub *r7, X12
+        not *r0
+        red X24
+        jsr L145
+        red *r0
+        clr X23
+        sub *r3, *r4
+        .data -200, -355, -153, 660
+L125:        sub r6, X6
+        jsr L155
+L126:        not L14
+        add *r7, *r6
+        cmp *r3, *r3
+L127:        cmp X17, r7
+        mov *r0, *r2
+        mov r1, r1
+L128:        sub *r7, r7
+        sub X9, r7
+        clr X12
+        sub *r2, *r0
+L129:        mov *r2, r5
+        cmp L195, r4
+        dec L177
+        prn *r1
+        .data -427, -83, 869, -503
+        inc X29
+        not *r2
+        .data -364, -268, -380, 37
+        sub r1, *r0
+L130:        bne L210
+        bne X32
+        sub X37, *r4
+        add *r1, *r1
+        prn *r4
+        .data 927, -438, 78, 695
+        mov *r4, L117
+L131:        cmp r2, r2
+        jmp L95
+L132:        not r6
+        cmp *r5, #86
+        dec r2
+        inc r4
+L133:        red X38
+        sub #-25, r7
+        add #2, *r2
+        mov r2, r0
+        mov #-79, r5
+L134:        add *r3, L173
+        mov r7, *r5
+        add r6, *r2
+L135:        .data 317, -921, -219, 659
+L136:        bne L120
+        sub r7, r1
+        clr r4
+        .data -674, -368, 552, 535
+        cmp #-33, *r1
+        jmp X17
+        bne X4
+        prn X4
+        .data -31, 213, 416, 452
+L137:        bne L46
+L138:        add *r3, X0
+        sub #-50, X10
+        bne L31
+        jsr L155
+L139:        cmp #-91, *r3
+        sub #70, X29
+        dec L143
+        clr r4
+        add X12, L83
+        .data 716, -782, 389, 206
+L140:        prn L209
+        .string "xxeczzlxnaqxttbq"
+L141:        add #74, *r5
+        jsr X38
+        red *r4
+        prn #77
+        cmp #48, r0
+L142:        .data -273, -756, -830, -181
+        clr r4
+        dec r0
+        .string "tlgppidbjwzs"
+        bne L174
+        mov #26, r6
+        jsr L174
+        cmp X12, *r6
+L143:        inc L196
+L144:        sub X30, L89
+        jmp L162
+L145:        mov *r4, *r4
+        .data -795, 274, 45, -751
+        add L181, X29
+        jsr X1
+        bne L44
+        mov r5, L44
+L146:        not L149
+        bne X16
+L147:        add *r7, *r1
+L148:        mov *r0, X34
+        bne X7
+        jsr X1
+L149:        bne X8
+        jsr X28
+        jmp L211
+        dec *r0
+        not *r1
+        jmp X35
+        jmp L189
+        add X28, r4
+        .data -469, 44, -681, -375
+        red *r1
+        prn *r7
+        jmp L210
+        inc X27
+L150:        jmp X11
+        .data -601, 735, 288, 949
+L151:        add *r3, X32
+        mov *r2, r5
+L152:        jmp L175
+        mov *r7, *r4
+        cmp r5, L172
+        .string "svyucrkdajzslaek"
+        .data -714, -666, -395, 774
+        cmp *r0, r0
+        cmp r3, #43
+        add #-44, *r5
+        clr *r4
+        not *r4
+        .data -895, -452, 97, 230
+        jsr L190
+        .data -182, 449, -87, -363
+        sub r7, *r4
+        not *r0
+L153:        dec X12
+L154:        mov X32, *r6
+        mov #-38, r4
+        add X15, *r4
+        clr *r6
+        jmp X19
+        add X34, r2
+        inc *r2
+        dec r4
+        bne X7
+        add r0, X32
+        sub L179, X17
+        red *r3
+        bne L86
+L155:        add r5, r6
+        mov r0, r3
+        red X20
+        clr r4
+L156:        mov X23, r2
+        add #-97, r4
+        bne X22
+        dec X11
+        jsr L17
+L157:        jmp L113
+        clr *r5
+        add *r2, *r0
+        mov #56, *r3
+        jmp X6
+        add r4, *r5
+        jmp L191
+        sub r2, *r0
+        jmp L167
+L158:        jsr L88
+        add r4, r3
+        cmp #-56, *r6
+        .data -343, -451, 781, -25
+        sub r0, X32
+L159:        dec r2
+        mov *r6, r1
+        jmp L121
+        bne X10
+        prn #71
+        mov L90, r6
+        jmp L75
+        sub X1, *r3
+L160:        mov #29, X18
+        jmp X26
+        inc r1
+        .data -946, -959, 70, -212
+        mov L15, r7
+        sub r2, r0
+        mov *r6, *r5
+        jmp L202
+L161:        mov *r4, L127
+        .data 394, -304, -984, 278
+        mov r2, r2
+        inc r7
+        mov *r7, L179
+        red r1
+L162:        add #-25, *r6
+        .data -637, 432, 802, 617
+L163:        not r7
+        clr *r4
+        not *r5
+        jsr L78
+        jmp L184
+        cmp r2, *r7
+L164:        jmp X16
+        cmp r7, #8
+        jmp L28
+L165:        sub L117, *r7
+L166:        cmp L169, r1
+        .data 380, -811, 43, -597
+        bne X38
+L167:        jsr X29
+        add X30, r3
+        mov X30, L179
+L168:        cmp *r4, #-15
+L169:        bne L26
+        add X26, *r5
+        red *r3
+        jsr L141
+        mov *r3, *r0
+L170:        cmp #-41, #56
+        sub #14, r4
+        jsr L206
+        .string "rzqubqfyzjsnmfd"
+        add *r0, r1
+L171:        .data 484, 953, -599, 377
+        .data 700, -926, 10, 859
+L172:        prn X1
+        .data 278, 53, -944, 297
+        not *r0
+L173:        add #-63, r7
+        sub *r1, X29
+        mov *r5, L100
+        prn X3
+        sub *r6, L203
+        dec L186
+        red r5
+        dec *r0
+        clr *r2
+L174:        add X31, L123
+        red r4
+L175:        dec L176
+L176:        sub *r4, r7
+        cmp *r2, L183
+        bne X5
+        jsr X5
+        not *r2
+L177:        mov L145, X30
+        .string "nkawltjassyyl"
+        add *r5, r6
+        sub *r7, L71
+        dec X29
+        add r6, r4
+        sub *r7, r6
+        add L163, X16
+        mov L156, *r0
+        jmp X31
+        inc r0
+        bne L169
+        inc r7
+        mov L196, *r6
+L178:        jmp L189
+L179:        bne L80
+        .string "supedteccoja"
+        cmp L54, L193
+        sub L187, r2
+        .data 983, 156, 990, 936
+        add *r3, *r4
+        not L153
+        mov *r5, r3
+        .data 512, 304, 751, -818
+L180:        prn #81
+L181:        add X10, *r1
+        bne X10
+        jsr X37
+        bne X20
+        not r5
+        add *r4, L166
+        .data -271, 414, -662, -597
+L182:        add r5, r3
+        sub L212, *r2
+        bne X30
+L183:        cmp X14, *r2
+        cmp r7, L184
+        bne X0
+        sub *r5, X9
+L184:        dec *r3
+        mov L211, X7
+        dec X17
+        clr *r6
+        mov #79, r2
+        .string "bsxygqsqthf"
+        mov #-33, *r6
+        mov *r3, X38
+        jmp X14
+L185:        dec X17
+        bne L207
+        add L174, *r1
+        sub #-72, *r4
+        cmp #-34, *r7
+        add r2, r6
+L186:        mov #-37, L50
+L187:        jsr X25
+        mov r2, *r6
+L188:        red *r2
+L189:        mov L195, X23
+        clr r0
+        sub #65, r6
+        inc *r6
+        not L199
+L190:        cmp r1, *r3
+        .data -960, -427, 402, -573
+        sub r2, *r2
+L191:        jmp X18
+        cmp *r6, #-79
+        bne L197
+        jmp L207
+        inc r7
+        jmp X37
+        .string "mblzwsvjkswh"
+        sub *r5, X0
+        mov #-3, r0
+        not L25
+L192:        add r2, L60
+        mov L197, *r3
+        add #-28, *r1
+        jmp L90
+        sub r1, X29
+        clr r4
+        prn r6
+L193:        dec r4
+        add #90, *r6
+        .string "pdnmhwtdxvtvoc"
+        bne X23
+        red X8
+L194:        dec *r4
+        mov r1, X13
+        inc *r7
+        sub X4, X39
+        inc r5
+        add r6, X4
+        .string "uushdduvp"
+        cmp #-46, #-87
+L195:        inc r5
+        cmp #-19, L59
+        red r0
+L196:        sub *r1, X0
+        .string "ugdfvqihj"
+        bne X6
+        sub *r3, *r6
+        clr *r0
+        cmp L5, X15
+L197:        add #-80, r7
+L198:        cmp #-79, X9
+        add r2, r3
+        red *r7
+        jmp L199
+        .data -983, -11, -507, -215
+        not r4
+        cmp X12, r7
+L199:        jsr X18
+L200:        red X19
+        jmp L196
+        mov #92, X7
+        not r6
+        .data 394, 738, -967, -354
+        dec X22
+        sub *r7, L212
+        red X0
+        cmp #56, r5
+        bne X0
+        add #54, L4
+L201:        add X32, X26
+L202:        inc r5
+        cmp #75, #13
+        mov *r4, L205
+        mov #30, r7
+L203:        mov #-53, r0
+        .string "gsygczdilfaisi"
+L204:        mov r7, *r5
+        bne L102
+        inc *r6
+        jmp L207
+        mov r6, *r5
+L205:        jmp L21
+        cmp *r2, X39
+        prn *r2
+L206:        add X6, *r7
+        mov *r1, r4
+        sub #-26, r6
+        not X10
+        sub X3, *r5
+        mov r1, *r7
+        jmp L119
+        red r5
+        sub #-56, L93
+        cmp r4, #-33
+        mov r4, L209
+L207:        not r6
+        mov X18, L211
+        clr r2
+L208:        sub #13, r4
+        bne X25
+        .data -823, 258, 41, -326
+        mov *r1, r1
+        dec L33
+        not X35
+        sub r3, L209
+        jmp X19
+        cmp r3, *r4
+        prn *r5
+L209:        bne L210
+L210:        clr *r1
+        not *r1
+        sub X3, L211
+        dec r1
+        bne L57
+L211:        jmp X23
+L212:        sub #85, *r7
+        bne L60
+        cmp r6, r5
+        cmp L110, r2
+        mov X30, r3
+        mov r6, L138
+        sub r7, *r1
+        prn #-2
+        sub *r6, r5
+        mov X13, *r7
+        add X26, X31
+        cmp #50, L151
+        red X15
+        inc *r6
+        sub #31, X39
+        stop
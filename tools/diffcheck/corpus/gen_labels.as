@@ -0,0 +1,1043 @@
+; generated program, seed 12
+.entry L5
+.entry L11
+.entry L47
+.entry L50
+.entry L52
+.entry L59
+.entry L82
+.entry L157
+.entry L170
+.entry L174
+.entry L214
+.entry L224
+.entry L228
+.entry L249
+.entry L288
+.entry L292
+.entry L318
+.entry L368
+.entry L418
+.entry L434
+.entry L513
+.entry L530
+.entry L548
+.entry L598
+.entry L618
+.entry L625
+.entry L644
+.entry L646
+.entry L672
+.entry L688
+.entry L692
+.entry L698
+.entry L699
+.entry L718
+.entry L731
+.entry L737
+.entry L743
+.entry L745
+.entry L756
+.entry L766
+.entry L801
+.entry L823
+L0:        jmp L0
+L1:        cmp *r1, #35
+L2:        inc r6
+L3:        prn L3
+L4:        jmp L677
+L5:        sub #-86, *r6
+L6:        red r0
+L7:        jmp L821
+L8:        mov #12, *r5
+L9:        jsr L1
+L10:        mov L123, r6
+L11:        dec *r3
+        .string "gzacoetyvdhgoh"
+L12:        bne L701
+L13:        prn L6
+L14:        not L763
+L15:        not r6
+L16:        not r7
+L17:        cmp *r0, *r3
+L18:        jmp L0
+L19:        mov *r7, r1
+L20:        cmp r3, *r6
+L21:        .string "tbmvoezakzrhau"
+L22:        sub r3, *r0
+L23:        prn r2
+L24:        prn L823
+L25:        red r5
+        jmp L12
+L26:        inc r3
+L27:        add #-41, L220
+L28:        sub *r0, r7
+L29:        sub r2, r6
+        mov #-90, r1
+        sub L5, *r5
+L30:        dec *r7
+L31:        .data -642, 524, -713, -644
+        mov *r2, r6
+L32:        dec *r2
+L33:        jmp L17
+        cmp *r1, L19
+L34:        not L8
+L35:        add r2, *r0
+L36:        jsr L23
+L37:        clr r1
+        .data -719, 202, -408, -963
+L38:        cmp #-57, #-42
+L39:        inc r7
+L40:        sub L367, L762
+        add r2, r7
+L41:        bne L23
+        add #-59, r6
+L42:        mov #-1, r2
+L43:        prn #-94
+L44:        sub r1, r5
+L45:        clr *r2
+L46:        prn #53
+L47:        jsr L18
+L48:        red L4
+L49:        jmp L14
+L50:        bne L460
+        sub #-41, *r0
+L51:        sub #95, r1
+L52:        sub r6, L0
+L53:        not r1
+L54:        mov L662, r1
+L55:        add #-61, r5
+        jmp L33
+L56:        clr L48
+        mov r4, L44
+L57:        prn *r2
+L58:        dec L247
+L59:        red r0
+L60:        mov #24, *r5
+L61:        cmp r4, r6
+L62:        prn L0
+L63:        add *r7, *r4
+L64:        add r1, r1
+L65:        add #93, L508
+        mov *r0, L721
+        jmp L5
+L66:        sub r5, L245
+L67:        .data -298, -619, -855, 130
+        sub *r1, r6
+        dec L34
+L68:        cmp r0, #12
+L69:        mov L11, L143
+L70:        bne L613
+L71:        prn *r7
+L72:        .data -923, 930, 985, -951
+        mov r2, r3
+L73:        add *r5, *r6
+        dec L669
+L74:        jmp L400
+L75:        sub r6, r2
+L76:        .string "xzsbrfyujzlxt"
+L77:        mov L31, L299
+L78:        jmp L368
+L79:        .string "uabawnxrgxlrn"
+        sub r0, L48
+L80:        bne L18
+L81:        jsr L693
+L82:        red L709
+        add *r2, *r0
+L83:        prn #-14
+L84:        inc r1
+L85:        inc *r2
+L86:        add *r4, L209
+L87:        sub r4, L57
+L88:        clr L542
+L89:        mov #82, L542
+        jmp L30
+        mov L496, r7
+L90:        inc r4
+L91:        clr *r5
+L92:        red *r3
+L93:        sub L475, *r1
+L94:        clr r2
+L95:        dec L630
+L96:        sub r7, r1
+L97:        mov L232, r7
+L98:        bne L14
+L99:        add r5, L736
+L100:        not r6
+L101:        .data 120, -939, -581, -379
+L102:        dec L293
+        red *r6
+L103:        clr r3
+L104:        cmp *r6, L68
+L105:        jmp L379
+L106:        cmp L166, *r7
+L107:        jmp L73
+L108:        .data 493, -683, 20, -829
+L109:        cmp r7, r4
+L110:        mov r3, *r0
+L111:        mov *r0, L88
+L112:        dec r5
+L113:        cmp r7, *r7
+        mov r1, L792
+L114:        jsr L748
+L115:        .data -480, 482, 675, 191
+L116:        add r7, *r4
+L117:        not L49
+L118:        mov L560, *r6
+L119:        cmp #43, r1
+        jsr L587
+L120:        inc *r5
+        .data 932, 175, 601, -795
+L121:        add *r2, *r1
+L122:        .data 983, -359, 676, 368
+L123:        add r3, r6
+L124:        sub #34, L651
+L125:        red L580
+L126:        clr r3
+L127:        mov r7, r4
+L128:        .string "trcxbmkywybt"
+L129:        cmp L16, #15
+L130:        bne L16
+L131:        jmp L556
+L132:        sub r5, *r3
+L133:        .data -514, -398, -841, 325
+        add *r7, r2
+L134:        jmp L17
+L135:        mov L775, *r4
+L136:        inc r2
+L137:        .data 39, 150, -918, -813
+        add #-51, r1
+L138:        jmp L240
+L139:        bne L517
+        cmp L125, r0
+L140:        cmp *r0, *r1
+L141:        dec L121
+L142:        cmp L624, *r0
+L143:        cmp *r0, L300
+L144:        not L34
+L145:        mov r3, L465
+L146:        jmp L122
+L147:        dec r2
+L148:        mov r5, *r6
+L149:        bne L179
+L150:        clr *r6
+L151:        sub *r5, L200
+L152:        cmp r6, #-35
+L153:        mov r3, L118
+L154:        red *r7
+        add #-73, *r2
+L155:        bne L784
+L156:        cmp r1, r7
+L157:        sub *r4, r1
+L158:        sub #-89, r7
+        cmp #25, L267
+        jsr L768
+L159:        not *r2
+        .string "ueqinienu"
+L160:        not L92
+L161:        add r4, r7
+L162:        mov *r3, *r4
+L163:        clr L479
+L164:        prn L623
+L165:        jmp L496
+L166:        add L60, L106
+L167:        cmp r3, *r4
+L168:        clr L6
+L169:        prn L49
+L170:        not L670
+L171:        not *r6
+L172:        mov r3, *r4
+        jmp L792
+L173:        jsr L234
+L174:        jmp L6
+L175:        add L478, L115
+L176:        bne L444
+L177:        sub *r6, *r5
+L178:        mov #63, L35
+L179:        not r5
+L180:        prn #11
+L181:        mov r0, *r5
+L182:        cmp L512, r7
+L183:        .data 844, -954, -509, -955
+L184:        add *r0, *r5
+L185:        clr *r3
+L186:        mov *r4, L198
+L187:        prn #-79
+        dec L468
+L188:        prn *r1
+L189:        cmp r7, *r4
+L190:        jmp L635
+L191:        cmp r2, L517
+L192:        cmp L156, r3
+L193:        cmp #-44, r3
+L194:        .data 35, 500, 303, 644
+L195:        red *r4
+L196:        cmp *r3, r2
+L197:        mov #47, r3
+L198:        jsr L315
+L199:        mov r1, *r1
+        jmp L609
+        not *r2
+L200:        mov *r1, r4
+L201:        cmp *r0, L165
+L202:        prn *r2
+L203:        mov *r7, *r5
+L204:        red r0
+        jsr L711
+        inc r1
+L205:        clr L200
+L206:        add *r4, L101
+L207:        add L624, *r4
+L208:        sub r0, *r3
+        sub r3, r6
+L209:        jmp L42
+L210:        .data -333, 155, 424, 144
+L211:        cmp *r6, #-24
+L212:        .string "jsydrgxonliiccorc"
+L213:        jmp L454
+L214:        sub r0, r7
+        mov *r3, *r7
+        clr *r4
+L215:        add L493, r4
+L216:        cmp *r5, *r7
+        mov *r5, L256
+L217:        cmp L178, r7
+        inc L249
+L218:        .data -932, 738, -958, -882
+L219:        .string "bbclkyjuxoe"
+        mov r6, *r4
+        add *r6, r4
+        bne L221
+L220:        .data 138, 460, -57, -585
+L221:        .data -209, -333, -689, 45
+L222:        cmp #29, L147
+L223:        cmp #33, r7
+        not r0
+        mov r0, r3
+L224:        prn r4
+L225:        inc *r6
+        jsr L221
+        clr r3
+        inc L85
+L226:        bne L84
+        sub *r4, r2
+L227:        .data -956, 391, 105, -569
+L228:        inc r2
+L229:        clr L254
+L230:        sub *r7, *r1
+L231:        bne L661
+L232:        inc L495
+L233:        add L549, L466
+L234:        dec L74
+L235:        sub #-92, *r4
+        inc *r1
+L236:        bne L129
+        inc L37
+L237:        prn #9
+L238:        sub #52, r0
+L239:        cmp r0, L470
+L240:        sub *r1, *r6
+L241:        add L529, L224
+L242:        dec *r2
+L243:        dec r1
+L244:        mov #-73, *r6
+L245:        red L395
+L246:        jsr L307
+L247:        sub L813, L804
+L248:        sub #-16, L232
+L249:        jsr L647
+L250:        .data 163, 560, -584, -732
+L251:        mov L707, *r1
+L252:        sub *r5, *r3
+L253:        bne L583
+L254:        mov *r2, r3
+L255:        bne L442
+L256:        red L364
+        sub L233, r2
+L257:        bne L171
+L258:        cmp r3, L178
+L259:        jmp L823
+        dec *r7
+L260:        sub *r3, L205
+L261:        sub r1, r5
+L262:        clr *r6
+L263:        dec r0
+L264:        .string "itmobxqkhh"
+L265:        red r6
+L266:        cmp r3, r1
+L267:        .data 0, 798, -206, -908
+L268:        red L429
+L269:        prn L208
+        bne L103
+L270:        add #41, *r1
+L271:        prn r5
+L272:        .data -305, -794, -162, 21
+L273:        .data 435, 599, 252, 672
+L274:        cmp L316, r3
+L275:        red r1
+L276:        mov L126, *r0
+        clr L220
+L277:        add *r3, r4
+        .data 811, 826, -695, 94
+L278:        add r0, L14
+L279:        sub r7, L80
+L280:        prn #-45
+L281:        jsr L676
+L282:        not r3
+L283:        mov *r3, *r3
+L284:        .data 235, 859, 768, 829
+L285:        not r6
+L286:        red r1
+L287:        bne L287
+L288:        sub r3, *r5
+L289:        prn *r4
+        .string "vdqtwvqjpyssthgn"
+L290:        add *r6, r3
+L291:        .data 663, 822, 290, 863
+L292:        sub L568, *r2
+L293:        mov *r2, L262
+L294:        clr L208
+L295:        sub L35, *r3
+L296:        dec *r3
+L297:        not r6
+L298:        prn #-68
+L299:        jmp L544
+        .data -219, 95, 930, -683
+L300:        mov r2, r4
+        add r4, *r6
+        prn #11
+        add r6, *r7
+L301:        mov #-68, r1
+L302:        cmp L45, #88
+        jsr L483
+        prn L701
+        inc r7
+L303:        mov *r0, L435
+L304:        cmp #49, #-12
+L305:        prn #93
+L306:        sub *r1, *r0
+        inc L781
+L307:        jmp L358
+L308:        .data -929, -495, -775, 256
+L309:        add r2, *r4
+L310:        inc L278
+L311:        jsr L227
+L312:        jmp L258
+L313:        cmp r4, *r2
+        bne L715
+L314:        inc r5
+L315:        add *r4, *r5
+L316:        sub r5, L117
+L317:        prn r3
+L318:        jsr L405
+L319:        dec r3
+L320:        mov r0, L246
+L321:        jmp L637
+L322:        jmp L477
+L323:        mov #25, r7
+L324:        sub r2, r7
+        not L283
+L325:        jmp L574
+        prn #88
+L326:        add *r1, L221
+L327:        clr L512
+L328:        .data -342, -430, -602, 671
+L329:        prn r4
+L330:        not *r4
+L331:        inc *r3
+L332:        sub *r3, r6
+L333:        cmp #60, r4
+        dec r3
+        not r1
+        cmp L561, L202
+L334:        cmp #29, r7
+L335:        red *r5
+L336:        .data -996, 660, -755, -550
+        jsr L46
+L337:        clr *r4
+L338:        red L335
+L339:        jsr L745
+        bne L174
+L340:        sub L101, *r2
+L341:        dec *r7
+L342:        not L437
+L343:        mov #-47, r5
+L344:        mov #-69, *r7
+L345:        sub L80, *r7
+        sub *r6, r1
+L346:        inc r3
+L347:        mov *r1, r6
+L348:        sub r6, L432
+        cmp L316, r3
+L349:        red L132
+L350:        dec L695
+L351:        jmp L515
+L352:        .data 642, -771, -346, 354
+L353:        jmp L122
+L354:        cmp #-2, L474
+L355:        mov #42, r3
+L356:        jmp L183
+L357:        mov r4, *r0
+L358:        sub r7, r6
+L359:        .data -326, -261, 270, -663
+L360:        sub r7, r5
+L361:        mov L404, L806
+L362:        cmp #-51, r6
+L363:        jsr L305
+L364:        .string "alixhxtvwcrvahwzt"
+L365:        cmp *r2, r0
+        jmp L682
+L366:        cmp *r6, r6
+L367:        cmp L820, r3
+L368:        dec L543
+        add #-83, r7
+        add L209, *r1
+L369:        add L177, r4
+L370:        red r5
+L371:        mov *r1, L70
+L372:        mov L656, r7
+        add L78, L92
+L373:        cmp #-54, *r4
+L374:        mov #67, *r2
+L375:        .string "uynxcgbmssffo"
+L376:        sub r5, L530
+L377:        clr r3
+L378:        jsr L544
+L379:        inc r0
+L380:        sub L345, r4
+L381:        mov r4, *r6
+L382:        not *r6
+        add *r1, r4
+L383:        red *r6
+L384:        mov r2, r3
+L385:        cmp L191, #-62
+L386:        .string "knblcirfuymb"
+L387:        mov r7, L725
+L388:        .string "uumebasjfmslw"
+L389:        cmp #-19, *r5
+L390:        bne L76
+L391:        cmp r3, *r0
+L392:        mov #80, *r2
+L393:        not r1
+L394:        not L791
+L395:        red r2
+L396:        mov L116, L438
+L397:        add r0, *r2
+L398:        jsr L390
+L399:        prn r2
+L400:        sub L682, r0
+L401:        cmp #54, #66
+        clr r0
+        clr L454
+L402:        dec L26
+L403:        clr r6
+L404:        jsr L136
+L405:        jmp L137
+L406:        dec r2
+L407:        .string "mzcktarlazroc"
+L408:        clr *r4
+L409:        sub L596, L82
+L410:        add r6, L550
+L411:        clr *r5
+L412:        .string "qongixgo"
+        mov r5, L544
+        jsr L431
+L413:        jmp L312
+L414:        add #94, *r2
+L415:        add L28, r5
+L416:        not *r3
+L417:        prn *r3
+L418:        jsr L624
+L419:        mov L732, *r4
+L420:        mov *r6, r2
+L421:        .data -935, 693, -824, 625
+L422:        inc L3
+L423:        prn *r4
+L424:        prn *r7
+L425:        not r5
+L426:        cmp #-63, r4
+        prn #-25
+L427:        prn L649
+L428:        red *r0
+L429:        .data 386, -820, -779, 624
+        jmp L376
+L430:        add #-35, r1
+L431:        clr r2
+L432:        .data 149, 610, 536, 85
+L433:        add *r4, L662
+L434:        jsr L245
+L435:        .data 976, -151, -919, 827
+L436:        .data -395, -642, -504, 956
+L437:        mov L761, *r6
+        .string "nrobwjqdkf"
+L438:        jmp L45
+L439:        mov L539, r5
+L440:        sub #-23, r4
+L441:        cmp #-29, L26
+L442:        jmp L760
+L443:        bne L741
+L444:        cmp *r4, L97
+L445:        cmp *r7, r5
+L446:        clr r5
+L447:        add #87, L234
+L448:        bne L679
+L449:        mov *r4, *r0
+L450:        cmp L445, #58
+L451:        prn #-64
+L452:        mov r3, *r1
+L453:        .string "jkrhboyuurvcuvquwek"
+L454:        mov *r2, *r3
+L455:        inc L797
+L456:        add #53, *r1
+L457:        mov r7, r1
+L458:        inc r2
+L459:        inc r1
+L460:        add #20, r5
+L461:        sub r2, L573
+        add L205, L16
+L462:        add L710, r4
+L463:        .string "zdxzvoqnreqfmz"
+L464:        add #-19, *r5
+L465:        red L747
+L466:        .data -152, -229, -660, -206
+L467:        .data -424, -553, 427, 606
+        jsr L374
+L468:        add *r7, *r6
+L469:        dec r5
+L470:        add *r5, r0
+L471:        add *r2, r4
+        sub r4, r5
+L472:        dec L651
+L473:        red L454
+L474:        cmp #50, r6
+L475:        bne L280
+L476:        cmp *r7, L250
+L477:        jmp L620
+L478:        jmp L656
+L479:        jsr L632
+        jsr L45
+        mov r5, r7
+L480:        .string "ziwjgsqaq"
+L481:        mov r7, r3
+L482:        .data 532, -713, -16, -587
+L483:        clr *r7
+L484:        sub L262, *r7
+L485:        red r3
+L486:        add #-69, r1
+L487:        cmp #-76, #-67
+L488:        jsr L628
+L489:        add #49, r5
+L490:        .data -355, -5, 56, 380
+L491:        clr L815
+L492:        bne L218
+L493:        jmp L617
+L494:        add #86, L538
+L495:        sub L535, r4
+L496:        mov r6, *r6
+L497:        sub *r5, L810
+        inc *r6
+L498:        jsr L650
+L499:        sub L250, *r5
+L500:        jsr L612
+L501:        jsr L732
+        mov L619, r0
+L502:        mov r6, L181
+        .data -195, 474, -836, -899
+L503:        add r2, *r0
+        not L784
+        bne L713
+        inc L701
+L504:        bne L386
+L505:        bne L804
+        sub L135, *r7
+        clr *r0
+L506:        add *r4, r4
+L507:        add *r6, r4
+L508:        .string "sqpuuovooxwdxucc"
+L509:        add r5, r0
+L510:        mov r0, L24
+L511:        mov #-62, L205
+        add r2, r5
+L512:        dec *r6
+L513:        cmp #97, #-13
+L514:        dec *r3
+L515:        cmp *r1, *r2
+L516:        sub #76, r6
+L517:        prn r1
+L518:        prn L192
+        inc *r0
+L519:        jsr L305
+L520:        mov *r3, L497
+L521:        jmp L355
+L522:        jsr L807
+L523:        mov r0, *r2
+L524:        prn *r4
+L525:        cmp *r1, L532
+L526:        jmp L594
+L527:        prn #-26
+L528:        add L521, *r7
+L529:        clr *r0
+L530:        cmp *r7, *r6
+L531:        add #-56, *r5
+L532:        add *r5, r5
+L533:        add #7, r4
+L534:        sub L292, L713
+L535:        .data 233, -861, 920, -953
+L536:        .string "wiszjbjrzc"
+L537:        red L663
+        inc L418
+L538:        add r3, r2
+L539:        mov L260, r4
+L540:        sub *r7, r5
+L541:        red r0
+L542:        .data 730, -244, -102, -513
+L543:        cmp *r3, r7
+L544:        dec L605
+L545:        sub #-38, *r5
+L546:        mov L122, *r7
+        not L322
+L547:        add L549, r1
+        jsr L569
+        add #19, r0
+L548:        jmp L405
+L549:        .data -289, 476, 185, -850
+L550:        .data -17, 441, -994, 106
+L551:        mov r2, L799
+        sub L770, L400
+L552:        cmp r3, #88
+L553:        jmp L71
+L554:        sub r6, *r7
+L555:        mov L801, L738
+L556:        add *r2, r6
+        sub r5, *r2
+L557:        sub r5, L234
+        red r5
+        sub *r2, L694
+L558:        bne L147
+L559:        mov #-28, *r6
+L560:        cmp L413, *r4
+L561:        .data 510, 140, -368, -451
+        sub L809, *r5
+L562:        sub L124, *r2
+L563:        prn L597
+        mov #10, *r0
+L564:        .data -788, -643, -643, 661
+L565:        .string "gkdhgolaljz"
+L566:        inc *r4
+L567:        clr L369
+L568:        mov *r4, *r1
+L569:        dec *r0
+L570:        bne L357
+L571:        bne L595
+L572:        bne L526
+L573:        clr L390
+L574:        add #50, L209
+L575:        add #-74, *r7
+L576:        add L329, r4
+        .data -717, 988, -495, -309
+        cmp r6, L126
+L577:        bne L179
+L578:        add #-24, *r7
+L579:        sub #47, *r7
+L580:        add *r6, L234
+L581:        not L330
+        red L322
+L582:        prn *r2
+L583:        add #-25, *r0
+        add r2, L614
+L584:        not r0
+L585:        not r6
+        red *r3
+L586:        cmp #56, L135
+L587:        .data 597, 425, -970, -722
+L588:        add *r6, L356
+L589:        mov *r7, *r7
+L590:        inc r3
+L591:        add r4, *r7
+L592:        add L760, *r5
+        sub *r2, L780
+L593:        add r3, r4
+L594:        add #82, L394
+        mov r5, *r6
+L595:        clr L779
+L596:        .string "faabsjqixbd"
+L597:        add *r1, L796
+        prn #-14
+L598:        mov r6, r2
+L599:        red r7
+L600:        cmp r3, #85
+        sub L39, r5
+L601:        clr r4
+L602:        add #-20, *r4
+L603:        sub *r1, r1
+L604:        not L726
+L605:        mov L141, r6
+L606:        prn L227
+L607:        .data 458, 28, 595, 49
+L608:        .data 205, 194, 483, -459
+L609:        add r5, *r2
+L610:        sub L470, L743
+        jsr L587
+        bne L539
+L611:        .data -91, -612, -631, -148
+        jsr L248
+L612:        jmp L452
+L613:        inc L97
+L614:        sub *r4, L763
+L615:        add #-36, r3
+L616:        clr r4
+L617:        mov #11, r3
+L618:        dec *r3
+L619:        mov r6, L644
+L620:        inc *r5
+L621:        sub r1, r6
+L622:        add r4, *r5
+L623:        sub #5, r6
+L624:        mov #27, r3
+        red L582
+L625:        mov L663, *r0
+L626:        not r0
+L627:        sub L60, r0
+L628:        mov r5, L798
+L629:        add L461, L325
+L630:        mov L261, L693
+L631:        jmp L195
+L632:        jsr L19
+L633:        not r7
+        mov *r6, L681
+L634:        cmp L258, L764
+L635:        .string "jbmfakfnusf"
+L636:        sub *r4, *r1
+L637:        jsr L770
+L638:        .data 369, 859, 29, -446
+L639:        add r6, r7
+L640:        add #43, L195
+L641:        cmp #-93, *r0
+L642:        jsr L168
+L643:        jsr L680
+L644:        cmp #37, r3
+        add *r2, *r5
+L645:        cmp L797, *r5
+L646:        .string "hqoritsdgnwhlvwn"
+L647:        cmp #-92, *r3
+L648:        jsr L756
+L649:        jsr L742
+L650:        mov #4, r0
+L651:        jsr L788
+L652:        bne L13
+L653:        sub L807, L766
+L654:        .data -112, -573, -305, 380
+        jmp L771
+        mov *r7, r6
+L655:        dec *r7
+        cmp r2, #95
+L656:        bne L601
+L657:        .data 477, 672, -266, 1
+L658:        sub #-7, *r4
+L659:        bne L673
+L660:        mov r6, r7
+L661:        inc r4
+L662:        cmp r2, r5
+        cmp #44, #-98
+L663:        cmp *r1, L676
+L664:        jsr L690
+L665:        inc L698
+        jsr L356
+L666:        mov *r3, L583
+L667:        cmp #16, #61
+L668:        sub r2, *r7
+L669:        bne L581
+L670:        .string "hwkhqumfbpnt"
+L671:        .data 174, 418, -604, -361
+        clr r0
+L672:        dec L598
+L673:        dec r6
+L674:        jmp L331
+L675:        inc r6
+L676:        dec L754
+L677:        bne L735
+L678:        inc *r0
+L679:        jmp L811
+L680:        clr r6
+L681:        mov L437, *r2
+L682:        jmp L740
+        add #-98, L401
+L683:        sub L720, L731
+        sub *r1, L814
+L684:        .data -237, -710, -730, 260
+L685:        sub *r4, r6
+L686:        cmp #-87, #2
+L687:        mov #62, r4
+L688:        add #4, r6
+        red *r7
+L689:        cmp L401, L322
+L690:        red *r0
+        prn L1
+L691:        inc L790
+        add #-2, L467
+L692:        .data 318, -478, 572, -321
+L693:        prn r7
+L694:        prn *r1
+L695:        sub L696, L709
+L696:        not r6
+L697:        cmp r4, #27
+L698:        mov L715, *r7
+L699:        .data 147, -921, -79, -328
+        add r6, *r6
+        .data 303, -511, 424, 621
+L700:        jmp L763
+L701:        dec L808
+        sub r5, L792
+L702:        add L302, *r7
+L703:        add L755, L390
+        not *r2
+L704:        jmp L426
+L705:        cmp L734, *r2
+        mov *r6, L779
+L706:        red r2
+L707:        add r3, r0
+L708:        cmp *r3, #71
+L709:        jmp L407
+L710:        sub *r4, L85
+L711:        jsr L73
+        add *r0, L808
+L712:        not r7
+L713:        jmp L799
+        mov *r0, L764
+        clr r5
+L714:        mov r2, r6
+        sub L141, L336
+        bne L745
+L715:        jsr L718
+L716:        bne L823
+L717:        mov *r0, L61
+        jmp L799
+L718:        cmp #-60, #44
+L719:        inc L753
+L720:        mov *r0, r0
+L721:        .string "ljbnzwneapegyx"
+L722:        cmp *r6, L449
+L723:        cmp L368, *r0
+L724:        cmp #76, *r1
+        jsr L751
+L725:        bne L728
+L726:        cmp *r5, L802
+L727:        sub #-14, L737
+L728:        dec r1
+L729:        sub r7, *r6
+L730:        cmp *r1, r3
+L731:        jmp L183
+L732:        cmp *r0, #-49
+L733:        .string "hunctdhfhdxmgac"
+        prn r0
+L734:        .data 242, -736, -259, -512
+L735:        jmp L222
+        jsr L767
+L736:        red r1
+        inc r0
+L737:        mov L300, L811
+L738:        mov *r4, L791
+L739:        prn *r2
+L740:        .data 393, 798, 146, -415
+L741:        jsr L509
+L742:        prn r4
+L743:        clr L764
+L744:        clr *r6
+L745:        red r6
+L746:        mov r3, *r4
+L747:        prn #90
+L748:        mov L801, L796
+L749:        not L574
+L750:        mov #-48, r4
+        inc *r7
+L751:        jmp L781
+L752:        jmp L35
+L753:        prn r7
+        mov #7, r7
+        .string "flcvyveuh"
+        cmp #-69, #22
+L754:        mov *r6, *r2
+L755:        .data -879, -242, -376, 187
+        clr r0
+L756:        add #-17, r5
+        prn *r3
+L757:        mov #9, L777
+        sub *r5, L766
+L758:        .data -454, -382, -738, -271
+L759:        sub *r1, r7
+L760:        mov #28, r4
+L761:        not r5
+L762:        bne L222
+L763:        add r1, r5
+L764:        jmp L62
+L765:        inc L135
+L766:        mov #37, r0
+L767:        not r5
+L768:        not *r3
+L769:        .data -475, -649, 659, 528
+L770:        cmp *r6, L448
+L771:        mov r2, *r6
+L772:        sub r3, r1
+L773:        add #-26, L821
+        prn *r6
+L774:        mov *r2, *r5
+L775:        inc r5
+L776:        jsr L41
+L777:        .data -678, -288, 622, 427
+        cmp *r0, #-91
+L778:        prn L379
+L779:        add L316, *r6
+        inc L771
+L780:        add *r2, L821
+L781:        cmp r1, r4
+L782:        jmp L806
+L783:        add L810, L810
+L784:        mov #-16, *r2
+L785:        add L674, r3
+        jmp L280
+        add r6, *r1
+L786:        inc *r4
+L787:        mov L84, r6
+L788:        clr *r2
+L789:        add *r6, r6
+L790:        dec r3
+L791:        mov *r1, r6
+L792:        cmp L799, L728
+        sub *r0, r6
+L793:        .string "hjbhhfugsqke"
+L794:        cmp r7, #7
+L795:        clr *r7
+L796:        inc r4
+L797:        jmp L632
+L798:        .string "msuktnac"
+L799:        mov #50, L341
+        mov *r7, r6
+L800:        .data 363, 288, 107, 850
+L801:        cmp *r5, L491
+        cmp #95, L823
+L802:        mov *r6, L819
+L803:        jsr L9
+L804:        .string "spncmfgepy"
+        add *r7, *r5
+L805:        cmp *r4, #10
+L806:        red L807
+L807:        .data -149, 594, 692, 589
+        clr L818
+L808:        not r6
+L809:        cmp r0, *r4
+L810:        mov #-7, r3
+L811:        add #32, L821
+L812:        clr r4
+        add *r2, r3
+L813:        jsr L488
+L814:        inc r6
+L815:        jmp L517
+L816:        clr r5
+L817:        jsr L230
+        add *r3, r4
+L818:        dec *r3
+L819:        sub L508, L771
+L820:        add L823, r7
+L821:        .data -793, -556, 302, -477
+L822:        cmp L524, *r7
+L823:        stop
@@ -0,0 +1,1161 @@
+; generated program, seed 13
+macr m0
+        inc r5
+        add #13, r5
+        sub #46, r7
+        sub #57, r3
+        mov #48, r6
+        add #26, r1
+endmacr
+macr m1
+        mov #35, r4
+        cmp #48, r1
+        mov #4, r0
+        not r4
+        not r1
+        inc r0
+endmacr
+macr m2
+        clr r0
+        sub #9, r6
+        mov #57, r5
+        clr r2
+        dec r3
+        inc r0
+endmacr
+macr m3
+        dec r4
+        add #8, r2
+        prn r2
+        red r7
+        not r4
+        add #59, r7
+endmacr
+macr m4
+        mov #16, r1
+        clr r1
+        dec r1
+        prn r2
+        inc r0
+        mov #58, r2
+endmacr
+macr m5
+        not r2
+        dec r1
+        red r7
+        not r5
+        cmp #19, r5
+        sub #20, r0
+endmacr
+macr m6
+        cmp #12, r5
+        cmp #45, r2
+        clr r6
+        red r3
+        sub #53, r3
+        red r1
+endmacr
+macr m7
+        not r1
+        dec r6
+        add #59, r1
+        prn r4
+        sub #60, r2
+        cmp #4, r5
+endmacr
+macr m8
+        mov #17, r5
+        mov #33, r0
+        cmp #12, r7
+        not r5
+        clr r0
+        clr r1
+endmacr
+macr m9
+        prn r7
+        sub #13, r4
+        cmp #63, r3
+        prn r5
+        dec r4
+        prn r5
+endmacr
+macr m10
+        mov #0, r6
+        add #15, r2
+        cmp #20, r4
+        red r0
+        cmp #11, r2
+        inc r1
+endmacr
+macr m11
+        red r7
+        cmp #38, r4
+        add #20, r2
+        sub #35, r0
+        red r4
+        clr r7
+endmacr
+macr m12
+        inc r7
+        cmp #15, r6
+        mov #48, r5
+        sub #47, r6
+        red r5
+        not r6
+endmacr
+macr m13
+        add #38, r4
+        dec r2
+        red r5
+        add #29, r6
+        sub #48, r6
+        add #49, r0
+endmacr
+macr m14
+        add #41, r4
+        mov #40, r0
+        mov #1, r5
+        sub #8, r5
+        cmp #12, r5
+        mov #21, r7
+endmacr
+macr m15
+        cmp #28, r4
+        sub #13, r3
+        sub #61, r4
+        add #43, r4
+        prn r0
+        red r4
+endmacr
+macr m16
+        not r6
+        inc r4
+        red r1
+        cmp #42, r4
+        cmp #4, r3
+        mov #0, r3
+endmacr
+macr m17
+        add #13, r7
+        inc r3
+        clr r2
+        dec r2
+        red r6
+        red r2
+endmacr
+macr m18
+        inc r0
+        mov #47, r5
+        not r3
+        prn r3
+        cmp #43, r4
+        red r3
+endmacr
+macr m19
+        mov #36, r7
+        not r4
+        clr r0
+        add #57, r7
+        mov #24, r4
+        sub #49, r7
+endmacr
+        dec r1
+        add *r1, r0
+        red r5
+        not r7
+        sub *r3, *r7
+        m19
+        .data -378, 369, -215, -452
+        inc *r4
+        .data 984, -742, -931, -723
+        add r2, r7
+        m12
+        cmp *r0, r6
+        m14
+        m11
+        not r4
+        dec r7
+        m2
+        m12
+        .data 500, -98, -765, -683
+        .data 118, 980, 578, 142
+        m10
+        m4
+        cmp r3, *r4
+        clr r6
+        mov #54, r0
+        not r7
+        sub #24, r0
+        sub *r6, r3
+        add *r7, r4
+        m11
+        cmp r2, r1
+        m16
+        m11
+        .data 470, 384, -45, -472
+        m4
+        sub r4, *r0
+        red *r3
+        prn r6
+        dec r6
+        prn r7
+        cmp r0, *r0
+        inc *r4
+        m13
+        add *r6, r4
+        m2
+        add #-69, r3
+        clr *r1
+        red r0
+        dec r4
+        m17
+        m4
+        inc r3
+        prn r6
+        mov r4, r2
+        sub *r3, r5
+        .string "obkfmaxgewgbt"
+        m10
+        mov r3, r7
+        add #-40, r5
+        m10
+        m12
+        m3
+        m18
+        cmp #-61, r5
+        add r5, r1
+        inc r4
+        m1
+        prn r5
+        mov *r5, *r3
+        clr *r4
+        m6
+        cmp *r0, #94
+        red r4
+        dec *r0
+        m3
+        mov #-61, *r1
+        m15
+        add #91, r6
+        mov r1, r5
+        red r2
+        mov #-51, *r4
+        mov *r6, r2
+        m15
+        m18
+        m15
+        m8
+        mov #51, r0
+        m9
+        m11
+        add #59, r1
+        m1
+        .data -859, -293, 545, 928
+        sub r1, r0
+        sub #-29, r3
+        m3
+        red r0
+        add *r2, r7
+        red r0
+        m3
+        m0
+        dec *r7
+        red *r3
+        sub #-45, r2
+        m18
+        red r5
+        clr *r1
+        .string "wbzyhkfbgj"
+        clr *r6
+        .data 934, 97, -956, 712
+        m8
+        .string "mpyjdyubjwbcl"
+        add *r7, *r1
+        inc *r7
+        inc r4
+        prn #15
+        m3
+        dec r7
+        m18
+        m10
+        clr *r5
+        .string "eotvezvpkjces"
+        red *r3
+        sub r7, r6
+        dec *r1
+        add #69, *r7
+        m13
+        m12
+        cmp r2, r5
+        m17
+        red r4
+        cmp r3, #92
+        add r6, *r2
+        prn #57
+        dec r1
+        add *r6, *r3
+        mov *r5, *r0
+        m18
+        prn r6
+        m5
+        mov #-53, *r5
+        inc r3
+        .data 358, -700, -505, -247
+        red r7
+        prn *r0
+        m1
+        m0
+        add r1, r4
+        red *r3
+        red *r1
+        m6
+        red r5
+        not r4
+        dec *r0
+        sub r1, r0
+        clr *r1
+        m3
+        m19
+        cmp *r4, r5
+        sub r1, *r1
+        m12
+        red r7
+        .data 490, 992, 963, -105
+        red r1
+        mov *r4, r6
+        dec *r2
+        add r3, r4
+        inc r7
+        m10
+        .string "anigcbixqavp"
+        red r5
+        m1
+        red r7
+        cmp #-28, *r4
+        m15
+        m14
+        mov #50, *r0
+        not *r6
+        cmp #45, r0
+        red r2
+        m17
+        m5
+        not r7
+        dec *r6
+        sub #-36, *r5
+        red r5
+        m15
+        clr r4
+        red *r3
+        cmp #-18, r0
+        prn r5
+        m19
+        m1
+        not *r2
+        m2
+        mov r7, r0
+        sub #-52, r2
+        m9
+        m6
+        inc r7
+        mov #15, *r2
+        mov *r2, *r1
+        clr r6
+        m6
+        sub r6, *r2
+        not *r1
+        prn r5
+        m1
+        not *r7
+        cmp r0, r7
+        add r3, *r0
+        not r5
+        .data -869, -203, 829, -941
+        mov r7, r0
+        cmp #-70, #-58
+        sub r7, *r0
+        .data -760, 458, 142, -676
+        dec r4
+        sub *r0, r4
+        mov *r2, *r2
+        cmp #-21, r3
+        m18
+        not r1
+        m17
+        inc *r7
+        m2
+        m6
+        not r6
+        not r6
+        mov r3, *r5
+        clr *r4
+        dec *r1
+        prn r7
+        not *r4
+        cmp r5, #-35
+        m17
+        clr r7
+        m15
+        mov r6, *r5
+        inc *r3
+        m6
+        mov #-54, r3
+        .string "fpepkuyzchn"
+        m18
+        m2
+        m3
+        add #-93, *r1
+        inc *r5
+        .string "iyeemkkpyyboofx"
+        sub #63, r4
+        prn *r2
+        .string "scbnwpjdazpiszyr"
+        mov #-10, r2
+        m6
+        red r5
+        prn *r5
+        inc r2
+        dec r2
+        red r7
+        add #-53, *r4
+        sub #90, r1
+        sub #83, *r5
+        cmp r2, *r1
+        .data -566, 320, 620, -81
+        m6
+        cmp #-16, #-39
+        m10
+        sub *r3, r3
+        mov *r5, r6
+        m11
+        mov r6, r3
+        .string "oqbtswdrsdfcbj"
+        .string "ogpivnhgwwcpdsmqn"
+        sub *r4, *r1
+        mov r6, *r5
+        red r2
+        sub r0, r0
+        m18
+        inc r0
+        prn r5
+        add *r3, r1
+        m0
+        not *r4
+        m5
+        dec r3
+        m11
+        mov #77, *r5
+        cmp r4, r7
+        cmp #58, *r7
+        dec *r7
+        m3
+        sub #-76, r3
+        m11
+        m17
+        sub r0, r6
+        mov r7, r3
+        cmp r2, r4
+        m9
+        .data 648, 319, 313, 20
+        mov r5, r4
+        .data -590, 293, 751, 54
+        prn *r0
+        dec r7
+        m7
+        cmp r4, #77
+        m2
+        clr r4
+        sub *r7, r5
+        .data -524, -264, -932, 914
+        m7
+        prn #-90
+        cmp #-79, #61
+        red *r7
+        inc *r1
+        dec *r7
+        m17
+        add r5, r2
+        dec r0
+        m14
+        mov r6, r7
+        dec *r7
+        mov #-87, *r1
+        sub r2, r4
+        mov *r0, r4
+        add *r3, r4
+        .string "pljeqoileshukw"
+        mov #7, r7
+        dec r5
+        .string "iiepqmjirdw"
+        not r7
+        m1
+        m9
+        m10
+        m0
+        inc *r6
+        cmp *r1, r3
+        clr *r2
+        m3
+        m14
+        add #25, r1
+        add #73, r3
+        m11
+        not *r4
+        m17
+        .data -319, 7, 144, -784
+        clr r1
+        m14
+        .data -469, 968, 596, -448
+        .data -543, 375, 199, -506
+        sub r4, r7
+        m14
+        m3
+        m6
+        add r5, r2
+        .string "vjjgysreypu"
+        m11
+        cmp *r0, #25
+        m12
+        red r5
+        sub r3, r7
+        m16
+        m4
+        m11
+        m8
+        .data 512, 967, -819, -197
+        add #66, *r1
+        m7
+        .string "frsowgchyxajxmmou"
+        m7
+        m15
+        inc *r5
+        m0
+        sub r5, *r3
+        m3
+        not r4
+        mov r2, r4
+        m14
+        .data 580, 8, 506, 725
+        add r5, r5
+        add #46, r1
+        m2
+        m10
+        not r3
+        clr *r4
+        dec r5
+        add *r3, r6
+        sub r0, *r3
+        sub *r4, r7
+        dec r6
+        add r4, r4
+        .data -710, -545, -756, -868
+        m5
+        add *r2, r5
+        not r0
+        red r4
+        .string "gnmlizjprbknowjnq"
+        inc r5
+        red r6
+        m13
+        m14
+        prn r4
+        inc r0
+        cmp #-85, r7
+        m11
+        m11
+        add r4, *r5
+        m11
+        cmp r7, *r2
+        sub r7, *r1
+        m5
+        inc r3
+        add r0, *r3
+        red *r4
+        mov r3, r6
+        .data 197, -200, -477, 718
+        red r6
+        add #-54, r5
+        add r6, r7
+        prn r3
+        add *r7, r2
+        m4
+        prn *r5
+        cmp #-90, #94
+        mov #-94, r0
+        m9
+        m14
+        cmp r2, r2
+        not r2
+        m1
+        m4
+        mov r5, r4
+        inc r7
+        m8
+        m4
+        m7
+        cmp r3, *r5
+        inc *r2
+        m6
+        red *r6
+        m17
+        mov r5, r4
+        m17
+        m19
+        add r4, *r5
+        red *r1
+        m11
+        add #-86, *r4
+        dec *r7
+        .data -439, -272, -900, 883
+        clr r3
+        sub *r1, *r1
+        cmp *r0, r2
+        m4
+        add #-95, r1
+        m5
+        m12
+        sub r2, r2
+        dec r2
+        add *r0, *r0
+        m12
+        clr *r1
+        dec r6
+        prn r6
+        m0
+        cmp r0, *r6
+        m2
+        m16
+        red *r7
+        m16
+        m19
+        prn r0
+        dec r4
+        m2
+        sub #71, *r4
+        mov r3, *r7
+        mov r5, *r4
+        dec *r3
+        m11
+        m11
+        m0
+        m3
+        m10
+        not *r4
+        m13
+        clr r2
+        cmp r4, #96
+        m15
+        m19
+        cmp #-7, r6
+        m9
+        add *r2, r2
+        inc *r5
+        red r2
+        sub r6, r0
+        cmp #-22, r1
+        mov r6, *r7
+        sub *r2, r0
+        m5
+        add r1, r4
+        mov r7, *r3
+        m0
+        not r7
+        not r5
+        m7
+        .string "atpqttbrxfbaoltb"
+        cmp r5, r3
+        m1
+        m5
+        .string "dzivwwkuzvzw"
+        m9
+        cmp r0, *r4
+        clr r6
+        not r1
+        mov r5, r5
+        m11
+        prn r3
+        clr r0
+        not r7
+        dec r6
+        not *r3
+        mov r5, r0
+        m6
+        cmp r4, #57
+        m6
+        sub #-55, r4
+        m0
+        sub r4, r6
+        clr r2
+        inc r3
+        red r7
+        .string "cwdwkrfztxysghumjrss"
+        inc r5
+        m0
+        add *r3, *r7
+        .string "wtvgysbixt"
+        sub r5, r2
+        m1
+        m19
+        m13
+        prn #-41
+        sub #75, *r1
+        .data -398, 543, 180, -652
+        dec r5
+        m15
+        add *r4, *r5
+        m7
+        m3
+        cmp r4, r3
+        m7
+        m2
+        prn r2
+        sub *r2, *r0
+        m9
+        red r3
+        cmp #-33, r5
+        m14
+        m9
+        cmp *r3, *r3
+        red r3
+        clr *r4
+        add #-83, *r5
+        red *r7
+        dec *r7
+        sub *r6, *r7
+        .data -828, 887, 312, -951
+        m18
+        cmp #67, #24
+        mov #28, r6
+        red r5
+        clr *r0
+        m10
+        prn r6
+        cmp r0, r4
+        red r1
+        clr r0
+        add *r4, r0
+        dec r0
+        mov r1, r4
+        add r0, *r3
+        mov #83, r1
+        sub r3, r7
+        m8
+        m7
+        not r1
+        sub *r4, *r1
+        .data -347, -920, -872, -552
+        m4
+        prn #24
+        .string "pdbloryvqvc"
+        dec *r1
+        not *r5
+        .string "admkfxryptzjya"
+        mov *r6, r6
+        add #58, *r2
+        prn #82
+        m5
+        m8
+        m0
+        mov *r4, *r0
+        not *r7
+        mov #-50, *r7
+        m17
+        red r0
+        dec r7
+        m0
+        m15
+        clr r6
+        sub #-38, r4
+        m2
+        not r3
+        m13
+        sub r5, r0
+        sub r1, *r0
+        sub *r5, *r6
+        m12
+        sub #44, *r1
+        .data 984, 110, 624, -797
+        m12
+        m17
+        m8
+        add *r5, *r4
+        mov #65, *r0
+        m16
+        .string "unpgekuesz"
+        m14
+        red r2
+        m15
+        dec r2
+        m13
+        .string "fhoixymrtd"
+        clr r4
+        m0
+        m14
+        sub r0, *r5
+        prn #-95
+        cmp #69, r3
+        cmp #80, *r0
+        m6
+        m11
+        m6
+        prn r4
+        sub #70, r2
+        m4
+        not r4
+        m5
+        .data -341, 44, 639, 617
+        mov #88, r0
+        m4
+        red *r5
+        m7
+        sub r1, r2
+        mov *r4, *r3
+        m18
+        cmp #23, #6
+        not r0
+        red *r4
+        red r1
+        cmp #-93, *r5
+        m0
+        cmp r2, #85
+        .data 484, 624, -715, -289
+        .string "jkrrfcotxyroexui"
+        dec *r1
+        sub #75, *r4
+        m15
+        m2
+        m17
+        not r2
+        clr *r4
+        cmp *r6, r7
+        cmp #41, #-45
+        mov #-86, *r4
+        inc r4
+        inc r4
+        m10
+        mov r2, r7
+        m1
+        not r5
+        cmp r1, r4
+        inc *r7
+        inc r7
+        dec *r5
+        .data -725, 531, -965, -51
+        m7
+        add r6, *r4
+        not r3
+        m10
+        m9
+        sub r1, r0
+        m15
+        prn r0
+        m15
+        .string "yujzwyobnw"
+        sub *r7, r3
+        m2
+        add #46, r6
+        not r6
+        red r3
+        m3
+        mov r6, r6
+        m17
+        m2
+        cmp r3, #-10
+        cmp r3, #35
+        m6
+        cmp #-71, *r3
+        prn r5
+        m2
+        not r4
+        prn *r7
+        not r1
+        m2
+        clr r4
+        inc *r0
+        m8
+        m15
+        m13
+        m15
+        add #-95, r5
+        prn r6
+        m16
+        m0
+        mov #-48, r4
+        m18
+        mov #8, r1
+        m19
+        sub *r0, *r2
+        not r5
+        .data -772, 774, -648, 469
+        add #-99, r1
+        clr r1
+        .data 70, -402, 922, -23
+        m6
+        m19
+        sub r5, r3
+        inc r3
+        m8
+        .string "yyqnvbnxhfkbg"
+        cmp r0, *r5
+        m7
+        dec *r7
+        add r5, r0
+        add r1, r4
+        mov r0, r0
+        mov r3, *r7
+        inc r2
+        prn r0
+        m14
+        inc r3
+        m12
+        m9
+        sub *r2, r3
+        mov r5, r7
+        mov *r5, r1
+        prn r3
+        m2
+        red r0
+        cmp r6, r5
+        red r3
+        dec r6
+        sub *r7, r1
+        m18
+        dec *r7
+        m1
+        m1
+        m4
+        sub r6, r0
+        inc r2
+        dec *r0
+        m6
+        inc *r3
+        red *r6
+        m0
+        add r0, *r5
+        not *r6
+        not *r2
+        m0
+        m18
+        mov *r6, r2
+        m0
+        m18
+        m5
+        m12
+        m7
+        .string "sotksbnxqyf"
+        inc r7
+        add #15, r2
+        sub r1, r1
+        not *r2
+        m18
+        mov *r7, r0
+        cmp *r3, r4
+        add #-35, r0
+        cmp r3, r0
+        mov #-58, r3
+        clr r3
+        dec r1
+        red r5
+        mov r5, *r6
+        red *r6
+        sub #47, *r4
+        red *r2
+        m13
+        add r0, r5
+        .data 744, -880, -817, -833
+        red r7
+        red r4
+        clr *r5
+        m18
+        sub r5, *r2
+        mov *r3, r0
+        add *r6, r2
+        sub #6, *r7
+        mov #43, r3
+        dec r0
+        cmp *r1, r6
+        dec r0
+        m16
+        mov r4, r3
+        add #90, r6
+        inc *r3
+        clr *r0
+        m6
+        m0
+        sub r2, r3
+        .string "xefnvqinox"
+        mov #-10, r7
+        not *r0
+        clr *r2
+        m16
+        sub r3, r2
+        clr *r3
+        .string "otgpxhbh"
+        sub *r0, r4
+        inc r0
+        m0
+        cmp *r2, r5
+        prn r6
+        m1
+        cmp r2, *r2
+        m19
+        dec r5
+        not *r7
+        cmp r2, #-39
+        m5
+        cmp *r0, *r5
+        red r5
+        m3
+        dec r4
+        m17
+        dec r3
+        .data 185, 888, 941, 205
+        m2
+        inc *r1
+        m15
+        m5
+        not r4
+        mov *r4, r2
+        m11
+        cmp r1, r0
+        .string "qrymnnefcxxnd"
+        mov *r7, *r0
+        mov r2, r1
+        add r4, r5
+        m9
+        m11
+        prn r5
+        mov r2, *r7
+        not *r5
+        m13
+        cmp r2, #-82
+        not r6
+        mov r4, r7
+        m14
+        inc r3
+        sub *r2, *r5
+        m10
+        .data -888, 286, -491, 618
+        m17
+        m0
+        inc *r0
+        m8
+        mov #69, *r3
+        m17
+        m4
+        .data -990, 974, -417, 394
+        m17
+        cmp r2, #-19
+        m11
+        m17
+        clr r0
+        clr r5
+        red r3
+        mov #-45, r1
+        prn *r5
+        clr *r5
+        cmp r1, *r3
+        sub *r1, *r4
+        clr r7
+        m1
+        mov #12, r7
+        cmp #44, r0
+        m12
+        .data -644, 606, -959, 56
+        m19
+        prn #51
+        red *r0
+        dec r5
+        sub *r4, r6
+        .data -579, 419, -584, -793
+        inc *r3
+        .data -315, -783, 678, -288
+        .data 171, -443, -711, 895
+        m0
+        inc r2
+        inc *r5
+        inc *r2
+        m15
+        m1
+        prn r3
+        m6
+        m8
+        .string "auvrmvhyiztk"
+        clr *r0
+        m6
+        m1
+        m0
+        m10
+        cmp *r0, *r1
+        add #-69, *r0
+        m12
+        m10
+        m6
+        prn r2
+        cmp *r0, r4
+        sub #-28, r0
+        cmp r7, r7
+        m8
+        mov *r0, *r6
+        add *r3, r1
+        m1
+        m0
+        m7
+        inc r0
+        m15
+        add *r3, r6
+        .string "arxikdexrzrkuv"
+        red r7
+        m13
+        prn *r3
+        m13
+        m9
+        prn r1
+        not r5
+        m19
+        m10
+        .data -116, 539, 911, 649
+        m3
+        m3
+        add r4, *r4
+        dec r0
+        .data 52, 649, 946, 678
+        prn *r7
+        dec *r4
+        m8
+        m10
+        m4
+        m0
+        add r5, r1
+        add #-46, *r2
+        m2
+        not r0
+        .data 625, -405, 678, -955
+        m15
+        add #-4, *r6
+        dec r6
+        inc r6
+        dec r7
+        m11
+        add #72, r5
+        mov r3, r2
+        not r3
+        m17
+        m18
+        inc r1
+        m3
+        inc r1
+        .data 405, -411, 162, 969
+        add *r6, r2
+        .string "kcdkydgftfmfgu"
+        inc r0
+        m6
+        add r6, *r1
+        clr r4
+        m0
+        sub r3, *r5
+        m11
+        m5
+        clr r2
+        mov r1, r7
+        stop
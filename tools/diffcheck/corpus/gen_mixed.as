@@ -0,0 +1,1012 @@
+; generated program, seed 11
+.entry L2
+.entry L25
+.entry L36
+.entry L41
+.entry L54
+.entry L63
+.entry L105
+.entry L109
+.entry L112
+.entry L134
+.entry L136
+        add #12, r5
+        .data -864, 497, -817, 36
+        cmp r2, *r4
+        add r5, *r3
+        prn r0
+        sub r6, L4
+        mov *r2, L64
+L0:        clr *r4
+        sub #47, r1
+L1:        cmp *r3, *r5
+        dec r6
+        sub *r7, *r7
+L2:        sub r5, L125
+        add L2, L1
+        add #-71, r7
+        not r3
+        add #24, *r2
+L3:        mov *r6, r3
+        not L3
+        cmp r7, *r1
+        bne L79
+        sub #-91, L183
+        sub *r4, r1
+        bne L3
+        prn *r2
+        jsr L0
+        sub *r1, r1
+        cmp L0, L172
+        bne L100
+        jsr L2
+        dec L140
+        jsr L3
+L4:        cmp #97, #92
+        add r2, L4
+L5:        clr *r3
+        clr r3
+        clr *r5
+        sub r5, *r7
+        .data 754, -558, 187, -769
+        sub *r2, L0
+        add L31, r3
+        .data -867, -488, 460, -421
+        jmp L168
+        mov L112, *r7
+        mov *r6, *r0
+        .data -607, 734, -333, -521
+        add r2, L29
+        cmp *r3, *r1
+        dec *r3
+        cmp *r7, *r1
+        add #-33, *r7
+L6:        jsr L2
+        mov *r7, L4
+        .data -22, -893, 747, 360
+        sub r2, L6
+        jsr L47
+        cmp *r6, #-76
+        sub L159, r5
+        sub L0, r4
+        sub *r5, r4
+        sub *r5, L19
+        add #-23, r3
+        cmp #-23, #56
+        add #-34, r5
+        .string "hzyjzpggamwk"
+        jsr L2
+        sub r0, *r7
+        jsr L123
+        add r3, L46
+        add r6, L3
+        bne L6
+        bne L4
+        cmp r7, r4
+        not r6
+L7:        bne L170
+        prn #-9
+        jmp L1
+        add r3, L186
+        clr L173
+        prn *r5
+        bne L4
+        dec L7
+        red L5
+        prn #-18
+        sub L97, L1
+        cmp #6, r0
+L8:        .data 289, -119, -934, -720
+L9:        add *r0, L3
+        add *r7, r2
+        .string "lrrrdnxrlvupt"
+        .string "tmjerdvzlriq"
+        inc L6
+L10:        bne L123
+L11:        cmp #-52, *r2
+        mov *r7, *r7
+        clr *r5
+        cmp #-67, r6
+        jmp L183
+        mov r2, r6
+        add r1, r0
+L12:        sub #-79, *r5
+        jsr L12
+        dec L65
+        sub L5, *r3
+        red L5
+        mov r5, *r1
+L13:        cmp *r6, r4
+        jsr L5
+L14:        bne L13
+        prn #-66
+L15:        jsr L13
+        add #-88, r3
+        .data -995, 402, 825, -154
+        jmp L98
+        mov r4, r2
+L16:        not L3
+L17:        add *r3, *r6
+        sub L100, L17
+        add r6, *r0
+        mov r6, L150
+        add #24, r0
+        mov r6, L11
+L18:        cmp #-6, r1
+L19:        sub r4, r3
+        mov #-95, L3
+        red L50
+        cmp L107, *r5
+        bne L59
+        inc *r2
+        bne L2
+L20:        sub r1, r0
+        prn *r4
+L21:        bne L62
+        cmp #-37, #0
+        sub #-61, *r4
+L22:        not L126
+        add L36, r2
+        clr *r4
+        jmp L26
+        red r7
+        clr L12
+        prn r3
+L23:        add #13, r4
+        add L14, r5
+        add r7, L13
+L24:        jmp L8
+        clr L22
+        add #40, r3
+        bne L23
+        add r0, *r6
+        sub *r7, r2
+        dec *r2
+        jmp L11
+        cmp r3, #-84
+        add #-63, L4
+L25:        not r7
+        .data -299, 510, 9, 439
+        bne L18
+        sub #59, *r5
+        mov L2, *r4
+        add L85, r4
+        bne L41
+        jsr L138
+        inc L12
+L26:        cmp L153, #-69
+        add *r4, r1
+        cmp r5, r6
+L27:        .string "kaikkglpvxp"
+L28:        dec r3
+        jmp L145
+        prn r6
+L29:        mov r2, r2
+        .data 360, -3, 20, 642
+        jsr L146
+        bne L32
+        clr r3
+        cmp #-21, *r3
+        dec *r7
+        jmp L133
+L30:        .data -353, -792, 220, -398
+        add #44, *r6
+        not r2
+        sub *r6, L14
+        not r1
+        add *r0, *r2
+        mov r2, *r4
+L31:        bne L3
+        sub *r5, *r5
+L32:        mov r6, L22
+L33:        .data 193, 346, 808, 251
+        sub #-78, L15
+        .data -201, 712, -864, -818
+        sub *r3, r7
+        cmp *r7, r0
+        cmp r0, L159
+        red L22
+        cmp *r6, L14
+        cmp L26, #95
+        mov #1, r1
+        sub *r3, L8
+        sub L15, L151
+        jmp L2
+        .data 196, 198, 840, -145
+        bne L30
+        bne L123
+        prn L27
+        mov *r5, L105
+L34:        sub r1, *r7
+L35:        add r2, *r5
+        .data -372, 965, 513, 404
+        add *r2, r4
+L36:        cmp r7, #-48
+        cmp r1, r4
+        sub L136, L32
+        sub *r7, *r4
+L37:        sub *r6, *r1
+        mov L112, r0
+        red L170
+        mov r6, r4
+        sub L35, r5
+L38:        sub L73, *r6
+        jmp L114
+        mov *r3, L157
+L39:        not *r3
+        not *r5
+        dec L53
+        sub *r2, L10
+L40:        cmp L12, #-82
+        sub #-7, r1
+        jmp L19
+        jmp L102
+        mov *r5, r5
+        add *r1, *r3
+        inc L48
+        mov L30, L21
+        red *r4
+        jmp L67
+        add *r3, *r0
+L41:        cmp #-65, L38
+        not *r0
+        jmp L31
+        add *r1, *r5
+L42:        mov *r0, L82
+L43:        bne L1
+        not r4
+L44:        bne L11
+L45:        mov *r4, L21
+        bne L33
+        inc r1
+L46:        red L9
+L47:        dec r1
+        add L66, *r2
+L48:        bne L46
+        not r3
+L49:        sub L2, L132
+        clr *r3
+        prn r6
+        not L116
+        jsr L23
+        jmp L123
+        cmp L152, r0
+        bne L117
+        mov L41, *r4
+        add #16, L40
+        inc L138
+L50:        .data 861, 474, -909, -37
+L51:        add L3, r1
+        clr *r6
+L52:        add r6, L107
+        clr *r3
+        mov #85, *r5
+        cmp *r5, r5
+        cmp r4, #-34
+        add *r2, r2
+        add *r1, *r6
+        jsr L193
+        jsr L161
+        red L67
+L53:        sub L12, L70
+        cmp L50, r6
+        cmp #0, r1
+        clr L147
+        sub *r2, L92
+        cmp #35, L48
+L54:        mov L155, *r4
+        clr r1
+L55:        sub r3, *r7
+        add #-50, *r6
+        jsr L124
+        mov r4, *r3
+        dec *r2
+        cmp r2, #-99
+        .string "vzkydxzbuovfytze"
+        red L39
+        inc r3
+        not r3
+        mov *r7, *r1
+L56:        inc r7
+        not r6
+        jsr L70
+        red *r3
+L57:        mov r1, r2
+        mov *r7, *r6
+        dec L154
+        add *r2, *r7
+L58:        cmp L52, *r3
+        jsr L43
+        .string "frztgmreltblv"
+        sub r3, r7
+        jmp L2
+        jsr L25
+L59:        prn r3
+        add *r6, *r7
+L60:        sub *r2, L179
+        prn L44
+L61:        dec r4
+L62:        mov #34, r6
+        not *r2
+        jmp L33
+L63:        clr r0
+L64:        clr r6
+L65:        cmp L5, #-46
+        red L61
+        dec *r1
+        mov #-15, r6
+        red L11
+        .data 417, 136, -503, -636
+        prn L48
+        bne L19
+        sub r1, L5
+L66:        not L140
+        add #-82, L18
+        mov L126, r5
+        sub #44, L32
+        jsr L172
+        sub r2, *r5
+        sub *r3, *r6
+L67:        jmp L56
+        bne L34
+        .string "vbsuxutmj"
+        cmp *r7, L38
+        prn L80
+        sub *r5, *r2
+        inc L91
+        mov *r0, *r6
+        .data 788, 105, -118, 235
+        jsr L108
+        sub L41, L119
+        bne L7
+L68:        cmp L45, r1
+        mov #-28, r5
+        red *r6
+L69:        inc r6
+        .data -34, 308, -680, 585
+        add r1, L70
+L70:        prn r0
+L71:        cmp #52, #75
+        red L57
+        cmp r4, L57
+        cmp #-70, r5
+        prn L33
+        mov L39, *r4
+        jmp L80
+        add L38, *r4
+L72:        mov L37, *r7
+        bne L24
+        cmp r7, *r1
+        jmp L28
+        sub L12, r5
+        jmp L70
+        .data -613, -638, 309, 954
+        mov *r2, *r5
+        jsr L111
+        .data -439, -215, -921, -528
+        sub *r3, *r4
+L73:        prn L33
+        clr L121
+        cmp r6, L24
+L74:        sub #57, *r2
+        red r7
+        cmp L129, #56
+        jsr L192
+        prn *r2
+        add *r3, *r5
+        cmp #-27, *r7
+        bne L156
+        mov r6, r1
+        sub L88, L29
+L75:        add #-15, *r7
+L76:        .string "avjgsrvaxl"
+        add #-89, r7
+        .string "yptgaptcice"
+L77:        mov L186, L25
+        red r2
+        not r1
+        red L163
+L78:        red r3
+        dec *r5
+        jsr L102
+        sub r5, r7
+        mov L172, L163
+        red L1
+        jsr L25
+        clr L99
+        red *r5
+        jsr L139
+        cmp *r1, #-15
+L79:        inc r5
+        jmp L41
+L80:        cmp L135, r6
+        .data -647, 630, -860, -149
+L81:        .data 489, -655, -982, 230
+        .string "msndaoknriz"
+        sub *r6, *r2
+        sub #33, L4
+        jsr L5
+L82:        cmp *r2, *r1
+        prn *r7
+        .string "hleacgxevyfi"
+        sub #-21, r3
+        .data 916, -379, 467, -824
+        prn r7
+        sub *r6, *r1
+        not r2
+        jmp L118
+        red *r1
+        prn *r3
+L83:        add #-22, r5
+L84:        add *r6, L188
+        jsr L93
+        clr L51
+        not r6
+        inc r2
+        add L93, L55
+L85:        sub r4, r7
+        jsr L189
+        jmp L115
+        prn r1
+L86:        bne L2
+        jmp L37
+        mov r4, r6
+        jsr L3
+        sub r1, r0
+        inc L80
+        inc r4
+        cmp #-84, *r1
+        sub *r1, *r0
+        jmp L90
+        mov #-55, *r6
+        prn r5
+L87:        mov L140, r1
+        not *r4
+        bne L146
+L88:        prn #-77
+        not *r5
+L89:        .data -507, 885, -187, 96
+        bne L155
+L90:        .data -382, 44, -702, -953
+        inc L79
+L91:        mov #85, L11
+        jsr L39
+        mov #-62, *r0
+        dec r1
+        sub r0, r7
+        cmp L85, *r6
+        mov L71, *r4
+        cmp r2, #-59
+        cmp #52, r7
+        dec r5
+        mov #46, L67
+        .data -807, 220, -993, -201
+        red L60
+        cmp r5, L11
+        prn *r3
+        clr r7
+        clr r5
+L92:        clr L93
+        add r6, *r4
+L93:        cmp r7, L134
+L94:        jsr L59
+L95:        cmp L169, #89
+L96:        cmp #98, L114
+        inc *r7
+        not *r5
+        add L27, L70
+        bne L31
+        sub L72, r2
+        bne L178
+        cmp #-79, *r3
+        red L105
+        mov #85, r2
+        red r4
+        jmp L160
+        sub #-58, r4
+        sub r5, L20
+        prn r7
+        not *r4
+        sub #-3, r4
+L97:        mov L49, *r3
+        clr *r4
+        clr *r1
+L98:        mov *r7, *r0
+        .data -370, 174, 127, -457
+        .data -399, -646, -412, -282
+        sub *r0, r2
+        cmp L132, *r1
+        sub r2, *r1
+        .data 480, -308, 447, 743
+        sub L168, L165
+        sub #57, r5
+        prn L92
+L99:        mov r6, *r4
+        inc L148
+L100:        mov r6, r2
+        jmp L131
+        sub *r1, r3
+        red r6
+        prn #-36
+        dec r7
+        cmp #-83, L161
+        cmp L171, #75
+        add #1, *r2
+        clr r3
+        jsr L59
+        sub L128, L87
+        mov L101, L39
+        prn *r2
+        red L169
+        sub L180, *r2
+        mov r0, r4
+        jsr L39
+        sub r1, L8
+        .data 380, -463, -677, 120
+        cmp L183, #-36
+        .data -612, -211, -745, 746
+        sub L156, *r6
+        cmp *r6, L163
+        add #-9, L142
+L101:        jmp L38
+        clr L131
+        jmp L81
+        sub r6, r7
+        red *r1
+        jsr L99
+L102:        jsr L13
+        mov *r5, r4
+        red r3
+L103:        cmp L163, #6
+        cmp *r6, r6
+        inc *r6
+        clr r0
+        inc L164
+        red L138
+        cmp r6, r7
+        add #-53, r2
+        inc r1
+L104:        mov *r5, L175
+        .data 127, 877, -250, 429
+        cmp #31, *r7
+        bne L160
+        sub r6, L131
+        prn *r4
+        inc r2
+        bne L63
+        cmp *r6, #35
+        jsr L73
+        jmp L50
+        .data 759, 764, 868, -830
+        bne L155
+        cmp r2, r1
+L105:        mov L99, L192
+        sub r1, *r6
+        add L22, *r1
+L106:        cmp r5, #36
+        dec *r4
+        jsr L67
+L107:        red *r0
+        clr r7
+        .data 378, 370, -405, -280
+        inc *r7
+L108:        cmp L148, L193
+        jmp L8
+        sub r5, *r2
+        mov r0, r0
+        cmp *r4, L161
+        cmp L153, *r1
+L109:        red *r2
+        .data 45, -355, 193, 970
+        jsr L163
+        cmp *r4, r5
+        cmp *r4, *r3
+        .string "jqdjalfvoodmou"
+        .data -82, 79, 862, 466
+        .string "whnruyiar"
+L110:        mov r6, *r5
+L111:        not L59
+        cmp L108, r6
+        prn *r4
+        clr r5
+        mov L45, *r4
+        not *r3
+L112:        mov *r0, L190
+        jmp L191
+L113:        cmp #-15, L160
+        cmp *r7, #87
+L114:        prn #-29
+L115:        mov L30, *r3
+        cmp #40, r3
+        mov #86, *r6
+L116:        sub *r3, r0
+        sub *r1, r5
+        sub #1, r0
+        sub L97, *r3
+L117:        add #39, *r6
+L118:        clr *r3
+        sub r5, r1
+        dec L131
+L119:        clr *r5
+        mov #-44, *r1
+        cmp r2, L37
+        mov L75, L165
+        add L123, *r2
+        inc r6
+        prn L69
+        add r3, L79
+        mov *r7, r0
+        jsr L101
+        sub *r6, r3
+        dec r0
+        add L100, r1
+L120:        cmp r1, L166
+L121:        jmp L88
+        mov L183, L141
+        inc r0
+        not *r4
+        cmp L100, *r6
+        sub *r1, r0
+        .string "vmiqgthpswbyhaoo"
+        sub *r6, *r2
+        add #24, *r3
+        jsr L180
+L122:        cmp #83, #57
+        bne L182
+        jsr L38
+        not r0
+        jsr L154
+        dec r3
+        bne L107
+        mov #-15, r3
+L123:        sub #-17, *r2
+L124:        mov #6, *r3
+        prn r0
+        prn #-34
+L125:        prn r5
+        add r6, r0
+        .string "ivqweeowok"
+        jmp L129
+        inc L129
+        inc L78
+        inc *r3
+        prn #-69
+        cmp r7, *r4
+        prn *r0
+        sub r5, L159
+L126:        add *r1, r7
+        mov r1, r4
+        red r1
+        prn L174
+        add *r3, L29
+        add L182, *r2
+L127:        cmp #62, r3
+        mov #8, r6
+        jmp L164
+        cmp r2, L172
+L128:        jmp L179
+L129:        mov r0, *r4
+        bne L87
+        clr r1
+        mov L104, L14
+        add #-20, r4
+        dec r2
+L130:        .data -793, -607, 679, -67
+        add #50, L190
+L131:        add r1, *r5
+        mov r0, r7
+        not *r5
+        cmp L164, L85
+L132:        mov #-40, L187
+        sub *r6, r4
+L133:        bne L104
+        jsr L149
+        add r4, *r7
+        red L2
+        prn *r5
+        jsr L135
+L134:        jsr L148
+L135:        dec L136
+        sub r0, *r1
+        jmp L169
+        bne L33
+        dec *r3
+L136:        bne L81
+        mov *r6, r5
+L137:        dec r7
+        bne L89
+        .data -838, 51, 510, -766
+        dec r5
+        prn *r6
+L138:        bne L46
+        bne L90
+        cmp r0, #-30
+        jsr L154
+L139:        clr *r7
+        sub r0, L192
+        clr r3
+        clr *r3
+        cmp L57, #-10
+L140:        sub #-64, L130
+        mov r3, L144
+        dec *r7
+L141:        sub L168, L145
+        add r5, *r2
+L142:        jmp L131
+        .data 919, -893, -547, 781
+L143:        mov *r4, L167
+        cmp #-60, r0
+        sub r4, L34
+        dec *r5
+        .data -380, 806, -891, 657
+        .data -418, -376, 478, 143
+        cmp r5, *r5
+        mov r0, *r5
+L144:        jmp L84
+        clr r4
+        sub #98, *r0
+        sub *r3, r3
+L145:        sub L80, L75
+        jmp L154
+        prn L190
+        .data 245, -623, 657, -145
+        bne L148
+        mov #-55, L178
+        clr *r5
+L146:        sub *r2, r7
+        jsr L97
+        jsr L170
+        jmp L48
+        jsr L129
+        add #-33, *r2
+        cmp *r5, #-18
+        jmp L163
+        sub *r7, L63
+        prn L157
+        not L92
+        add L139, L178
+        cmp #4, L166
+        add r1, L64
+        add r3, *r3
+        dec r7
+        red L66
+        cmp r6, r5
+L147:        .string "mtskuqadedfikmpjmjgp"
+L148:        bne L115
+        jmp L7
+        mov *r0, *r0
+        jsr L149
+        prn *r6
+L149:        add *r2, r0
+        add *r2, r1
+        .string "dibfkpzoznebn"
+L150:        inc r0
+        cmp #-54, *r2
+        cmp L91, #17
+        cmp r4, *r6
+        clr L174
+        clr *r1
+        mov L146, r5
+        sub *r7, r2
+        not *r0
+        sub #92, *r0
+L151:        cmp r3, *r6
+        jmp L16
+L152:        bne L65
+        red *r1
+        mov r6, *r6
+        sub #-79, L85
+        .data 815, -252, 261, 589
+        add r4, r0
+L153:        bne L119
+        .data -800, -671, -654, -559
+        add #-81, r6
+        mov *r2, *r3
+L154:        not r6
+        prn L83
+        sub #-29, *r3
+L155:        .data -224, -323, 533, 601
+L156:        jmp L116
+        .string "qwzancjcqdwllxcngt"
+        cmp *r0, r3
+        .data 261, -726, -821, -484
+        sub *r0, *r6
+        add r6, *r4
+        mov r1, *r3
+        jmp L187
+        not r0
+        clr *r2
+        clr L141
+        mov *r2, L99
+        not r0
+        mov #-93, *r3
+        sub L161, *r6
+L157:        add L75, r0
+        cmp L189, L167
+L158:        not *r4
+        jsr L184
+        not *r5
+        jmp L21
+L159:        inc r6
+        jsr L176
+        sub *r1, L52
+        jsr L54
+L160:        mov r3, r6
+        cmp r6, r3
+        add r5, L184
+        cmp #-75, L103
+        sub #-89, r7
+        jmp L167
+        add *r1, L164
+L161:        mov *r5, r2
+        red r7
+        .data 983, 932, 605, -118
+        sub #-51, r0
+        add r2, *r7
+        red r4
+        mov r0, L188
+L162:        add L179, r7
+        red r6
+L163:        prn #31
+        clr L125
+        dec L58
+L164:        add #32, L185
+        dec L192
+        prn #-18
+        .data 21, 597, -280, -545
+        sub *r3, *r3
+        cmp r6, *r5
+L165:        red *r5
+        jsr L112
+        jsr L135
+        cmp *r0, #9
+        .string "zjofybwc"
+        red L177
+        cmp #-8, L172
+        jmp L170
+        clr *r3
+        clr L78
+        not *r6
+L166:        add #80, r4
+        add *r0, L188
+        prn r6
+        prn r5
+        sub L104, L190
+        mov *r7, *r4
+        cmp #-8, L49
+        cmp #-89, *r2
+        sub L133, r3
+        bne L8
+        mov #76, *r5
+L167:        jmp L69
+        jsr L144
+L168:        clr r0
+        bne L86
+        bne L190
+        sub r6, r0
+L169:        .string "rcsrepjdgosfou"
+        dec *r2
+        add L172, *r1
+        .string "bbztgazdmlq"
+        cmp #67, #-77
+        mov *r7, L112
+        prn #-9
+        red *r7
+        mov L96, L175
+        mov *r4, *r7
+        mov L191, r7
+        sub *r7, r5
+        add *r2, r2
+        jmp L174
+L170:        jmp L178
+        cmp r5, *r5
+        mov L178, L68
+        bne L149
+        inc L190
+        .data -756, -55, 11, 237
+        bne L177
+        dec r6
+        cmp L4, *r3
+        sub #-85, L55
+L171:        prn L70
+        inc *r5
+        mov L187, r7
+        add r4, L188
+        clr *r6
+        add L95, L171
+        cmp r2, r4
+L172:        add *r4, r5
+        dec L83
+        cmp *r6, L120
+        red L154
+        cmp L193, #19
+L173:        prn r4
+L174:        jmp L96
+L175:        bne L108
+L176:        clr *r4
+        inc r2
+        jsr L29
+L177:        add L74, *r4
+        prn #82
+        jsr L180
+        .data 982, -283, -509, 65
+        cmp L83, L179
+        not *r2
+L178:        red L32
+        jmp L45
+L179:        mov r1, r3
+        .data 882, 116, 566, -929
+        cmp r4, #81
+        jsr L24
+        sub #12, *r1
+        sub L143, L186
+        red L182
+        sub r7, L189
+        red r1
+L180:        sub #-40, L187
+        prn r7
+        sub r0, L30
+        .data -543, 382, 364, 725
+        sub *r3, r6
+        jsr L16
+        mov L186, r2
+        bne L18
+        add *r7, L94
+        .data 70, -300, 290, 13
+        clr *r1
+        sub L103, L85
+L181:        cmp *r1, *r5
+        jsr L5
+        prn #90
+L182:        .data 971, 527, 329, 342
+        .string "cuibdwhocclecbhke"
+        sub r0, L186
+        not L187
+        add *r3, L186
+        inc r0
+L183:        inc L188
+        cmp r5, L73
+        sub #44, L161
+        jmp L189
+L184:        sub #41, r7
+        sub r3, *r3
+        sub #-19, r3
+        .data -768, -803, -377, -790
+        bne L140
+        sub r5, L189
+        prn #-92
+        sub L193, r5
+L185:        jsr L186
+        add L189, L86
+L186:        sub r3, L1
+        inc r5
+        not r6
+        clr *r0
+L187:        cmp #2, *r3
+        add r6, *r2
+        mov #-81, r0
+        jsr L118
+        bne L192
+L188:        cmp L193, r1
+        clr *r6
+        not r7
+        jsr L59
+        jsr L192
+L189:        sub L190, L193
+        dec L193
+        cmp r5, *r7
+        mov *r6, L192
+        .data -538, -48, -178, 237
+        cmp L66, #-39
+L190:        not L193
+        sub r3, L191
+        cmp L192, r5
+L191:        .string "ozgyxhsduvypx"
+        cmp L193, *r6
+L192:        sub r7, *r7
+L193:        cmp *r7, *r4
+        inc *r4
+        inc r5
+        .string "qnvplqbchd"
+        .data -384, -867, 452, 198
+        stop
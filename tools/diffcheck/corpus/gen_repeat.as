@@ -0,0 +1,1001 @@
+; generated program, seed 16
+        cmp *r1, r4
+        .data -256, -693, -854, -626
+        sub r7, *r4
+        cmp *r4, r1
+        clr r7
+        add #-97, r4
+        add r5, r6
+        add #-24, r3
+        inc *r7
+        mov *r2, *r6
+        dec r4
+        sub r3, r5
+        inc *r4
+        not r0
+        red r2
+        clr r5
+        cmp *r7, r5
+        sub r4, *r1
+        clr r7
+        not r2
+        cmp *r4, r4
+        clr *r5
+        cmp r1, r0
+        cmp *r5, *r4
+        mov r1, r7
+        add *r0, r3
+        not *r1
+        sub #24, *r2
+        sub r6, *r7
+        sub r4, r1
+        cmp r3, r5
+        cmp r6, r4
+        not *r0
+        clr r4
+        mov *r6, r5
+        add #-45, r5
+        .data -594, -623, 143, 386
+        add r2, *r7
+        dec r0
+        mov r1, *r4
+        not *r6
+        red *r7
+        sub r5, *r4
+        dec r0
+        .data 301, 276, 369, -822
+        inc *r3
+        dec r3
+        not r2
+        inc *r4
+        sub *r0, r1
+        cmp *r3, *r7
+        dec r4
+        sub r0, r2
+        .string "xocrjfrcev"
+        add r1, r5
+        cmp *r6, r5
+        mov #35, r0
+        .data 231, -769, 962, 788
+        add r7, r0
+        sub *r2, *r4
+        prn r2
+        add r4, r1
+        sub *r3, r3
+        mov #-88, r5
+        add #64, r3
+        cmp #16, r4
+        inc *r1
+        .string "yzutrqeunfu"
+        .data -569, 330, 938, 954
+        mov r7, r2
+        dec r4
+        red *r2
+        inc r6
+        add *r5, r5
+        clr r7
+        dec *r4
+        inc r4
+        not *r6
+        mov #-89, r3
+        .data 56, -636, 715, 60
+        .data 218, 586, -427, 929
+        clr r0
+        sub *r3, r4
+        mov *r4, *r2
+        cmp r2, r7
+        dec r6
+        inc r2
+        add r0, r6
+        red r2
+        mov r1, *r6
+        red *r4
+        prn *r0
+        sub #-3, r0
+        add *r6, r0
+        sub r7, *r1
+        sub *r7, *r2
+        clr r6
+        prn *r0
+        not r3
+        dec *r3
+        prn r4
+        mov #-92, *r5
+        dec r7
+        .data 89, 100, -257, 492
+        mov *r3, r3
+        add #-35, *r4
+        inc r2
+        not r2
+        cmp r3, *r4
+        clr *r0
+        prn #-94
+        mov #95, r1
+        add *r0, *r1
+        prn r7
+        clr r4
+        inc r0
+        not r3
+        add r1, r2
+        mov r4, *r2
+        add #-35, *r4
+        mov r7, r0
+        mov *r2, r4
+        mov r1, *r6
+        dec *r1
+        inc *r4
+        dec r1
+        add r2, r3
+        dec *r6
+        clr *r4
+        prn *r5
+        prn r3
+        not r3
+        cmp #-63, #61
+        prn *r4
+        sub *r1, *r1
+        add #-69, r2
+        .data -225, 90, 808, 581
+        .data -91, -403, -919, -761
+        .data -473, -821, 475, 258
+        inc r5
+        add r4, *r0
+        add *r2, r5
+        inc r7
+        cmp *r2, #-64
+        cmp r5, #-53
+        mov r2, r7
+        cmp r1, r4
+        clr *r0
+        .string "zkqodpskxefyahuk"
+        mov *r6, r5
+        red r6
+        sub r0, r0
+        cmp r6, #-18
+        .data 414, -888, -111, 258
+        prn #-81
+        cmp r0, r6
+        inc r4
+        dec *r5
+        cmp #89, #-63
+        clr r5
+        add #-85, *r7
+        add *r6, r3
+        inc r2
+        sub r4, r7
+        .data 977, 53, -902, -128
+        sub *r2, r4
+        mov #-56, r4
+        add r4, r1
+        sub #-85, *r3
+        prn r1
+        mov #-42, r7
+        cmp r1, #-71
+        add r7, r1
+        add #63, r6
+        not *r6
+        not r3
+        red r6
+        mov r6, r4
+        red r1
+        clr r6
+        cmp r4, *r2
+        add r2, *r1
+        clr r0
+        cmp r1, #30
+        add r2, r1
+        prn r3
+        .string "kuqvooppyown"
+        dec r0
+        .data -69, 534, 979, -650
+        sub #-68, *r2
+        dec r4
+        red r7
+        prn r7
+        red r5
+        .data -299, -122, 584, -727
+        mov *r4, *r4
+        dec r3
+        prn *r3
+        cmp r3, r5
+        red r3
+        red r0
+        inc r4
+        not r7
+        prn r3
+        add r7, *r3
+        red r7
+        .data 34, 137, -73, 152
+        prn r4
+        not r3
+        mov r2, *r5
+        not r3
+        cmp #-74, r6
+        prn r4
+        sub r0, r1
+        dec *r0
+        add r3, r5
+        sub r6, r7
+        mov r7, r5
+        dec *r6
+        inc *r2
+        sub #-33, *r5
+        add *r2, *r6
+        dec *r0
+        clr r3
+        cmp r0, r0
+        sub *r3, *r7
+        add *r2, r0
+        sub r5, r7
+        mov r2, r5
+        prn #67
+        not *r3
+        add *r2, r7
+        sub *r6, r3
+        prn r6
+        add *r5, r2
+        .string "butqvduhw"
+        prn *r1
+        sub r5, r2
+        clr r6
+        inc r1
+        cmp r3, r6
+        red *r7
+        dec *r1
+        add r1, r4
+        not r6
+        sub r5, r7
+        not *r3
+        dec r3
+        not *r6
+        inc r6
+        sub r4, r7
+        add r0, r6
+        sub r7, *r4
+        not *r5
+        add #45, *r2
+        add r1, *r7
+        mov r1, *r7
+        not r4
+        sub r5, r0
+        dec r3
+        prn *r7
+        mov r6, r0
+        sub *r6, r1
+        clr *r4
+        sub r0, r5
+        .data -902, 372, -48, 13
+        inc *r7
+        .data -647, -271, -326, -350
+        not r4
+        cmp #37, r1
+        clr *r2
+        not r1
+        prn r4
+        inc r7
+        cmp r6, *r1
+        .data 335, 318, -105, 712
+        sub #94, r0
+        cmp *r6, *r2
+        inc r3
+        add r6, r2
+        .data -731, -728, 796, -562
+        not r4
+        prn #27
+        mov #13, r2
+        not r0
+        prn #-27
+        .data -283, 130, -214, -232
+        mov *r1, *r2
+        .data 364, 680, 181, -597
+        inc *r1
+        mov *r2, *r0
+        clr r0
+        mov r4, *r1
+        not r0
+        dec *r3
+        not *r1
+        inc *r5
+        mov *r6, r5
+        cmp #21, #36
+        dec *r3
+        inc r4
+        dec r6
+        add r0, *r7
+        .data -315, 683, 134, 293
+        not r6
+        inc r7
+        dec *r4
+        prn *r0
+        inc r7
+        dec r1
+        .data 652, 190, 485, -849
+        red r5
+        inc *r6
+        add #81, r4
+        not r4
+        mov *r2, *r6
+        .data -118, 921, -444, -493
+        add *r3, r1
+        cmp r4, *r0
+        not *r3
+        not r5
+        add r0, r0
+        prn #77
+        not r7
+        clr *r1
+        cmp *r4, #16
+        cmp *r7, #-57
+        not r1
+        dec *r6
+        sub *r4, r3
+        .data 650, -923, -971, -135
+        not r5
+        prn r2
+        cmp r0, r6
+        prn r5
+        mov r5, r4
+        add r6, r6
+        cmp r3, #-19
+        add #-64, r2
+        .data 603, 843, -543, 65
+        cmp r3, r0
+        dec *r0
+        red r1
+        not r1
+        cmp r5, *r6
+        red r1
+        cmp r7, *r5
+        inc *r5
+        mov r7, *r6
+        add r0, r3
+        red *r1
+        .data 348, -416, -430, -418
+        .string "bicojfonlywvje"
+        prn #-54
+        not r6
+        red r1
+        sub r7, r0
+        sub *r7, r2
+        prn #-89
+        cmp #-52, #-28
+        prn r1
+        inc r7
+        red *r7
+        add r1, r2
+        add r6, *r6
+        clr r0
+        mov r4, *r3
+        prn *r6
+        mov *r5, *r4
+        .data -478, -359, -921, -472
+        not *r2
+        sub *r7, r0
+        .string "uvepcikwhtvphtlbk"
+        add r7, r4
+        mov r0, r1
+        not r7
+        .string "kwuuygkn"
+        not *r1
+        sub *r0, *r7
+        cmp r7, r7
+        sub r5, r7
+        .data 278, -44, -25, 717
+        cmp r0, *r7
+        red r7
+        prn #43
+        cmp r4, r0
+        red r6
+        mov #46, r3
+        red *r5
+        clr r2
+        add r4, r6
+        cmp r2, r3
+        prn r0
+        .data 672, 838, -316, 272
+        cmp r0, *r6
+        red r6
+        red r2
+        cmp #95, *r2
+        add *r3, r3
+        cmp r1, *r1
+        red r3
+        sub r3, r0
+        dec *r0
+        mov #20, r2
+        cmp *r5, r5
+        mov r6, *r3
+        cmp *r4, *r3
+        inc r3
+        cmp r7, r3
+        cmp r5, *r1
+        mov r1, r4
+        cmp r3, #8
+        red *r2
+        dec r3
+        clr *r3
+        cmp *r2, r1
+        inc r3
+        mov r3, r0
+        sub r0, r7
+        .string "fpwinbuertghvf"
+        mov *r6, *r7
+        mov r3, r5
+        mov r6, r3
+        cmp r6, r7
+        dec r5
+        inc r0
+        dec r5
+        not r5
+        sub *r4, r7
+        prn #-66
+        clr r3
+        add *r0, *r5
+        cmp #68, #96
+        .data 746, 91, 876, 968
+        sub #-57, r3
+        not *r7
+        not *r5
+        sub r7, r7
+        add r5, r7
+        not r5
+        mov r6, *r1
+        red *r4
+        add r4, *r0
+        clr *r7
+        add *r4, *r1
+        not r7
+        cmp r7, *r3
+        cmp #-87, r4
+        inc r5
+        sub r6, r6
+        inc r1
+        .data 813, 282, -703, 242
+        mov r5, r1
+        inc *r4
+        not *r6
+        sub #-52, r5
+        .data -567, 891, 414, 281
+        not *r0
+        sub r4, r4
+        sub r7, r6
+        mov r4, r5
+        dec r4
+        mov #99, r7
+        cmp r5, r1
+        .data 794, -547, -234, 595
+        inc r7
+        clr r4
+        clr r4
+        not r2
+        prn *r6
+        clr r3
+        .string "awkfqaousz"
+        inc *r0
+        prn #-39
+        inc r4
+        cmp *r7, #16
+        cmp r6, r3
+        prn r0
+        add r5, *r3
+        not r3
+        sub r7, *r0
+        .data -723, 554, 526, 576
+        .data 0, 919, -561, 750
+        .data 136, -968, -30, 106
+        red r1
+        .data 802, 83, -628, 0
+        cmp #38, #21
+        sub r1, r5
+        prn *r5
+        mov *r3, r1
+        not r5
+        mov r0, *r6
+        clr r4
+        add r7, r3
+        add r5, *r4
+        .data -688, 968, -911, 254
+        .string "acwyhojmkplupepg"
+        red r7
+        add #91, *r2
+        cmp r2, *r7
+        clr r3
+        red r4
+        red *r7
+        inc r7
+        prn r0
+        dec r0
+        not *r4
+        not r5
+        sub r0, r5
+        prn r6
+        dec r0
+        add *r4, *r3
+        mov r2, *r0
+        prn #93
+        cmp r4, r7
+        sub *r1, r3
+        mov r2, r7
+        .data 553, -997, -612, -545
+        mov #-92, r6
+        add r6, *r0
+        red *r4
+        cmp #3, r7
+        clr r4
+        add #-45, r5
+        prn #85
+        clr *r1
+        mov #31, r5
+        .data 416, 941, -787, 96
+        clr *r1
+        .data 759, -933, 970, -414
+        prn *r7
+        red r2
+        red *r2
+        add #-66, r2
+        add r4, *r7
+        .data -791, 798, -373, -830
+        prn r0
+        red r0
+        not *r1
+        sub r5, r0
+        .string "nasjuoeutzxw"
+        add r0, r5
+        cmp #94, #62
+        mov r6, *r3
+        mov r4, r7
+        cmp r7, r2
+        clr r6
+        cmp *r3, #32
+        mov *r3, *r3
+        inc r4
+        cmp r7, *r2
+        dec r3
+        mov r6, r1
+        prn r5
+        mov r7, r0
+        cmp #86, r7
+        sub r2, r7
+        red r6
+        cmp r4, r6
+        clr r3
+        cmp #-81, #70
+        not *r2
+        red r1
+        clr r4
+        add r6, *r4
+        add #30, r0
+        clr r3
+        mov r2, r0
+        cmp #84, r0
+        not r3
+        cmp r5, r5
+        mov #-23, r1
+        cmp r7, *r1
+        mov *r1, *r3
+        red r4
+        .data -679, -653, 413, -700
+        .data 733, -650, 766, -626
+        .string "inuhzptrn"
+        .data 930, 600, 77, 495
+        sub r2, r1
+        .data -966, -878, -553, 133
+        mov r2, *r4
+        cmp *r4, r7
+        inc r0
+        not *r5
+        inc *r3
+        red r0
+        dec *r6
+        not r2
+        mov r0, r2
+        inc *r7
+        .data 216, 710, -885, -678
+        add r6, r0
+        prn r4
+        prn *r2
+        clr r4
+        .data 529, 744, -720, -823
+        not r7
+        cmp r2, #95
+        sub #13, r4
+        not *r3
+        prn r1
+        .data -872, -368, 601, 25
+        mov r1, r7
+        cmp r0, #49
+        add r3, *r0
+        not r6
+        cmp #-28, #-69
+        mov r0, *r5
+        prn r7
+        sub r5, *r2
+        dec r0
+        add r6, *r4
+        .string "utjculrwomiauvgq"
+        prn *r7
+        sub #-16, r3
+        add #80, r2
+        red r4
+        cmp #-97, #32
+        red r1
+        mov r2, r4
+        add r3, r6
+        not *r1
+        sub *r5, *r3
+        add #-47, *r6
+        add r3, r6
+        not r0
+        not r1
+        dec *r7
+        .string "oiwrnohvpelix"
+        mov #-4, *r4
+        .data -50, 541, -313, 729
+        red *r4
+        cmp r7, #-41
+        mov r2, r7
+        sub #-68, r7
+        sub r3, r6
+        sub #-87, *r7
+        sub #-48, r7
+        not r0
+        add #-22, r0
+        prn #-10
+        red *r7
+        cmp r0, r0
+        sub #37, *r2
+        cmp *r6, #-15
+        cmp *r7, r4
+        sub #-80, *r2
+        prn r5
+        .data -873, -349, -214, -258
+        cmp #87, #-76
+        dec r7
+        dec *r2
+        mov r7, *r1
+        red r4
+        dec *r7
+        mov r5, *r4
+        prn *r0
+        sub r2, *r2
+        mov *r0, r3
+        mov #-96, r2
+        not r4
+        prn #-4
+        clr r2
+        sub r2, *r3
+        sub *r0, *r4
+        red *r7
+        sub r6, *r7
+        not r7
+        add r4, r1
+        not r1
+        inc r4
+        sub *r6, *r7
+        not r7
+        dec *r3
+        cmp #70, r7
+        sub r4, *r1
+        add #-57, r3
+        add #42, r7
+        mov r2, r6
+        dec r2
+        prn r0
+        sub #72, r1
+        cmp *r3, r2
+        add #65, *r4
+        add r2, *r5
+        add *r1, r4
+        add #36, *r4
+        mov #-77, r3
+        cmp *r5, #97
+        .string "mryfpfukkyofwmnj"
+        sub *r3, r4
+        add r2, r2
+        .data 665, -10, -262, 993
+        dec *r3
+        cmp *r0, r3
+        inc *r4
+        mov r7, r0
+        inc *r1
+        cmp #-48, r7
+        sub #-3, *r6
+        inc r3
+        .string "ulujwuiyslknaqrn"
+        .string "keolrirkcip"
+        clr r2
+        .string "zlrkvnizzy"
+        not r2
+        add #62, *r5
+        clr r2
+        sub r7, *r2
+        cmp #68, r4
+        .string "prltadhrbpixo"
+        add r3, *r6
+        add r7, r6
+        clr *r6
+        not r6
+        red *r0
+        mov r1, *r4
+        dec r5
+        .string "wrdrjhjqagx"
+        sub r7, r3
+        clr *r2
+        dec *r4
+        red *r1
+        add *r0, r2
+        add *r0, *r7
+        dec r2
+        sub #-49, *r3
+        cmp r0, #-95
+        add r1, r6
+        .data -53, -179, 701, -661
+        sub #-19, r0
+        dec r1
+        .data 736, -921, 641, 226
+        clr r3
+        add #57, *r0
+        .string "nalcxpudrliszh"
+        mov r2, *r1
+        sub *r0, r6
+        inc *r5
+        add r4, *r3
+        prn r3
+        sub r4, r0
+        .string "wyaybeurxmqhonj"
+        .data 416, -445, 227, 914
+        mov r6, r4
+        red *r1
+        not r4
+        red r0
+        dec r6
+        dec r2
+        sub r0, r5
+        add r6, r2
+        cmp #-80, #-28
+        cmp r4, *r6
+        mov r3, *r4
+        red r7
+        clr r5
+        not r4
+        clr r4
+        red r0
+        cmp r5, #-22
+        inc *r3
+        mov *r1, r0
+        red *r7
+        clr r3
+        cmp r3, #29
+        cmp r4, *r7
+        add r7, *r5
+        prn r3
+        cmp #-15, r2
+        prn *r7
+        mov #79, r0
+        prn r5
+        inc *r0
+        mov #-93, *r2
+        add #64, *r4
+        .string "hxsjpmkxc"
+        mov #-32, r2
+        dec r0
+        red r5
+        .data 106, 497, 947, 619
+        add r6, r5
+        add r5, *r2
+        not *r7
+        mov *r1, r6
+        add *r1, *r5
+        mov r6, r5
+        clr *r5
+        sub r1, r0
+        cmp r3, *r2
+        .data 247, 219, -330, 271
+        sub #80, r1
+        add #-46, r2
+        add #-61, r0
+        add #44, *r0
+        .data -524, 600, -123, 262
+        dec *r7
+        cmp #93, r7
+        add r3, r5
+        red r3
+        cmp #-21, *r0
+        red r0
+        sub *r1, *r3
+        .data 458, -455, -436, 731
+        red r2
+        cmp *r1, *r6
+        cmp *r6, #-53
+        red r6
+        dec r0
+        inc r6
+        inc r1
+        sub r4, r1
+        .data -969, -660, -743, -986
+        sub *r1, *r5
+        prn *r6
+        prn r1
+        cmp r0, r6
+        inc *r4
+        add r4, r2
+        sub #-98, r7
+        dec r4
+        inc r7
+        add r4, r7
+        sub r4, r6
+        dec *r2
+        .data -519, 307, 442, 18
+        inc r6
+        .data -587, 367, 906, 707
+        sub #-41, r1
+        red r0
+        cmp r7, *r0
+        cmp *r0, r7
+        .data -944, -87, -268, 649
+        sub r7, r6
+        red r4
+        mov r0, r0
+        inc *r1
+        red r1
+        .string "kibyitgdxhqna"
+        prn r7
+        add r0, *r3
+        prn r3
+        mov #-68, r4
+        sub r5, r1
+        cmp #-71, r4
+        .data 722, -161, -598, -502
+        mov *r1, *r2
+        sub r0, r0
+        red *r5
+        .string "zppmbusrtgajomb"
+        inc r3
+        cmp #-24, #66
+        .data 879, -550, 663, 421
+        prn #38
+        .string "hanrwuduczfi"
+        inc r7
+        mov *r6, *r4
+        cmp *r4, r2
+        cmp *r2, r1
+        add #-13, r2
+        sub r7, r0
+        sub *r7, r2
+        dec r7
+        sub r5, *r0
+        prn r5
+        inc r7
+        add r6, r5
+        dec *r3
+        sub r3, r3
+        sub *r5, r7
+        dec r6
+        mov #-22, r3
+        mov r3, r1
+        sub r5, r4
+        sub #50, r4
+        red r1
+        add r5, *r5
+        clr r1
+        .data -491, -446, -413, -277
+        mov r2, r5
+        red *r6
+        red *r7
+        add r4, *r3
+        .string "mzitbearelinvyl"
+        .string "zoibpfwskuzigxj"
+        mov #24, r1
+        not r3
+        .data -361, -731, -384, 693
+        add #85, *r3
+        mov r3, r0
+        cmp r5, #-62
+        .data 910, 245, 127, -263
+        add #-80, *r6
+        add *r7, r6
+        mov r6, r2
+        add r7, r6
+        .data 537, -524, -246, 35
+        clr r2
+        inc r1
+        cmp #58, r2
+        cmp r0, *r5
+        not r2
+        prn r2
+        red r6
+        dec *r5
+        prn r3
+        not r2
+        add r7, r2
+        add r6, r1
+        sub r3, r4
+        mov r0, r2
+        .data 850, -505, -913, -282
+        add #69, r3
+        prn *r2
+        sub r0, *r0
+        cmp #-19, #62
+        mov r6, *r2
+        clr *r4
+        cmp r2, *r0
+        add r5, r0
+        sub r2, *r0
+        .data -375, -98, -160, 227
+        dec r4
+        .string "blfvzkwwoifi"
+        dec r5
+        sub #36, r3
+        cmp *r3, #-10
+        mov r0, r5
+        not r5
+        sub r5, r5
+        sub *r6, *r6
+        add #68, r5
+        .data 12, 115, -565, -124
+        prn r2
+        mov *r5, r5
+        add r6, *r4
+        not *r0
+        mov *r5, r7
+        red *r6
+        prn r5
+        cmp r4, r6
+        .string "oalccpqbrde"
+        .string "vgqkquwoe"
+        not *r6
+        prn r7
+        mov r7, r1
+        dec r4
+        add #-66, *r7
+        sub r1, *r2
+        sub r0, r3
+        red r1
+        cmp *r1, r3
+        inc r5
+        prn r6
+        add r2, r5
+        .data -647, 393, 126, 817
+        not r6
+        red r2
+        mov r4, r2
+        prn *r1
+        clr r5
+        add #-54, r2
+        cmp #-27, r0
+        .string "sgspytoyra"
+        clr *r2
+        not r5
+        cmp r5, #-76
+        add r4, r6
+        add *r0, r3
+        not r5
+        dec *r7
+        .string "pxfycavetex"
+        .data 363, -225, 889, 110
+        prn #-51
+        mov #-4, *r0
+        cmp r6, r6
+        red r1
+        not r2
+        inc r7
+        cmp #12, r1
+        .data 720, 469, 952, -926
+        sub #-35, r5
+        not r5
+        red r1
+        cmp r4, *r2
+        add r4, r0
+        red *r2
+        add r7, *r7
+        clr r0
+        prn r0
+        clr r7
+        clr r1
+        prn #-97
+        mov *r7, r4
+        cmp r0, r7
+        sub *r4, r1
+        red r4
+        clr r4
+        stop
@@ -0,0 +1,8 @@
+.extern PUTC
+.extern GETC
+MAIN:   jsr GETC
+        mov r1, PUTC
+        jsr PUTC
+        jsr GETC
+        lea PUTC, r3
+        stop
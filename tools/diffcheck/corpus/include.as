@@ -0,0 +1,5 @@
+.include "lib_common.mlib"
+MAIN:   mov #3, r2
+        twice r2
+        show r2
+        stop
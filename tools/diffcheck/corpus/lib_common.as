@@ -0,0 +1,7 @@
+macr twice reg
+        inc reg
+        inc reg
+endmacr
+macr show reg
+        prn reg
+endmacr
@@ -0,0 +1,22 @@
+macr swap a, b
+        mov a, r7
+        mov b, a
+        mov r7, b
+endmacr
+macr bump reg, amount
+        add #amount, reg
+        prn reg
+endmacr
+macr both x, y
+        swap x, y
+        bump x, 3
+        bump y, 4
+endmacr
+MAIN:   mov #1, r1
+        mov #2, r2
+        swap r1, r2
+        both r3, r4
+        bump r5, 9
+        both COUNT, r6
+        stop
+COUNT:  .data 10
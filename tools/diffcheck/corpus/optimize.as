@@ -0,0 +1,15 @@
+MAIN:   mov #0, r1
+        add #1, r2
+        sub #1, r3
+        add #-1, r4
+        mov r5, r5
+        jmp NEXT
+NEXT:   bne LOOP
+LOOP:   mov #0, COUNT
+        sub #1, COUNT
+        prn r1
+        mov #0, r6
+        bne LOOP
+        mov #0, r7
+        stop
+COUNT:  .data 3
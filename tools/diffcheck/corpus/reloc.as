@@ -0,0 +1,8 @@
+.extern LIB
+.entry MAIN
+MAIN:   lea DATA, r1
+        jsr LIB
+        jmp END
+        mov DATA, r2
+END:    stop
+DATA:   .data 5, 6
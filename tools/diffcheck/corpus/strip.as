@@ -0,0 +1,12 @@
+.extern OUTSIDE
+.entry MAIN
+MAIN:   jsr WORK
+        lea TEXT, r2
+        stop
+UNUSED: mov r1, r2
+        jsr OUTSIDE
+        rts
+WORK:   inc r1
+        rts
+SPARE:  .data 1, 2, 3
+TEXT:   .string "ok"
@@ -0,0 +1,6 @@
+MAIN:   mov r1, r2
+        stop
+DEAD:   mov r1,
+        blah r3
+        jmp NOWHERE
+DEAD:   inc r4
@@ -0,0 +1,500 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "definitions.h"
+#include "hashtable.h"
+#include "isa.h"
+
+/* Turns an object file back into assembly, names come from .ent and .ext */
+
+#define DATA_PER_LINE (10) /* Values in one .data line */
+#define WORD_SIGN_BIT (0x4000) /* Sign bit of a data word */
+
+/* Structure for a read only view of an input file */
+struct MappedFile
+{
+    char *data; /* Mapped contents, NULL if the file is missing or empty */
+    size_t length; /* Bytes mapped */
+};
+
+/* Structure for a symbol name inside a mapped file */
+struct Name
+{
+    const char *text; /* First character, NULL for no name */
+    int length; /* Length of the name */
+};
+
+static int *words; /* Words in address order */
+static int total_words; /* Number of words */
+static int first_address; /* Address of words[0] */
+static int code_lines; /* Code words from the header */
+static int data_lines; /* Data words from the header */
+static struct Name *labels; /* Exported name of each word */
+static struct Name *externals; /* External symbol used by each word */
+static char *targets; /* TRUE for words named by a label operand */
+static char *sizes; /* Instruction size at its first word, zero for data, -1 inside */
+static int show_addresses; /* Prefix lines with addresses, output no longer assembles */
+
+static void map_file(
+    struct MappedFile *file,
+    const char *name,
+    const char *extension
+)
+{
+    char path[MAX_PATH_LEN];
+    int descriptor;
+    struct stat info;
+
+    file->data = NULL;
+    file->length = 0;
+
+    sprintf(path, "%s%s", name, extension);
+    descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+    {
+        return;
+    }
+
+    if (fstat(descriptor, &info) == 0 && info.st_size > 0)
+    {
+        file->data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (file->data == MAP_FAILED)
+        {
+            file->data = NULL;
+        }
+        else
+        {
+            file->length = info.st_size;
+        }
+    }
+    close(descriptor);
+}
+
+static void unmap_file(struct MappedFile *file)
+{
+    if (file->data != NULL)
+    {
+        munmap(file->data, file->length);
+    }
+}
+
+/* Read a number at a position, FALSE if there is none */
+static int read_number(
+    const char **at,
+    const char *end,
+    int radix,
+    int *value
+)
+{
+    int digits;
+
+    while (*at < end && (**at == ' ' || **at == '\n' || **at == '\r' || **at == '\t'))
+    {
+        (*at)++;
+    }
+
+    *value = 0;
+    for (digits = 0; *at < end && **at >= '0' && **at < '0' + radix; digits++)
+    {
+        *value = *value * radix + (**at - '0');
+        (*at)++;
+    }
+    return digits > 0;
+}
+
+static int read_name(
+    const char **at,
+    const char *end,
+    struct Name *name
+)
+{
+    while (*at < end && (**at == ' ' || **at == '\n' || **at == '\r' || **at == '\t'))
+    {
+        (*at)++;
+    }
+
+    name->text = *at;
+    while (*at < end && **at != ' ' && **at != '\n' && **at != '\r' && **at != '\t')
+    {
+        (*at)++;
+    }
+    name->length = *at - name->text;
+    return name->length > 0;
+}
+
+static int load_words(const struct MappedFile *file)
+{
+    const char *at;
+    const char *end;
+    int address;
+    int value;
+    int limit;
+
+    at = file->data;
+    end = file->data + file->length;
+    if (!read_number(&at, end, 10, &code_lines) || !read_number(&at, end, 10, &data_lines))
+    {
+        return FALSE;
+    }
+
+    limit = code_lines + data_lines + 1;
+    words = malloc(sizeof(*words) * limit);
+    while (read_number(&at, end, 10, &address) && read_number(&at, end, 8, &value))
+    {
+        if (total_words == 0)
+        {
+            first_address = address;
+        }
+        if (address != first_address + total_words)
+        {
+            return FALSE; /* Words must be contiguous */
+        }
+        if (total_words == limit)
+        {
+            limit *= 2; /* Increase limit */
+            words = realloc(words, sizeof(*words) * limit);
+        }
+        words[total_words] = value & ISA_WORD_MASK;
+        total_words++;
+    }
+
+    return TRUE;
+}
+
+/* Attach names of .ent lines to words and of .ext lines to the words that use them */
+static void load_names(
+    const struct MappedFile *file,
+    struct Name *names
+)
+{
+    const char *at;
+    const char *end;
+    struct Name name;
+    int address;
+
+    at = file->data;
+    end = file->data + file->length;
+    while (read_name(&at, end, &name))
+    {
+        while (at < end && *at == ' ' && read_number(&at, end, 10, &address))
+        {
+            if (address >= first_address && address < first_address + total_words)
+            {
+                names[address - first_address] = name;
+            }
+        }
+    }
+}
+
+/* Check a label operand, -1 if it cannot come from the assembler */
+static int operand_target(
+    int group,
+    int value,
+    int flags,
+    int word
+)
+{
+    if (group != DIR_GROUP_OPERAND)
+    {
+        return 0;
+    }
+    if (flags == EXTERNAL_FLAG)
+    {
+        return externals[word].text != NULL ? 0 : -1;
+    }
+    if (value < first_address || value >= first_address + total_words)
+    {
+        return -1;
+    }
+    return value - first_address;
+}
+
+static int is_barrier(int word)
+{
+    return labels[word].text != NULL || targets[word];
+}
+
+/* Split the words into instructions and data, labels never fall inside an instruction */
+static void classify_words(void)
+{
+    struct DecodedInstruction decoded;
+    int word;
+    int item;
+    int source;
+    int target;
+    int changed;
+
+    do
+    {
+        changed = FALSE;
+        memset(sizes, 0, total_words);
+        for (word = 0; word < total_words;)
+        {
+            if (!isa_decode(&words[word], total_words - word, &decoded))
+            {
+                word++;
+                continue;
+            }
+
+            source = operand_target(decoded.source_group, decoded.source, decoded.source_flags, word + 1);
+            target = operand_target(decoded.target_group, decoded.target, decoded.target_flags, word + decoded.size - 1);
+            for (item = 1; item < decoded.size && source >= 0 && target >= 0; item++)
+            {
+                if (is_barrier(word + item))
+                {
+                    source = -1; /* A label points into it, so these words are data */
+                }
+            }
+            if (source < 0 || target < 0)
+            {
+                word++;
+                continue;
+            }
+
+            if (decoded.source_group == DIR_GROUP_OPERAND && decoded.source_flags == RELOCATABLE_FLAG)
+            {
+                targets[source] = TRUE;
+            }
+            if (decoded.target_group == DIR_GROUP_OPERAND && decoded.target_flags == RELOCATABLE_FLAG)
+            {
+                targets[target] = TRUE;
+            }
+
+            sizes[word] = decoded.size;
+            for (item = 1; item < decoded.size; item++)
+            {
+                sizes[word + item] = -1;
+            }
+            word += decoded.size;
+        }
+
+        /* A label found late may split an instruction decoded earlier */
+        for (word = 0; word < total_words; word++)
+        {
+            if (sizes[word] < 0 && is_barrier(word))
+            {
+                changed = TRUE;
+            }
+        }
+    } while (changed);
+}
+
+static int print_label(
+    FILE *output,
+    int word
+)
+{
+    if (labels[word].text != NULL)
+    {
+        return fprintf(output, "%.*s", labels[word].length, labels[word].text);
+    }
+    return fprintf(output, "A%04d", first_address + word); /* Label made up for an unnamed target */
+}
+
+static void print_operand(
+    FILE *output,
+    int group,
+    int value,
+    int flags,
+    int word
+)
+{
+    switch (group)
+    {
+    case IMMEDIATE_GROUP_OPERAND:
+    {
+        fprintf(output, "#%d", value);
+        break;
+    }
+    case DIR_GROUP_OPERAND:
+    {
+        if (flags == EXTERNAL_FLAG)
+        {
+            fprintf(output, "%.*s", externals[word].length, externals[word].text);
+        }
+        else
+        {
+            print_label(output, value - first_address);
+        }
+        break;
+    }
+    case INDIR_GROUP_OPERAND:
+    {
+        fprintf(output, "*r%d", value);
+        break;
+    }
+    default:
+    {
+        fprintf(output, "r%d", value);
+        break;
+    }
+    }
+}
+
+static void print_line_start(
+    FILE *output,
+    int word
+)
+{
+    int width;
+
+    if (show_addresses)
+    {
+        fprintf(output, "%04d  ", first_address + word);
+    }
+    /* Statements line up after labels of up to seven characters */
+    width = 0;
+    if (is_barrier(word))
+    {
+        width = print_label(output, word);
+        fputc(':', output);
+        width++;
+    }
+    do
+    {
+        fputc(' ', output);
+        width++;
+    } while (width < 8);
+}
+
+static void print_program(
+    FILE *output,
+    const char *name
+)
+{
+    struct DecodedInstruction decoded;
+    struct HashTable printed;
+    char key[TOTAL_LEN];
+    int word;
+    int count;
+
+    fprintf(output, "; disassembled from %s.ob, %d code and %d data words\n", name, code_lines, data_lines);
+
+    HashTable_init(&printed);
+    for (word = 0; word < total_words; word++)
+    {
+        if (externals[word].text != NULL && externals[word].length < TOTAL_LEN)
+        {
+            memcpy(key, externals[word].text, externals[word].length);
+            key[externals[word].length] = '\0';
+            if (HashTable_insert(&printed, key, word))
+            {
+                fprintf(output, ".extern %s\n", key);
+            }
+        }
+    }
+    HashTable_free(&printed);
+
+    for (word = 0; word < total_words; word++)
+    {
+        if (labels[word].text != NULL)
+        {
+            fprintf(output, ".entry %.*s\n", labels[word].length, labels[word].text);
+        }
+    }
+
+    for (word = 0; word < total_words;)
+    {
+        print_line_start(output, word);
+        if (sizes[word] > 0)
+        {
+            isa_decode(&words[word], total_words - word, &decoded);
+            fputs(valid_commands_sizes[decoded.opcode].name, output);
+            if (decoded.source_group != 0)
+            {
+                fputc(' ', output);
+                print_operand(output, decoded.source_group, decoded.source, decoded.source_flags, word + 1);
+                fputc(',', output);
+            }
+            if (decoded.target_group != 0)
+            {
+                fputc(' ', output);
+                print_operand(output, decoded.target_group, decoded.target, decoded.target_flags, word + decoded.size - 1);
+            }
+            fputc('\n', output);
+            word += decoded.size;
+            continue;
+        }
+
+        /* Data runs until the next label or instruction */
+        fputs(".data ", output);
+        count = 0;
+        do
+        {
+            fprintf(output, count > 0 ? ", %d" : "%d", (words[word] & WORD_SIGN_BIT) ? words[word] - (WORD_SIGN_BIT << 1) : words[word]);
+            word++;
+            count++;
+        } while (word < total_words && sizes[word] == 0 && !is_barrier(word) && count < DATA_PER_LINE);
+        fputc('\n', output);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    struct MappedFile object;
+    struct MappedFile entries;
+    struct MappedFile references;
+    const char *name;
+    int id;
+
+    name = NULL;
+    for (id = 1; id < argc; id++)
+    {
+        if (strcmp(argv[id], "--addresses") == 0)
+        {
+            show_addresses = TRUE;
+        }
+        else if (argv[id][0] != '-' && name == NULL && strlen(argv[id]) + 8 <= MAX_PATH_LEN)
+        {
+            name = argv[id];
+        }
+        else
+        {
+            name = NULL;
+            break;
+        }
+    }
+
+    if (name == NULL)
+    {
+        fprintf(stderr, "Usage: %s [--addresses] <file-name>\n", argv[0]);
+        return (-1);
+    }
+
+    map_file(&object, name, ".ob");
+    if (object.data == NULL || !load_words(&object))
+    {
+        fprintf(stderr, "Cannot read object file \"%s.ob\"\n", name);
+        unmap_file(&object);
+        free(words);
+        return (-1);
+    }
+
+    labels = calloc(total_words + 1, sizeof(*labels));
+    externals = calloc(total_words + 1, sizeof(*externals));
+    targets = calloc(total_words + 1, 1);
+    sizes = calloc(total_words + 1, 1);
+
+    map_file(&entries, name, ".ent");
+    map_file(&references, name, ".ext");
+    load_names(&entries, labels);
+    load_names(&references, externals);
+
+    classify_words();
+    print_program(stdout, name);
+
+    unmap_file(&object);
+    unmap_file(&entries);
+    unmap_file(&references);
+    free(words);
+    free(labels);
+    free(externals);
+    free(targets);
+    free(sizes);
+    return 0;
+}
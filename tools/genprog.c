@@ -0,0 +1,345 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+
+/* Generator of large valid assembly programs for benchmarking */
+
+struct shape
+{
+    long lines; /* Number of statements */
+    long label_density; /* Percent of statements with a label */
+    long forward_ratio; /* Percent of label operands that point forward */
+    long macros; /* Number of macros */
+    long macro_body; /* Statements in each macro body */
+    long macro_calls; /* Percent of statements that call a macro */
+    long data_ratio; /* Percent of statements that are .data or .string */
+    long data_width; /* Values in each .data line */
+    long externs; /* Number of external symbols */
+    long extern_ratio; /* Percent of label operands that are external */
+    long entry_ratio; /* Percent of labels exported with .entry */
+    long seed; /* Random seed */
+};
+
+static unsigned long random_state; /* State of the random generator */
+
+static int next_random(long range)
+{
+    random_state = random_state * 1103515245UL + 12345UL; /* Linear congruential step */
+    return (int)(((random_state >> 16) & 0x3FFFFFFFUL) % (unsigned long)range);
+}
+
+static int chance(long percent)
+{
+    return next_random(100) < percent;
+}
+
+static long *label_lines; /* Statement index of each label */
+static long total_labels; /* Number of labels */
+static long next_label; /* First label not yet defined */
+
+static void print_label_operand(const struct shape *shape)
+{
+    long label;
+
+    if (shape->externs > 0 && chance(shape->extern_ratio))
+    {
+        printf("X%d", next_random(shape->externs)); /* External symbol */
+        return;
+    }
+
+    /* Pick a label defined later or one already defined */
+    if ((chance(shape->forward_ratio) && next_label < total_labels) || next_label == 0)
+    {
+        label = next_label + next_random(total_labels - next_label);
+    }
+    else
+    {
+        label = next_random(next_label);
+    }
+    printf("L%ld", label);
+}
+
+static void print_operand(
+    const struct shape *shape, 
+    int allow_immediate
+)
+{
+    int kind;
+
+    kind = next_random(allow_immediate ? 4 : 3);
+    switch (kind)
+    {
+    case 0:
+    {
+        printf("r%d", next_random(8)); /* Register */
+        break;
+    }
+    case 1:
+    {
+        printf("*r%d", next_random(8)); /* Indirect register */
+        break;
+    }
+    case 2:
+    {
+        if (total_labels > 0)
+        {
+            print_label_operand(shape); /* Direct label */
+        }
+        else
+        {
+            printf("r%d", next_random(8));
+        }
+        break;
+    }
+    default:
+    {
+        printf("#%d", next_random(200) - 100); /* Immediate */
+        break;
+    }
+    }
+}
+
+static void print_instruction(
+    const struct shape *shape, 
+    int with_labels
+)
+{
+    static const char *two_operands[] = {"mov", "add", "sub", "cmp"};
+    static const char *one_operand[] = {"clr", "not", "inc", "dec", "red", "prn"};
+    static const char *jumps[] = {"jmp", "bne", "jsr"};
+    const char *name;
+    int kind;
+
+    /* Macro bodies use registers and immediates only */
+    kind = next_random(10);
+    if (kind < 5)
+    {
+        name = two_operands[next_random(4)];
+        printf("        %s ", name);
+        if (with_labels)
+        {
+            print_operand(shape, TRUE);
+        }
+        else
+        {
+            printf("#%d", next_random(64));
+        }
+        printf(", ");
+        if (with_labels)
+        {
+            print_operand(shape, strcmp(name, "cmp") == 0);
+        }
+        else
+        {
+            printf("r%d", next_random(8));
+        }
+        printf("\n");
+        return;
+    }
+
+    if (kind < 8 || !with_labels || total_labels == 0)
+    {
+        name = one_operand[next_random(6)];
+        printf("        %s ", name);
+        if (with_labels)
+        {
+            print_operand(shape, strcmp(name, "prn") == 0);
+        }
+        else
+        {
+            printf("r%d", next_random(8));
+        }
+        printf("\n");
+        return;
+    }
+
+    printf("        %s ", jumps[next_random(3)]);
+    print_label_operand(shape);
+    printf("\n");
+}
+
+static void print_data(const struct shape *shape)
+{
+    int id;
+
+    if (chance(30))
+    {
+        printf("        .string \"");
+        for (id = 0; id < 8 + next_random(24); id++)
+        {
+            putchar('a' + next_random(26));
+        }
+        printf("\"\n");
+        return;
+    }
+
+    printf("        .data ");
+    for (id = 0; id < shape->data_width; id++)
+    {
+        printf("%s%d", id == 0 ? "" : ", ", next_random(2000) - 1000);
+    }
+    printf("\n");
+}
+
+static void generate(const struct shape *shape)
+{
+    long line;
+    long label;
+    int id;
+    int body;
+
+    /* Decide which statements carry labels */
+    total_labels = 0;
+    label_lines = malloc(sizeof(*label_lines) * (shape->lines + 1));
+    for (line = 0; line < shape->lines; line++)
+    {
+        if (chance(shape->label_density))
+        {
+            label_lines[total_labels] = line;
+            total_labels++;
+        }
+    }
+    next_label = 0;
+
+    printf("; generated program, seed %ld\n", shape->seed);
+    for (id = 0; id < shape->externs; id++)
+    {
+        printf(".extern X%d\n", id);
+    }
+    for (label = 0; label < total_labels; label++)
+    {
+        if (chance(shape->entry_ratio))
+        {
+            printf(".entry L%ld\n", label);
+        }
+    }
+
+    for (id = 0; id < shape->macros; id++)
+    {
+        printf("macr m%d\n", id);
+        for (body = 0; body < shape->macro_body; body++)
+        {
+            print_instruction(shape, FALSE);
+        }
+        printf("endmacr\n");
+    }
+
+    for (line = 0; line < shape->lines; line++)
+    {
+        if (next_label < total_labels && label_lines[next_label] == line)
+        {
+            printf("L%ld:", next_label);
+            next_label++;
+        }
+
+        if (line == shape->lines - 1)
+        {
+            printf("        stop\n"); /* Last statement ends the program */
+        }
+        else if (shape->macros > 0 && chance(shape->macro_calls))
+        {
+            printf("        m%d\n", next_random(shape->macros));
+        }
+        else if (chance(shape->data_ratio))
+        {
+            print_data(shape);
+        }
+        else
+        {
+            print_instruction(shape, TRUE);
+        }
+    }
+
+    free(label_lines);
+}
+
+struct option
+{
+    const char *name; /* Option name */
+    long *value; /* Shape field set by the option */
+};
+
+int main(int argc, char *argv[])
+{
+    struct shape shape;
+    struct option options[] = {
+        {"--lines", NULL},
+        {"--label-density", NULL},
+        {"--forward-ratio", NULL},
+        {"--macros", NULL},
+        {"--macro-body", NULL},
+        {"--macro-calls", NULL},
+        {"--data-ratio", NULL},
+        {"--data-width", NULL},
+        {"--externs", NULL},
+        {"--extern-ratio", NULL},
+        {"--entry-ratio", NULL},
+        {"--seed", NULL}};
+    int total_options;
+    int length;
+    int id;
+    int option_id;
+
+    shape.lines = 1000;
+    shape.label_density = 20;
+    shape.forward_ratio = 50;
+    shape.macros = 0;
+    shape.macro_body = 4;
+    shape.macro_calls = 5;
+    shape.data_ratio = 10;
+    shape.data_width = 4;
+    shape.externs = 0;
+    shape.extern_ratio = 10;
+    shape.entry_ratio = 5;
+    shape.seed = 1;
+
+    options[0].value = &shape.lines;
+    options[1].value = &shape.label_density;
+    options[2].value = &shape.forward_ratio;
+    options[3].value = &shape.macros;
+    options[4].value = &shape.macro_body;
+    options[5].value = &shape.macro_calls;
+    options[6].value = &shape.data_ratio;
+    options[7].value = &shape.data_width;
+    options[8].value = &shape.externs;
+    options[9].value = &shape.extern_ratio;
+    options[10].value = &shape.entry_ratio;
+    options[11].value = &shape.seed;
+    total_options = sizeof(options) / sizeof(options[0]);
+
+    for (id = 1; id < argc; id++)
+    {
+        /* Options have the form --name=value */
+        for (option_id = 0; option_id < total_options; option_id++)
+        {
+            length = strlen(options[option_id].name);
+            if (strncmp(argv[id], options[option_id].name, length) == 0 && argv[id][length] == '=')
+            {
+                *options[option_id].value = atol(&argv[id][length + 1]);
+                break;
+            }
+        }
+
+        if (option_id == total_options)
+        {
+            fprintf(
+                stderr,
+                "Usage: %s [--lines=N] [--label-density=P] [--forward-ratio=P] [--macros=N]\n"
+                "       [--macro-body=N] [--macro-calls=P] [--data-ratio=P] [--data-width=N]\n"
+                "       [--externs=N] [--extern-ratio=P] [--entry-ratio=P] [--seed=N]\n",
+                argv[0]);
+            return (-1);
+        }
+    }
+
+    if (shape.lines < 1 || shape.data_width < 1 || shape.data_width > 32)
+    {
+        fprintf(stderr, "%s: invalid program shape\n", argv[0]);
+        return (-1);
+    }
+
+    random_state = (unsigned long)shape.seed;
+    generate(&shape);
+    return 0;
+}
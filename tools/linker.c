@@ -0,0 +1,607 @@
+#define _POSIX_C_SOURCE 200809L
+#include <ctype.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "definitions.h"
+#include "hashtable.h"
+
+/* Links units assembled with --reloc into one image */
+
+#define LINK_RELOCATABLE_FLAG (0x2) /* Flag of a word holding a resolved address */
+#define LINK_FLAGS_MASK (0x7) /* A, R and E bits of a word */
+#define LINK_MAX_THREADS (64) /* Upper bound of --threads */
+
+enum
+{
+    UNIT_OB,
+    UNIT_ENT,
+    UNIT_EXT,
+    UNIT_REL,
+    UNIT_TOTAL_FILES
+};
+
+static const char *unit_extensions[] = {".ob", ".ent", ".ext", ".rel"};
+
+/* Structure for a read only view of an input file */
+struct MappedFile
+{
+    char *data; /* Mapped contents, NULL if the file is missing or empty */
+    size_t length; /* Bytes mapped */
+};
+
+/* Structure for a position in a mapped file */
+struct Cursor
+{
+    const char *at; /* Next character */
+    const char *end; /* End of the file */
+};
+
+/* Structure for one input unit */
+struct Unit
+{
+    const char *name; /* Path without extension */
+    struct MappedFile files[UNIT_TOTAL_FILES]; /* Outputs of the assembler */
+    int base; /* Base the unit was assembled for */
+    int code_size; /* Code words */
+    int data_size; /* Data words */
+    int code_address; /* Linked address of the first code word */
+    int data_address; /* Linked address of the first data word */
+    int valid; /* FALSE if the unit could not be read */
+    char *errors; /* Messages of the patching phase, printed in unit order */
+    size_t errors_length; /* Bytes used in errors */
+};
+
+/* Structure for one exported symbol */
+struct Symbol
+{
+    const char *name; /* Name inside the mapped .ent file */
+    int length; /* Length of the name */
+    int address; /* Linked address */
+};
+
+static struct Unit *units; /* Units in command line order */
+static int total_units; /* Number of units */
+static struct HashTable symbol_index; /* Symbol names to indexes in symbols */
+static struct Symbol *symbols; /* Exported symbols */
+static int total_symbols; /* Number of exported symbols */
+static int symbols_limit; /* Allocated symbols */
+static int *image; /* Linked words in address order */
+static char *relocatable; /* TRUE for words that hold a linked address */
+static int link_base; /* Address of the first linked word */
+static int total_workers; /* Threads used for the parallel phases */
+
+static void map_file(
+    struct MappedFile *file,
+    const char *path
+)
+{
+    int descriptor;
+    struct stat info;
+
+    file->data = NULL;
+    file->length = 0;
+
+    descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+    {
+        return;
+    }
+
+    if (fstat(descriptor, &info) == 0 && info.st_size > 0)
+    {
+        file->data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (file->data == MAP_FAILED)
+        {
+            file->data = NULL;
+        }
+        else
+        {
+            file->length = info.st_size;
+        }
+    }
+    close(descriptor);
+}
+
+static void Cursor_init(
+    struct Cursor *cursor,
+    const struct MappedFile *file
+)
+{
+    cursor->at = file->data;
+    cursor->end = file->data + file->length;
+}
+
+static void skip_blanks(struct Cursor *cursor)
+{
+    while (cursor->at < cursor->end && (*cursor->at == ' ' || *cursor->at == '\t'))
+    {
+        cursor->at++;
+    }
+}
+
+static void skip_spaces(struct Cursor *cursor)
+{
+    while (cursor->at < cursor->end && isspace((unsigned char)*cursor->at))
+    {
+        cursor->at++;
+    }
+}
+
+/* Read a number in the given radix, FALSE if there is none */
+static int read_number(
+    struct Cursor *cursor,
+    int radix,
+    int *value
+)
+{
+    int digits;
+
+    skip_blanks(cursor);
+    *value = 0;
+    for (digits = 0; cursor->at < cursor->end && *cursor->at >= '0' && *cursor->at < '0' + radix; digits++)
+    {
+        *value = *value * radix + (*cursor->at - '0');
+        cursor->at++;
+    }
+    return digits > 0;
+}
+
+/* Read a symbol name, its length is 0 at the end of the file */
+static int read_name(
+    struct Cursor *cursor,
+    const char **name
+)
+{
+    skip_spaces(cursor);
+    *name = cursor->at;
+    while (cursor->at < cursor->end && !isspace((unsigned char)*cursor->at))
+    {
+        cursor->at++;
+    }
+    return cursor->at - *name;
+}
+
+/* Check if another number follows on the current line */
+static int more_on_line(struct Cursor *cursor)
+{
+    skip_blanks(cursor);
+    return cursor->at < cursor->end && *cursor->at != '\n' && *cursor->at != '\r';
+}
+
+static void unit_error(
+    struct Unit *unit,
+    const char *message,
+    const char *name,
+    int length
+)
+{
+    size_t size;
+
+    size = strlen(unit->name) + strlen(message) + length + 8;
+    unit->errors = realloc(unit->errors, unit->errors_length + size);
+    unit->errors_length += sprintf(&unit->errors[unit->errors_length], "%s: %s%.*s\n", unit->name, message, length, name);
+}
+
+/* Linked address of an address of the unit, -1 if it is outside the unit */
+static int link_address(
+    const struct Unit *unit,
+    int address
+)
+{
+    if (address < unit->base || address >= unit->base + unit->code_size + unit->data_size)
+    {
+        return -1;
+    }
+    if (address < unit->base + unit->code_size)
+    {
+        return unit->code_address + address - unit->base;
+    }
+    return unit->data_address + address - unit->base - unit->code_size; /* Data follows all code */
+}
+
+static void open_unit(struct Unit *unit)
+{
+    char path[MAX_PATH_LEN];
+    struct Cursor cursor;
+    int file;
+
+    for (file = 0; file < UNIT_TOTAL_FILES; file++)
+    {
+        sprintf(path, "%s%s", unit->name, unit_extensions[file]);
+        map_file(&unit->files[file], path);
+    }
+
+    Cursor_init(&cursor, &unit->files[UNIT_OB]);
+    unit->valid = read_number(&cursor, 10, &unit->code_size) && read_number(&cursor, 10, &unit->data_size);
+    if (!unit->valid)
+    {
+        unit_error(unit, "cannot read the object file", "", 0);
+        return;
+    }
+
+    /* Units move as a whole, so every label address must be known */
+    Cursor_init(&cursor, &unit->files[UNIT_REL]);
+    skip_spaces(&cursor);
+    if (cursor.end - cursor.at < 4 || strncmp(cursor.at, "base", 4) != 0)
+    {
+        unit->valid = FALSE;
+        unit_error(unit, "no relocation table, assemble the unit with --reloc", "", 0);
+        return;
+    }
+    cursor.at += 4;
+    unit->valid = read_number(&cursor, 10, &unit->base);
+}
+
+static void collect_symbols(struct Unit *unit)
+{
+    struct Cursor cursor;
+    const char *name;
+    char key[TOTAL_LEN];
+    int length;
+    int address;
+
+    Cursor_init(&cursor, &unit->files[UNIT_ENT]);
+    while ((length = read_name(&cursor, &name)) > 0)
+    {
+        if (!read_number(&cursor, 10, &address) || (address = link_address(unit, address)) < 0 || length >= TOTAL_LEN)
+        {
+            unit_error(unit, "bad entry ", name, length);
+            continue;
+        }
+
+        if (total_symbols == symbols_limit)
+        {
+            symbols_limit += MEMORY_BLOCK_SIZE * MEMORY_BLOCK_SIZE; /* Increase limit */
+            symbols = realloc(symbols, sizeof(*symbols) * symbols_limit);
+        }
+
+        memcpy(key, name, length);
+        key[length] = '\0';
+        if (!HashTable_insert(&symbol_index, key, total_symbols))
+        {
+            unit_error(unit, "symbol defined more than once ", name, length);
+            continue;
+        }
+        symbols[total_symbols].name = name;
+        symbols[total_symbols].length = length;
+        symbols[total_symbols].address = address;
+        total_symbols++;
+    }
+}
+
+/* Copy the words of a unit into the image and patch them, runs in parallel */
+static void patch_unit(struct Unit *unit)
+{
+    struct Cursor cursor;
+    const char *name;
+    char key[TOTAL_LEN];
+    int length;
+    int address;
+    int value;
+    int word;
+    int symbol;
+
+    Cursor_init(&cursor, &unit->files[UNIT_OB]);
+    read_number(&cursor, 10, &value);
+    read_number(&cursor, 10, &value);
+    skip_spaces(&cursor);
+    while (read_number(&cursor, 10, &address) && read_number(&cursor, 8, &value))
+    {
+        word = link_address(unit, address);
+        if (word < 0)
+        {
+            unit_error(unit, "word outside the unit", "", 0);
+            return;
+        }
+        image[word - link_base] = value;
+        skip_spaces(&cursor);
+    }
+
+    /* Label addresses of the unit itself */
+    Cursor_init(&cursor, &unit->files[UNIT_REL]);
+    skip_spaces(&cursor);
+    cursor.at += 4;
+    read_number(&cursor, 10, &value);
+    skip_spaces(&cursor);
+    while (read_number(&cursor, 10, &address))
+    {
+        word = link_address(unit, address);
+        value = word < 0 ? -1 : link_address(unit, image[word - link_base] >> 3);
+        if (value < 0)
+        {
+            unit_error(unit, "relocated word does not point into the unit", "", 0);
+            return;
+        }
+        image[word - link_base] = (value << 3) | (image[word - link_base] & LINK_FLAGS_MASK);
+        relocatable[word - link_base] = TRUE;
+        skip_spaces(&cursor);
+    }
+
+    /* External references, one or more addresses follow each name */
+    Cursor_init(&cursor, &unit->files[UNIT_EXT]);
+    while ((length = read_name(&cursor, &name)) > 0)
+    {
+        symbol = -1;
+        if (length < TOTAL_LEN)
+        {
+            memcpy(key, name, length);
+            key[length] = '\0';
+            symbol = HashTable_find(&symbol_index, key);
+        }
+        if (symbol < 0)
+        {
+            unit_error(unit, "undefined symbol ", name, length);
+        }
+
+        while (more_on_line(&cursor) && read_number(&cursor, 10, &address))
+        {
+            word = link_address(unit, address);
+            if (word >= 0 && symbol >= 0)
+            {
+                image[word - link_base] = (symbols[symbol].address << 3) | LINK_RELOCATABLE_FLAG;
+                relocatable[word - link_base] = TRUE;
+            }
+        }
+    }
+}
+
+/* Structure for the share of one worker thread */
+struct Worker
+{
+    pthread_t thread; /* Thread handle */
+    int first; /* First unit of the worker */
+    void (*work)(struct Unit *); /* Function applied to each unit */
+};
+
+static void *run_worker(void *argument)
+{
+    struct Worker *worker = argument;
+    int id;
+
+    for (id = worker->first; id < total_units; id += total_workers)
+    {
+        worker->work(&units[id]);
+    }
+    return NULL;
+}
+
+/* Apply a function to every unit, units are spread over the workers */
+static void for_each_unit(void (*work)(struct Unit *))
+{
+    struct Worker workers[LINK_MAX_THREADS];
+    int id;
+
+    for (id = 0; id < total_workers; id++)
+    {
+        workers[id].first = id;
+        workers[id].work = work;
+        if (id > 0 && pthread_create(&workers[id].thread, NULL, run_worker, &workers[id]) != 0)
+        {
+            workers[id].work = NULL; /* Done by the calling thread below */
+        }
+    }
+
+    run_worker(&workers[0]);
+    for (id = 1; id < total_workers; id++)
+    {
+        if (workers[id].work == NULL)
+        {
+            workers[id].work = work;
+            run_worker(&workers[id]);
+        }
+        else
+        {
+            pthread_join(workers[id].thread, NULL);
+        }
+    }
+}
+
+static int print_errors(void)
+{
+    int id;
+    int total_errors;
+
+    total_errors = 0;
+    for (id = 0; id < total_units; id++)
+    {
+        if (units[id].errors_length > 0)
+        {
+            fwrite(units[id].errors, 1, units[id].errors_length, stderr);
+            total_errors++;
+        }
+        free(units[id].errors);
+        units[id].errors = NULL;
+        units[id].errors_length = 0;
+    }
+    return total_errors;
+}
+
+static int compare_symbols(const void *a, const void *b)
+{
+    const struct Symbol *first = a;
+    const struct Symbol *second = b;
+
+    return (first->address > second->address) - (first->address < second->address);
+}
+
+static int write_outputs(
+    const char *output_name,
+    int total_code,
+    int total_data
+)
+{
+    char path[MAX_PATH_LEN];
+    FILE *output;
+    int id;
+    int written;
+
+    sprintf(path, "%s.ob", output_name);
+    output = fopen(path, "w");
+    if (output == NULL)
+    {
+        return FALSE;
+    }
+    fprintf(output, "%d %d\n", total_code, total_data);
+    for (id = 0; id < total_code + total_data; id++)
+    {
+        fprintf(output, "%d %05o\n", link_base + id, image[id] & 0x7FFF);
+    }
+    written = fclose(output) == 0;
+
+    /* The linked image can be moved again like any unit */
+    sprintf(path, "%s.rel", output_name);
+    output = fopen(path, "w");
+    if (output == NULL)
+    {
+        return FALSE;
+    }
+    fprintf(output, "base %d\n", link_base);
+    for (id = 0; id < total_code + total_data; id++)
+    {
+        if (relocatable[id])
+        {
+            fprintf(output, "%04d\n", link_base + id);
+        }
+    }
+    written = fclose(output) == 0 && written;
+
+    sprintf(path, "%s.ent", output_name);
+    remove(path);
+    if (total_symbols > 0)
+    {
+        output = fopen(path, "w");
+        if (output == NULL)
+        {
+            return FALSE;
+        }
+        qsort(symbols, total_symbols, sizeof(*symbols), compare_symbols);
+        for (id = 0; id < total_symbols; id++)
+        {
+            fprintf(output, "%.*s %d\n", symbols[id].length, symbols[id].name, symbols[id].address);
+        }
+        written = fclose(output) == 0 && written;
+    }
+
+    return written;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *output_name;
+    int total_code;
+    int total_data;
+    int linked;
+    int id;
+    int file;
+
+    output_name = NULL;
+    link_base = LOAD_BASE_ADDRESS;
+    total_workers = sysconf(_SC_NPROCESSORS_ONLN);
+    units = malloc(sizeof(*units) * argc);
+    total_units = 0;
+
+    /* Options have the form --name=value, everything else is a unit */
+    for (id = 1; id < argc; id++)
+    {
+        if (strncmp(argv[id], "--output=", 9) == 0)
+        {
+            output_name = &argv[id][9];
+        }
+        else if (strncmp(argv[id], "--base=", 7) == 0)
+        {
+            link_base = atoi(&argv[id][7]);
+        }
+        else if (strncmp(argv[id], "--threads=", 10) == 0)
+        {
+            total_workers = atoi(&argv[id][10]);
+        }
+        else if (argv[id][0] != '-' && strlen(argv[id]) + 8 <= MAX_PATH_LEN)
+        {
+            memset(&units[total_units], 0, sizeof(units[total_units]));
+            units[total_units].name = argv[id];
+            total_units++;
+        }
+        else
+        {
+            output_name = NULL;
+            break;
+        }
+    }
+
+    if (output_name == NULL || total_units == 0 || link_base < 0 || strlen(output_name) + 8 > MAX_PATH_LEN)
+    {
+        fprintf(stderr, "Usage: %s --output=NAME [--base=N] [--threads=N] unit...\n", argv[0]);
+        free(units);
+        return (-1);
+    }
+    if (total_workers < 1)
+    {
+        total_workers = 1;
+    }
+    if (total_workers > LINK_MAX_THREADS)
+    {
+        total_workers = LINK_MAX_THREADS;
+    }
+
+    /* Map every unit, then place all code first and all data after it, like one unit */
+    for_each_unit(open_unit);
+    linked = print_errors() == 0;
+
+    total_code = 0;
+    for (id = 0; id < total_units; id++)
+    {
+        units[id].code_address = link_base + total_code;
+        total_code += units[id].code_size;
+    }
+    total_data = 0;
+    for (id = 0; id < total_units; id++)
+    {
+        units[id].data_address = link_base + total_code + total_data;
+        total_data += units[id].data_size;
+    }
+
+    /* Symbols are resolved in command line order so duplicates are reported stably */
+    HashTable_init(&symbol_index);
+    for (id = 0; linked && id < total_units; id++)
+    {
+        collect_symbols(&units[id]);
+    }
+    linked = print_errors() == 0 && linked;
+
+    image = calloc(total_code + total_data + 1, sizeof(*image));
+    relocatable = calloc(total_code + total_data + 1, sizeof(*relocatable));
+    if (linked)
+    {
+        for_each_unit(patch_unit);
+        linked = print_errors() == 0;
+    }
+
+    if (linked && !write_outputs(output_name, total_code, total_data))
+    {
+        fprintf(stderr, "Cannot write the linked image \"%s\"\n", output_name);
+        linked = FALSE;
+    }
+
+    for (id = 0; id < total_units; id++)
+    {
+        for (file = 0; file < UNIT_TOTAL_FILES; file++)
+        {
+            if (units[id].files[file].data != NULL)
+            {
+                munmap(units[id].files[file].data, units[id].files[file].length);
+            }
+        }
+    }
+    HashTable_free(&symbol_index);
+    free(symbols);
+    free(image);
+    free(relocatable);
+    free(units);
+    return linked ? 0 : (-1);
+}
@@ -0,0 +1,210 @@
+#define _POSIX_C_SOURCE 200809L
+#include <time.h>
+
+/* Microbenchmarks for the hot functions of the assembler. The passes
+ * source is included directly so its static functions can be timed. */
+#include "passes.c"
+
+#define WARMUP_SAMPLES (5) /* Samples discarded before measuring */
+#define TOTAL_SAMPLES (1000) /* Measured samples per benchmark, enough for ten above p99 */
+#define BATCH_SIZE (2000) /* Operations per sample */
+#define TOTAL_BENCH_LABELS (1000) /* Labels in the symbol table */
+#define TOTAL_BENCH_MACROS (1000) /* Macros in the macro list */
+
+struct benchmark
+{
+    const char *name; /* Benchmark name */
+    void (*run)(void); /* Runs BATCH_SIZE operations */
+};
+
+static const char *sample_lines[] = {
+    "LOOP:   prn #48\n",
+    "        mov *r6, L3 ; copy through pointer\n",
+    "        add r3, LIST\n",
+    "        cmp r3, #-6\n",
+    "        sub r1, r4\n",
+    "STR:    .string \"abcdef\"\n",
+    "LIST:   .data 6, -9, 15, 22, -100, 7\n",
+    "        stop\n"};
+
+#define TOTAL_SAMPLE_LINES (8) /* Number of sample lines */
+
+static FILE *null_file; /* Output sink for writer benchmarks */
+static struct passes bench_passes; /* Passes state for the benchmarks */
+static struct MacrosList bench_macros; /* Macro list for lookups */
+static char bench_names[TOTAL_BENCH_LABELS][TOTAL_LEN]; /* Label and macro names */
+static volatile int bench_sink; /* Keeps results alive */
+
+static double now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static void bench_get_word_number(void)
+{
+    int id;
+    const char *line;
+
+    for (id = 0; id < BATCH_SIZE; id++)
+    {
+        line = sample_lines[id % TOTAL_SAMPLE_LINES];
+        bench_sink += get_word_number(line, id % 5)[0];
+    }
+}
+
+static void bench_total_words_in_row(void)
+{
+    int id;
+
+    for (id = 0; id < BATCH_SIZE; id++)
+    {
+        bench_sink += total_words_in_row(sample_lines[id % TOTAL_SAMPLE_LINES]);
+    }
+}
+
+static void bench_label_lookup(void)
+{
+    int id;
+
+    for (id = 0; id < BATCH_SIZE; id++)
+    {
+        out_object_operand_file(
+            &bench_passes,
+            null_file,
+            null_file,
+            100,
+            bench_names[(id * 7919) % TOTAL_BENCH_LABELS],
+            SECOND_OPERAND);
+    }
+}
+
+static void bench_macros_find(void)
+{
+    int id;
+
+    for (id = 0; id < BATCH_SIZE; id++)
+    {
+        bench_sink += MacrosList_find(
+            &bench_macros,
+            bench_names[(id * 7919) % TOTAL_BENCH_MACROS]) != NULL;
+    }
+}
+
+static void bench_objects_output(void)
+{
+    int id;
+
+    for (id = 0; id < BATCH_SIZE; id++)
+    {
+        generate_objects_output(&bench_passes, null_file, 100 + id, id * 37);
+    }
+}
+
+static void bench_command_length(void)
+{
+    int id;
+    int total_words;
+    const char *line;
+
+    for (id = 0; id < BATCH_SIZE; id++)
+    {
+        line = sample_lines[1 + id % 4];
+        total_words = total_words_in_row(line);
+        bench_sink += check_command_length(&bench_passes, line, 0, total_words);
+    }
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    double first = *(const double *)a;
+    double second = *(const double *)b;
+
+    return (first > second) - (first < second);
+}
+
+static void run_benchmark(const struct benchmark *benchmark)
+{
+    double samples[TOTAL_SAMPLES];
+    double start;
+    int id;
+
+    for (id = 0; id < WARMUP_SAMPLES; id++)
+    {
+        benchmark->run(); /* Warm caches and branch predictors */
+    }
+
+    for (id = 0; id < TOTAL_SAMPLES; id++)
+    {
+        start = now_ns();
+        benchmark->run();
+        samples[id] = (now_ns() - start) / BATCH_SIZE; /* Nanoseconds per operation */
+    }
+
+    qsort(samples, TOTAL_SAMPLES, sizeof(samples[0]), compare_samples);
+    printf(
+        "%-22s %10.1f %10.1f %10.1f %10.1f\n",
+        benchmark->name,
+        samples[0],
+        samples[TOTAL_SAMPLES / 2],
+        samples[TOTAL_SAMPLES * 90 / 100],
+        samples[TOTAL_SAMPLES * 99 / 100]);
+}
+
+static void prepare_inputs(void)
+{
+    int id;
+
+    initialize_passes(&bench_passes);
+    MacrosList_init(&bench_macros);
+    total_functions = 100;
+
+    /* Same names on every run so results are comparable */
+    for (id = 0; id < TOTAL_BENCH_LABELS; id++)
+    {
+        sprintf(bench_names[id], "LABEL_%d", id);
+        insert_label(&bench_passes, bench_names[id]);
+        MacrosList_register(&bench_macros, bench_names[id]);
+        total_functions += 3;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const struct benchmark benchmarks[] = {
+        {"get_word_number", bench_get_word_number},
+        {"total_words_in_row", bench_total_words_in_row},
+        {"label_lookup", bench_label_lookup},
+        {"MacrosList_find", bench_macros_find},
+        {"objects_output", bench_objects_output},
+        {"check_command_length", bench_command_length}};
+    int total_benchmarks;
+    int id;
+
+    null_file = fopen("/dev/null", "w");
+    if (null_file == NULL)
+    {
+        fprintf(stderr, "%s: cannot open /dev/null\n", argv[0]);
+        return (-1);
+    }
+
+    prepare_inputs();
+    total_benchmarks = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+    printf("%-22s %10s %10s %10s %10s\n", "ns/op", "min", "median", "p90", "p99");
+    for (id = 0; id < total_benchmarks; id++)
+    {
+        if (argc > 1 && strcmp(argv[1], benchmarks[id].name) != 0)
+        {
+            continue; /* Run only the named benchmark */
+        }
+        run_benchmark(&benchmarks[id]);
+    }
+
+    MacrosList_free(&bench_macros);
+    release_passes_memory(&bench_passes);
+    fclose(null_file);
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+
+/* Moves an assembled unit to a new load address using its .rel table */
+
+#define WORD_ADDRESS_MASK (0xFFF) /* Address bits of a relocatable word */
+#define WORD_FLAGS_MASK (0x7) /* A, R and E bits of a word */
+
+static int *relocations; /* Addresses of relocatable words, ascending */
+static int total_relocations; /* Number of relocatable words */
+
+static int read_relocations(
+    const char *path,
+    int *old_base
+)
+{
+    FILE *input;
+    int address;
+    int limit;
+
+    input = fopen(path, "r");
+    if (input == NULL || fscanf(input, "base %d", old_base) != 1)
+    {
+        fprintf(stderr, "Cannot read relocation table \"%s\"\n", path);
+        if (input != NULL)
+        {
+            fclose(input);
+        }
+        return FALSE;
+    }
+
+    limit = 0;
+    while (fscanf(input, "%d", &address) == 1)
+    {
+        if (total_relocations == limit)
+        {
+            limit += MEMORY_BLOCK_SIZE * MEMORY_BLOCK_SIZE; /* Increase limit */
+            relocations = realloc(relocations, sizeof(*relocations) * limit);
+        }
+        relocations[total_relocations] = address;
+        total_relocations++;
+    }
+
+    fclose(input);
+    return TRUE;
+}
+
+static FILE *open_rewrite(
+    const char *path,
+    char *temporary
+)
+{
+    sprintf(temporary, "%s.tmp", path);
+    return fopen(temporary, "w");
+}
+
+static int finish_rewrite(
+    FILE *output,
+    const char *temporary,
+    const char *path
+)
+{
+    if (fclose(output) != 0 || rename(temporary, path) != 0)
+    {
+        fprintf(stderr, "Cannot write file \"%s\"\n", path);
+        remove(temporary);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static int rebase_object(
+    const char *path,
+    int new_base,
+    int delta
+)
+{
+    FILE *input;
+    FILE *output;
+    char temporary[MAX_PATH_LEN + 8];
+    int code_lines;
+    int data_lines;
+    int address;
+    unsigned int value;
+    int next;
+
+    input = fopen(path, "r");
+    if (input == NULL || fscanf(input, "%d %d", &code_lines, &data_lines) != 2)
+    {
+        fprintf(stderr, "Cannot read object file \"%s\"\n", path);
+        if (input != NULL)
+        {
+            fclose(input);
+        }
+        return FALSE;
+    }
+
+    /* Every word and every relocated address must stay within the address bits */
+    if (new_base + code_lines + data_lines > WORD_ADDRESS_MASK + 1)
+    {
+        fprintf(stderr, "Base %d leaves no room for the %d words of \"%s\"\n", new_base, code_lines + data_lines, path);
+        fclose(input);
+        return FALSE;
+    }
+
+    output = open_rewrite(path, temporary);
+    if (output == NULL)
+    {
+        fclose(input);
+        return FALSE;
+    }
+
+    fprintf(output, "%d %d\n", code_lines, data_lines);
+
+    /* Words and relocations are both in address order, walk them together */
+    next = 0;
+    while (fscanf(input, "%d %o", &address, &value) == 2)
+    {
+        while (next < total_relocations && relocations[next] < address)
+        {
+            next++;
+        }
+        if (next < total_relocations && relocations[next] == address)
+        {
+            value = (((value >> 3) + delta) & WORD_ADDRESS_MASK) << 3 | (value & WORD_FLAGS_MASK);
+        }
+        fprintf(output, "%d %05o\n", address + delta, value & 0x7FFF);
+    }
+
+    fclose(input);
+    return finish_rewrite(output, temporary, path);
+}
+
+static int rebase_symbols(
+    const char *path,
+    int delta,
+    const char *address_format
+)
+{
+    FILE *input;
+    FILE *output;
+    char temporary[MAX_PATH_LEN + 8];
+    char name[TOTAL_LEN];
+    int address;
+    int letter;
+
+    input = fopen(path, "r");
+    if (input == NULL)
+    {
+        return TRUE; /* Units without entries or externals have no such file */
+    }
+
+    output = open_rewrite(path, temporary);
+    if (output == NULL)
+    {
+        fclose(input);
+        return FALSE;
+    }
+
+    /* Each line is a name followed by one or more addresses */
+    while (fscanf(input, "%255s", name) == 1)
+    {
+        fputs(name, output);
+        while ((letter = getc(input)) == ' ' && fscanf(input, "%d", &address) == 1)
+        {
+            fputc(' ', output);
+            fprintf(output, address_format, address + delta);
+        }
+        fputc('\n', output);
+    }
+
+    fclose(input);
+    return finish_rewrite(output, temporary, path);
+}
+
+static int rewrite_relocations(
+    const char *path,
+    int new_base,
+    int delta
+)
+{
+    FILE *output;
+    char temporary[MAX_PATH_LEN + 8];
+    int id;
+
+    output = open_rewrite(path, temporary);
+    if (output == NULL)
+    {
+        return FALSE;
+    }
+
+    fprintf(output, "base %d\n", new_base);
+    for (id = 0; id < total_relocations; id++)
+    {
+        fprintf(output, "%04d\n", relocations[id] + delta);
+    }
+
+    return finish_rewrite(output, temporary, path);
+}
+
+int main(int argc, char *argv[])
+{
+    char path[MAX_PATH_LEN];
+    int old_base;
+    int new_base;
+    int delta;
+    int rebased;
+    long value;
+    char *end;
+
+    value = argc == 3 ? strtol(argv[2], &end, 10) : (-1);
+    if (argc != 3 || strlen(argv[1]) + 8 > MAX_PATH_LEN || end == argv[2] || *end != '\0' ||
+        value < 0 || value > WORD_ADDRESS_MASK)
+    {
+        fprintf(stderr, "Usage: %s <file-name> <new-base>\n", argv[0]);
+        return (-1);
+    }
+
+    sprintf(path, "%s.rel", argv[1]);
+    if (!read_relocations(path, &old_base))
+    {
+        return (-1);
+    }
+
+    new_base = (int)value;
+    delta = new_base - old_base;
+
+    sprintf(path, "%s.ob", argv[1]);
+    rebased = rebase_object(path, new_base, delta);
+
+    sprintf(path, "%s.ent", argv[1]);
+    rebased = rebased && rebase_symbols(path, delta, "%d");
+
+    sprintf(path, "%s.ext", argv[1]);
+    rebased = rebased && rebase_symbols(path, delta, "%04d");
+
+    sprintf(path, "%s.rel", argv[1]);
+    rebased = rebased && rewrite_relocations(path, new_base, delta);
+
+    free(relocations);
+    return rebased ? 0 : (-1);
+}
@@ -0,0 +1,589 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "definitions.h"
+#include "isa.h"
+
+/* Runs assembled programs, instructions are decoded once and cached per address */
+
+#if defined(__GNUC__) && !defined(SIM_NO_COMPUTED_GOTO)
+#define SIM_COMPUTED_GOTO
+#endif
+
+#define MEMORY_WORDS (4096) /* Addressable words */
+#define SIGN_BIT (0x4000) /* Sign bit of a word */
+#define ADDRESS_MASK (0xFFF) /* Bits of an address */
+#define TOTAL_REGISTERS (8) /* r0 to r7 */
+
+enum
+{
+    OP_MOV,
+    OP_CMP,
+    OP_ADD,
+    OP_SUB,
+    OP_LEA,
+    OP_CLR,
+    OP_NOT,
+    OP_INC,
+    OP_DEC,
+    OP_JMP,
+    OP_BNE,
+    OP_RED,
+    OP_PRN,
+    OP_JSR,
+    OP_RTS,
+    OP_STOP,
+    OP_DECODE, /* Slot not decoded yet */
+    OP_FAULT /* Slot that does not hold a valid instruction */
+};
+
+/* Structure for one predecoded instruction */
+struct Decoded
+{
+    unsigned char opcode; /* OP_ value */
+    unsigned char size; /* Words of the instruction */
+    unsigned char cycles; /* Words fetched plus memory operands */
+    unsigned char src_mode; /* Operand group of the source */
+    unsigned char dst_mode; /* Operand group of the destination */
+    int src; /* Immediate value, address or register of the source */
+    int dst; /* Immediate value, address or register of the destination */
+};
+
+/* Structure for the simulated machine */
+struct Machine
+{
+    int memory[MEMORY_WORDS]; /* Words */
+    int registers[TOTAL_REGISTERS]; /* r0 to r7 */
+    int zero; /* Last result was zero */
+    int negative; /* Last result was negative */
+    int stack[MEMORY_WORDS]; /* Return addresses of jsr */
+    int stack_size; /* Used stack entries */
+    struct Decoded decoded[MEMORY_WORDS + 1]; /* Cache, the extra slot stops runs past the end */
+    const char *invalid[MEMORY_WORDS + 1]; /* Why a slot decoded to OP_FAULT */
+    unsigned long profile[MEMORY_WORDS + 1]; /* Instructions executed at each address */
+    unsigned long instructions; /* Instructions executed */
+    unsigned long cycles; /* Cycles used */
+    int start; /* Address of the first loaded word */
+    const char *fault; /* Reason the run stopped early, NULL after stop */
+    int fault_address; /* Address of the instruction that faulted */
+};
+
+static struct Machine machine; /* The only machine */
+
+static int sign_extend(
+    int value,
+    int sign
+)
+{
+    return (value & sign) ? value - (sign << 1) : value;
+}
+
+/* Fill the cache slot of an address */
+static void decode(int address)
+{
+    struct Decoded *decoded;
+    struct DecodedInstruction instruction;
+    int valid;
+
+    decoded = &machine.decoded[address];
+    machine.invalid[address] = "invalid instruction";
+    valid = isa_decode(&machine.memory[address], MEMORY_WORDS - address, &instruction);
+
+    decoded->opcode = instruction.opcode;
+    decoded->size = instruction.size;
+    decoded->src_mode = instruction.source_group;
+    decoded->dst_mode = instruction.target_group;
+    decoded->src = instruction.source;
+    decoded->dst = instruction.target;
+
+    /* Every word is fetched, labels and indirect registers also read memory */
+    decoded->cycles = instruction.size;
+    decoded->cycles += (instruction.source_group & (DIR_GROUP_OPERAND | INDIR_GROUP_OPERAND)) != 0;
+    decoded->cycles += (instruction.target_group & (DIR_GROUP_OPERAND | INDIR_GROUP_OPERAND)) != 0;
+
+    if (valid && (instruction.source_flags == EXTERNAL_FLAG || instruction.target_flags == EXTERNAL_FLAG))
+    {
+        machine.invalid[address] = "unresolved external reference, link the program first";
+        valid = FALSE;
+    }
+
+    /* Only cmp and prn may have an immediate target, lea needs a label */
+    if (instruction.target_group == IMMEDIATE_GROUP_OPERAND && instruction.opcode != OP_CMP && instruction.opcode != OP_PRN)
+    {
+        valid = FALSE;
+    }
+    if (instruction.opcode == OP_LEA && instruction.source_group != DIR_GROUP_OPERAND)
+    {
+        valid = FALSE;
+    }
+
+    if (!valid)
+    {
+        decoded->opcode = OP_FAULT;
+        decoded->cycles = 0;
+    }
+}
+
+static int read_operand(
+    int mode,
+    int operand
+)
+{
+    switch (mode)
+    {
+    case REGISTER_GROUP_OPERAND:
+    {
+        return machine.registers[operand];
+    }
+    case IMMEDIATE_GROUP_OPERAND:
+    {
+        return operand & ISA_WORD_MASK;
+    }
+    case DIR_GROUP_OPERAND:
+    {
+        return machine.memory[operand];
+    }
+    default:
+    {
+        return machine.memory[machine.registers[operand] & ADDRESS_MASK];
+    }
+    }
+}
+
+static void write_operand(
+    int mode,
+    int operand,
+    int value
+)
+{
+    int address;
+    int id;
+
+    value &= ISA_WORD_MASK;
+    if (mode == REGISTER_GROUP_OPERAND)
+    {
+        machine.registers[operand] = value;
+        return;
+    }
+
+    address = mode == DIR_GROUP_OPERAND ? operand : machine.registers[operand] & ADDRESS_MASK;
+    machine.memory[address] = value;
+
+    /* Instructions that cover the word are decoded again */
+    for (id = address; id >= 0 && id > address - 3; id--)
+    {
+        machine.decoded[id].opcode = OP_DECODE;
+        machine.decoded[id].cycles = 0;
+    }
+}
+
+static int set_flags(int value)
+{
+    value &= ISA_WORD_MASK;
+    machine.zero = value == 0;
+    machine.negative = (value & SIGN_BIT) != 0;
+    return value;
+}
+
+static int jump_target(const struct Decoded *decoded)
+{
+    if (decoded->dst_mode == DIR_GROUP_OPERAND)
+    {
+        return decoded->dst;
+    }
+    return machine.registers[decoded->dst] & ADDRESS_MASK;
+}
+
+/* Run from an address until stop, a fault or the step limit */
+static void run(
+    int pc,
+    unsigned long max_steps
+)
+{
+    struct Decoded *decoded;
+    int value;
+    int letter;
+
+#ifdef SIM_COMPUTED_GOTO
+    static const void *handlers[] = {
+        __extension__ &&label_OP_MOV,
+        __extension__ &&label_OP_CMP,
+        __extension__ &&label_OP_ADD,
+        __extension__ &&label_OP_SUB,
+        __extension__ &&label_OP_LEA,
+        __extension__ &&label_OP_CLR,
+        __extension__ &&label_OP_NOT,
+        __extension__ &&label_OP_INC,
+        __extension__ &&label_OP_DEC,
+        __extension__ &&label_OP_JMP,
+        __extension__ &&label_OP_BNE,
+        __extension__ &&label_OP_RED,
+        __extension__ &&label_OP_PRN,
+        __extension__ &&label_OP_JSR,
+        __extension__ &&label_OP_RTS,
+        __extension__ &&label_OP_STOP,
+        __extension__ &&label_OP_DECODE,
+        __extension__ &&label_OP_FAULT};
+#define HANDLER(id) label_##id:
+#define DISPATCH() __extension__ ({ goto *handlers[decoded->opcode]; })
+#define NEXT() \
+    do \
+    { \
+        FETCH(); \
+        DISPATCH(); \
+    } while (0)
+#else
+#define HANDLER(id) case id:
+#define DISPATCH() goto dispatch
+#define NEXT() goto next
+#endif
+
+/* Count the instruction at pc before it runs */
+#define FETCH() \
+    do \
+    { \
+        decoded = &machine.decoded[pc]; \
+        machine.instructions++; \
+        machine.profile[pc]++; \
+        machine.cycles += decoded->cycles; \
+        if (machine.instructions > max_steps) \
+        { \
+            machine.fault = "step limit reached"; \
+            goto stopped; \
+        } \
+    } while (0)
+
+#ifdef SIM_COMPUTED_GOTO
+    NEXT();
+#else
+next:
+    FETCH();
+dispatch:
+    switch (decoded->opcode)
+    {
+#endif
+
+    HANDLER(OP_MOV)
+    {
+        write_operand(decoded->dst_mode, decoded->dst, read_operand(decoded->src_mode, decoded->src));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_CMP)
+    {
+        set_flags(read_operand(decoded->src_mode, decoded->src) - read_operand(decoded->dst_mode, decoded->dst));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_ADD)
+    {
+        value = read_operand(decoded->dst_mode, decoded->dst) + read_operand(decoded->src_mode, decoded->src);
+        write_operand(decoded->dst_mode, decoded->dst, set_flags(value));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_SUB)
+    {
+        value = read_operand(decoded->dst_mode, decoded->dst) - read_operand(decoded->src_mode, decoded->src);
+        write_operand(decoded->dst_mode, decoded->dst, set_flags(value));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_LEA)
+    {
+        write_operand(decoded->dst_mode, decoded->dst, decoded->src);
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_CLR)
+    {
+        write_operand(decoded->dst_mode, decoded->dst, set_flags(0));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_NOT)
+    {
+        value = ~read_operand(decoded->dst_mode, decoded->dst);
+        write_operand(decoded->dst_mode, decoded->dst, set_flags(value));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_INC)
+    {
+        value = read_operand(decoded->dst_mode, decoded->dst) + 1;
+        write_operand(decoded->dst_mode, decoded->dst, set_flags(value));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_DEC)
+    {
+        value = read_operand(decoded->dst_mode, decoded->dst) - 1;
+        write_operand(decoded->dst_mode, decoded->dst, set_flags(value));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_JMP)
+    {
+        pc = jump_target(decoded);
+        NEXT();
+    }
+    HANDLER(OP_BNE)
+    {
+        pc = machine.zero ? pc + decoded->size : jump_target(decoded);
+        NEXT();
+    }
+    HANDLER(OP_RED)
+    {
+        letter = getchar();
+        write_operand(decoded->dst_mode, decoded->dst, letter == EOF ? -1 : letter);
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_PRN)
+    {
+        printf("%d\n", sign_extend(read_operand(decoded->dst_mode, decoded->dst), SIGN_BIT));
+        pc += decoded->size;
+        NEXT();
+    }
+    HANDLER(OP_JSR)
+    {
+        if (machine.stack_size == MEMORY_WORDS)
+        {
+            machine.fault = "stack overflow";
+            goto stopped;
+        }
+        machine.stack[machine.stack_size] = pc + decoded->size;
+        machine.stack_size++;
+        pc = jump_target(decoded);
+        NEXT();
+    }
+    HANDLER(OP_RTS)
+    {
+        if (machine.stack_size == 0)
+        {
+            machine.fault = "rts with an empty stack";
+            goto stopped;
+        }
+        machine.stack_size--;
+        pc = machine.stack[machine.stack_size];
+        NEXT();
+    }
+    HANDLER(OP_STOP)
+    {
+        machine.fault = NULL;
+        goto stopped;
+    }
+    HANDLER(OP_DECODE)
+    {
+        decode(pc);
+        machine.cycles += decoded->cycles;
+        DISPATCH();
+    }
+    HANDLER(OP_FAULT)
+    {
+        machine.fault = machine.invalid[pc];
+        machine.instructions--; /* It did not run */
+        machine.profile[pc]--;
+        goto stopped;
+    }
+
+#ifndef SIM_COMPUTED_GOTO
+    }
+#endif
+
+stopped:
+    machine.fault_address = pc;
+
+#undef HANDLER
+#undef DISPATCH
+#undef NEXT
+#undef FETCH
+}
+
+static int load_object(const char *name)
+{
+    char path[MAX_PATH_LEN];
+    FILE *input;
+    int code_lines;
+    int data_lines;
+    int address;
+    unsigned int value;
+    int id;
+
+    sprintf(path, "%s.ob", name);
+    input = fopen(path, "r");
+    if (input == NULL || fscanf(input, "%d %d", &code_lines, &data_lines) != 2)
+    {
+        fprintf(stderr, "Cannot read object file \"%s\"\n", path);
+        if (input != NULL)
+        {
+            fclose(input);
+        }
+        return FALSE;
+    }
+
+    machine.start = -1;
+    while (fscanf(input, "%d %o", &address, &value) == 2)
+    {
+        if (address < 0 || address >= MEMORY_WORDS)
+        {
+            fprintf(stderr, "Word at address %d does not fit in memory\n", address);
+            fclose(input);
+            return FALSE;
+        }
+        if (machine.start < 0)
+        {
+            machine.start = address; /* Programs start at their first word */
+        }
+        machine.memory[address] = value & ISA_WORD_MASK;
+    }
+    fclose(input);
+
+    for (id = 0; id < MEMORY_WORDS; id++)
+    {
+        machine.decoded[id].opcode = OP_DECODE;
+    }
+    machine.decoded[MEMORY_WORDS].opcode = OP_FAULT;
+    machine.invalid[MEMORY_WORDS] = "ran past the end of memory";
+
+    if (machine.start < 0)
+    {
+        fprintf(stderr, "Object file \"%s\" has no words\n", path);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static int compare_hot_spots(const void *a, const void *b)
+{
+    int first = *(const int *)a;
+    int second = *(const int *)b;
+
+    if (machine.profile[first] != machine.profile[second])
+    {
+        return machine.profile[first] < machine.profile[second] ? 1 : -1;
+    }
+    return first - second;
+}
+
+static void print_profile(int count)
+{
+    int addresses[MEMORY_WORDS];
+    int id;
+
+    for (id = 0; id < MEMORY_WORDS; id++)
+    {
+        addresses[id] = id;
+    }
+    qsort(addresses, MEMORY_WORDS, sizeof(addresses[0]), compare_hot_spots);
+
+    fprintf(stderr, "address  executed  share\n");
+    for (id = 0; id < count && id < MEMORY_WORDS && machine.profile[addresses[id]] > 0; id++)
+    {
+        fprintf(
+            stderr,
+            "%7d %9lu %5.1f%%\n",
+            addresses[id],
+            machine.profile[addresses[id]],
+            100.0 * machine.profile[addresses[id]] / machine.instructions);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *name;
+    unsigned long max_steps;
+    int profile_count;
+    int show_stats;
+    int show_registers;
+    int id;
+    clock_t started;
+    double seconds;
+
+    name = NULL;
+    max_steps = (unsigned long)-1;
+    profile_count = 0;
+    show_stats = FALSE;
+    show_registers = FALSE;
+
+    /* Options have the form --name=value, the last other argument is the program */
+    for (id = 1; id < argc; id++)
+    {
+        if (strncmp(argv[id], "--max-steps=", 12) == 0 && atol(&argv[id][12]) > 0)
+        {
+            max_steps = atol(&argv[id][12]);
+        }
+        else if (strncmp(argv[id], "--profile=", 10) == 0 && atoi(&argv[id][10]) > 0)
+        {
+            profile_count = atoi(&argv[id][10]);
+        }
+        else if (strcmp(argv[id], "--stats") == 0)
+        {
+            show_stats = TRUE;
+        }
+        else if (strcmp(argv[id], "--registers") == 0)
+        {
+            show_registers = TRUE;
+        }
+        else if (argv[id][0] != '-' && name == NULL && strlen(argv[id]) + 4 <= MAX_PATH_LEN)
+        {
+            name = argv[id];
+        }
+        else
+        {
+            name = NULL;
+            break;
+        }
+    }
+
+    if (name == NULL)
+    {
+        fprintf(
+            stderr,
+            "Usage: %s [--max-steps=N] [--profile=N] [--stats] [--registers] <file-name>\n",
+            argv[0]);
+        return (-1);
+    }
+
+    if (!load_object(name))
+    {
+        return (-1);
+    }
+
+    started = clock();
+    run(machine.start, max_steps);
+    seconds = (double)(clock() - started) / CLOCKS_PER_SEC;
+    fflush(stdout);
+
+    if (machine.fault != NULL)
+    {
+        fprintf(stderr, "Stopped at address %d: %s\n", machine.fault_address, machine.fault);
+    }
+
+    if (show_registers)
+    {
+        for (id = 0; id < TOTAL_REGISTERS; id++)
+        {
+            fprintf(stderr, "r%d %d\n", id, sign_extend(machine.registers[id], SIGN_BIT));
+        }
+    }
+
+    if (show_stats)
+    {
+        fprintf(stderr, "instructions %lu\n", machine.instructions);
+        fprintf(stderr, "cycles %lu\n", machine.cycles);
+        fprintf(stderr, "seconds %.3f\n", seconds);
+        if (seconds > 0)
+        {
+            fprintf(stderr, "instructions per second %.0f\n", machine.instructions / seconds);
+        }
+    }
+
+    if (profile_count > 0)
+    {
+        print_profile(profile_count);
+    }
+
+    return machine.fault == NULL ? 0 : (-1);
+}